@@ -710,10 +710,17 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
   for (auto object : context.GetObjectsListsToBeDeclared()) {
     gd::String objectListDeclaration = "";
     if (!context.ObjectAlreadyDeclared(object)) {
-      objectListDeclaration = "std::vector<RuntimeObject*> " +
-                              GetObjectListName(object, context) +
-                              " = runtimeContext->GetObjectsRawPointers(\"" +
-                              ConvertToString(object) + "\");\n";
+      // The identifier of the object name is only searched the first time
+      // the code is run.
+      gd::String objectNameId = GetObjectListName(object, context) + "Id";
+      objectListDeclaration =
+          "static const std::size_t " + objectNameId +
+          " = RuntimeContext::GetObjectNameId(\"" + ConvertToString(object) +
+          "\");\n";
+      objectListDeclaration += "std::vector<RuntimeObject*> " +
+                               GetObjectListName(object, context) +
+                               " = runtimeContext->GetObjectsRawPointers(" +
+                               objectNameId + ");\n";
       context.SetObjectDeclared(object);
     } else
       objectListDeclaration = declareObjectList(object, context);
@@ -12,6 +12,7 @@
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Cache.h"
 #include "GDCore/Events/Parsers/ExpressionParser2Node.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
 #include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
@@ -34,12 +35,15 @@ gd::String ExpressionCodeGenerator::GenerateExpressionCode(
     const gd::String& type,
     const gd::String& expression,
     const gd::String& objectName) {
-  gd::ExpressionParser2 parser(codeGenerator.GetPlatform(),
-                               codeGenerator.GetGlobalObjectsAndGroups(),
-                               codeGenerator.GetObjectsAndGroups());
   ExpressionCodeGenerator generator(codeGenerator, context);
 
-  auto node = parser.ParseExpression(type, expression, objectName);
+  auto node = codeGenerator.GetExpressionParserCache().ParseExpression(
+      codeGenerator.GetPlatform(),
+      codeGenerator.GetGlobalObjectsAndGroups(),
+      codeGenerator.GetObjectsAndGroups(),
+      type,
+      expression,
+      objectName);
   if (!node) {
     std::cout << "Error: error while parsing: \"" << expression << "\" ("
               << type << ")" << std::endl;
@@ -48,7 +52,7 @@ gd::String ExpressionCodeGenerator::GenerateExpressionCode(
   }
 
   gd::ExpressionValidator validator;
-  node->Visit(validator);
+  gd::ExpressionParser2Cache::Visit(*node, validator);
   if (!validator.GetErrors().empty()) {
     std::cout << "Error: \"" << validator.GetErrors()[0]->GetMessage()
               << "\" in: \"" << expression << "\" (" << type << ")"
@@ -57,7 +61,7 @@ gd::String ExpressionCodeGenerator::GenerateExpressionCode(
     return generator.GenerateDefaultValue(type);
   }
 
-  node->Visit(generator);
+  gd::ExpressionParser2Cache::Visit(*node, generator);
   return generator.GetOutput();
 }
 
@@ -306,13 +310,14 @@ gd::String ExpressionCodeGenerator::GenerateParametersCodes(
       } else if (parameterMetadata.IsOptional()) {
         // Optional parameters default value were not parsed at the time of the
         // expression parsing. Parse them now.
-        ExpressionParser2 parser(codeGenerator.GetPlatform(),
-                                 codeGenerator.GetGlobalObjectsAndGroups(),
-                                 codeGenerator.GetObjectsAndGroups());
-        auto node = parser.ParseExpression(parameterMetadata.GetType(),
-                                           parameterMetadata.GetDefaultValue());
-
-        node->Visit(generator);
+        auto node = codeGenerator.GetExpressionParserCache().ParseExpression(
+            codeGenerator.GetPlatform(),
+            codeGenerator.GetGlobalObjectsAndGroups(),
+            codeGenerator.GetObjectsAndGroups(),
+            parameterMetadata.GetType(),
+            parameterMetadata.GetDefaultValue());
+
+        gd::ExpressionParser2Cache::Visit(*node, generator);
         parametersCode += generator.GetOutput();
       } else {
         parametersCode +=
@@ -30,7 +30,7 @@ ExpressionParser2::ExpressionParser2(
     const gd::Platform& platform_,
     const gd::ObjectsContainer& globalObjectsContainer_,
     const gd::ObjectsContainer& objectsContainer_)
-    : expression(""),
+    : expression(),
       currentPosition(0),
       platform(platform_),
       globalObjectsContainer(globalObjectsContainer_),
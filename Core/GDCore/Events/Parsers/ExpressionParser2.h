@@ -7,6 +7,7 @@
 #define GDCORE_EXPRESSIONPARSER2_H
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -60,7 +61,10 @@ class GD_CORE_API ExpressionParser2 {
       const gd::String &type,
       const gd::String &expression_,
       const gd::String &objectName = "") {
-    expression = expression_;
+    // Decode the expression once, so that reading a character is constant time
+    // (positions in the expression are characters, not bytes).
+    expression.clear();
+    for (auto character : expression_) expression.push_back(character);
 
     currentPosition = 0;
     return Start(type, objectName);
@@ -770,8 +774,7 @@ class GD_CORE_API ExpressionParser2 {
     }
   }
 
-  void SkipIfChar(
-      const std::function<bool(gd::String::value_type)> &predicate) {
+  void SkipIfChar(bool (*predicate)(gd::String::value_type)) {
     if (CheckIfChar(predicate)) {
       currentPosition++;
     }
@@ -788,8 +791,7 @@ class GD_CORE_API ExpressionParser2 {
     return ExpressionParserLocation(startPosition, currentPosition);
   }
 
-  bool CheckIfChar(
-      const std::function<bool(gd::String::value_type)> &predicate) {
+  bool CheckIfChar(bool (*predicate)(gd::String::value_type)) {
     if (currentPosition >= expression.size()) return false;
     gd::String::value_type character = expression[currentPosition];
 
@@ -888,9 +890,14 @@ class GD_CORE_API ExpressionParser2 {
   bool IsNamespaceSeparator() {
     // Namespace separator is a special kind of delimiter as it is 2 characters
     // long
-    return (currentPosition + NAMESPACE_SEPARATOR.size() <= expression.size() &&
-            expression.substr(currentPosition, NAMESPACE_SEPARATOR.size()) ==
-                NAMESPACE_SEPARATOR);
+    if (currentPosition + NAMESPACE_SEPARATOR.size() > expression.size())
+      return false;
+
+    size_t position = currentPosition;
+    for (auto character : NAMESPACE_SEPARATOR) {
+      if (expression[position++] != character) return false;
+    }
+    return true;
   }
 
   bool IsEndReached() { return currentPosition >= expression.size(); }
@@ -1015,7 +1022,7 @@ class GD_CORE_API ExpressionParser2 {
   }
   ///@}
 
-  gd::String expression;
+  std::u32string expression;  ///< The expression being parsed, decoded.
   std::size_t currentPosition;
 
   const gd::Platform &platform;
@@ -0,0 +1,128 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ExpressionParser2Cache.h"
+
+#include <functional>
+
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodeWorker.h"
+#include "GDCore/Project/ObjectsContainer.h"
+
+namespace gd {
+
+namespace {
+void HashCombine(std::size_t &seed, std::size_t value) {
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+}  // namespace
+
+bool ExpressionParser2Cache::Key::operator==(const Key &other) const {
+  return platform == other.platform &&
+         globalObjectsContainer == other.globalObjectsContainer &&
+         globalObjectsContainerGeneration ==
+             other.globalObjectsContainerGeneration &&
+         objectsContainer == other.objectsContainer &&
+         objectsContainerGeneration == other.objectsContainerGeneration &&
+         *type == *other.type && *objectName == *other.objectName &&
+         *expression == *other.expression;
+}
+
+std::size_t ExpressionParser2Cache::KeyHash::operator()(const Key &key) const {
+  std::hash<std::string> stringHash;
+  std::size_t seed = stringHash(key.expression->Raw());
+  HashCombine(seed, stringHash(key.type->Raw()));
+  HashCombine(seed, stringHash(key.objectName->Raw()));
+  HashCombine(seed, key.globalObjectsContainerGeneration);
+  HashCombine(seed, key.objectsContainerGeneration);
+  return seed;
+}
+
+ExpressionParser2Cache::ExpressionParser2Cache(std::size_t maxSize_)
+    : maxSize(maxSize_), hitsCount(0), missesCount(0) {}
+
+std::shared_ptr<const ExpressionNode> ExpressionParser2Cache::ParseExpression(
+    const gd::Platform &platform,
+    const gd::ObjectsContainer &globalObjectsContainer,
+    const gd::ObjectsContainer &objectsContainer,
+    const gd::String &type,
+    const gd::String &expression,
+    const gd::String &objectName) {
+  Key key{&platform,
+          &globalObjectsContainer,
+          globalObjectsContainer.GetGeneration(),
+          &objectsContainer,
+          objectsContainer.GetGeneration(),
+          &type,
+          &objectName,
+          &expression};
+
+  auto it = entriesIndex.find(key);
+  if (it != entriesIndex.end()) {
+    hitsCount++;
+    entries.splice(entries.begin(), entries, it->second);
+    return it->second->node;
+  }
+
+  missesCount++;
+  gd::ExpressionParser2 parser(
+      platform, globalObjectsContainer, objectsContainer);
+  std::shared_ptr<const ExpressionNode> node =
+      parser.ParseExpression(type, expression, objectName);
+  if (!node) return node;
+
+  entries.push_front(Entry{type, objectName, expression, key, node});
+  Entry &entry = entries.front();
+  entry.key.type = &entry.type;
+  entry.key.objectName = &entry.objectName;
+  entry.key.expression = &entry.expression;
+  entriesIndex.emplace(entry.key, entries.begin());
+  RemoveExtraEntries();
+  return node;
+}
+
+void ExpressionParser2Cache::Visit(const ExpressionNode &node,
+                                   ExpressionParser2NodeWorker &worker) {
+  // Workers take non-const nodes, but the ones used with the cache don't
+  // modify them.
+  const_cast<ExpressionNode &>(node).Visit(worker);
+}
+
+void ExpressionParser2Cache::Clear() {
+  entriesIndex.clear();
+  entries.clear();
+  hitsCount = 0;
+  missesCount = 0;
+}
+
+std::size_t ExpressionParser2Cache::GetSize() const { return entries.size(); }
+
+std::size_t ExpressionParser2Cache::GetMaxSize() const { return maxSize; }
+
+void ExpressionParser2Cache::SetMaxSize(std::size_t maxSize_) {
+  maxSize = maxSize_;
+  RemoveExtraEntries();
+}
+
+std::size_t ExpressionParser2Cache::GetHitsCount() const { return hitsCount; }
+
+std::size_t ExpressionParser2Cache::GetMissesCount() const {
+  return missesCount;
+}
+
+double ExpressionParser2Cache::GetHitRate() const {
+  std::size_t lookupsCount = hitsCount + missesCount;
+  return lookupsCount == 0 ? 0 : (double)hitsCount / (double)lookupsCount;
+}
+
+void ExpressionParser2Cache::RemoveExtraEntries() {
+  while (entries.size() > maxSize) {
+    entriesIndex.erase(entries.back().key);
+    entries.pop_back();
+  }
+}
+
+}  // namespace gd
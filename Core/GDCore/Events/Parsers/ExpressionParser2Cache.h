@@ -0,0 +1,153 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EXPRESSIONPARSER2CACHE_H
+#define GDCORE_EXPRESSIONPARSER2CACHE_H
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include "GDCore/String.h"
+namespace gd {
+class ObjectsContainer;
+class Platform;
+struct ExpressionNode;
+class ExpressionParser2NodeWorker;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief A bounded cache of the trees returned by gd::ExpressionParser2.
+ *
+ * The same expressions are found many times in the events of a project. This
+ * cache keeps the most recently used trees, keyed by the expression, its type,
+ * the object name (for "objectvar") and the objects containers used for the
+ * parsing, including their generation (see gd::ObjectsContainer::GetGeneration).
+ *
+ * A cache must only be used during a single pass on events, during which the
+ * extensions of the platform and the objects can't change. It is used by the
+ * code generation (see gd::EventsCodeGenerator::GetExpressionParserCache),
+ * which validates and generates the code of each expression from the same
+ * tree.
+ *
+ * Trees are shared by all the users of the cache, so they are const: visit
+ * them with gd::ExpressionParser2Cache::Visit and workers that don't modify
+ * the nodes. Refactoring workers must parse a new tree with
+ * gd::ExpressionParser2.
+ *
+ * \see gd::ExpressionParser2
+ */
+class GD_CORE_API ExpressionParser2Cache {
+ public:
+  ExpressionParser2Cache(std::size_t maxSize_ = 4096);
+  virtual ~ExpressionParser2Cache(){};
+
+  /**
+   * \brief Return the parsed tree of the expression, parsing it only if not
+   * already done with the same parameters.
+   *
+   * See gd::ExpressionParser2::ParseExpression for the parameters.
+   */
+  std::shared_ptr<const ExpressionNode> ParseExpression(
+      const gd::Platform &platform,
+      const gd::ObjectsContainer &globalObjectsContainer,
+      const gd::ObjectsContainer &objectsContainer,
+      const gd::String &type,
+      const gd::String &expression,
+      const gd::String &objectName = "");
+
+  /**
+   * \brief Visit a tree returned by the cache with a worker that only reads
+   * the nodes (like gd::ExpressionValidator or gd::ExpressionCodeGenerator).
+   */
+  static void Visit(const ExpressionNode &node,
+                    ExpressionParser2NodeWorker &worker);
+
+  /**
+   * \brief Remove all the trees from the cache and reset the statistics.
+   */
+  void Clear();
+
+  /**
+   * \brief Return the number of trees stored in the cache.
+   */
+  std::size_t GetSize() const;
+
+  /**
+   * \brief Return the maximum number of trees stored in the cache.
+   */
+  std::size_t GetMaxSize() const;
+
+  /**
+   * \brief Change the maximum number of trees stored in the cache, removing
+   * the least recently used ones if needed.
+   */
+  void SetMaxSize(std::size_t maxSize_);
+
+  /**
+   * \brief Return the number of expressions found in the cache.
+   */
+  std::size_t GetHitsCount() const;
+
+  /**
+   * \brief Return the number of expressions that had to be parsed.
+   */
+  std::size_t GetMissesCount() const;
+
+  /**
+   * \brief Return the ratio of expressions found in the cache (between 0 and
+   * 1).
+   */
+  double GetHitRate() const;
+
+ private:
+  /**
+   * \brief The key of a tree. Strings are not copied: they are owned by the
+   * entry of the tree, or by the caller when searching a tree.
+   */
+  struct Key {
+    const gd::Platform *platform;
+    const gd::ObjectsContainer *globalObjectsContainer;
+    std::size_t globalObjectsContainerGeneration;
+    const gd::ObjectsContainer *objectsContainer;
+    std::size_t objectsContainerGeneration;
+    const gd::String *type;
+    const gd::String *objectName;
+    const gd::String *expression;
+
+    bool operator==(const Key &other) const;
+  };
+
+  struct KeyHash {
+    std::size_t operator()(const Key &key) const;
+  };
+
+  struct Entry {
+    gd::String type;
+    gd::String objectName;
+    gd::String expression;
+    Key key;  ///< The key of the tree, pointing to the strings of the entry.
+    std::shared_ptr<const ExpressionNode> node;
+  };
+
+  typedef std::list<Entry> EntriesList;
+
+  void RemoveExtraEntries();
+
+  EntriesList entries;  ///< The trees, the most recently used first.
+  std::unordered_map<Key, EntriesList::iterator, KeyHash>
+      entriesIndex;  ///< Index of the trees in entries.
+  std::size_t maxSize;
+  std::size_t hitsCount;
+  std::size_t missesCount;
+};
+
+}  // namespace gd
+
+#endif
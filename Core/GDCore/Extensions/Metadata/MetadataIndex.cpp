@@ -0,0 +1,122 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Extensions/Metadata/MetadataIndex.h"
+
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/EffectMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+
+namespace gd {
+
+namespace {
+/**
+ * Add all the metadata of a map to the index, unless already declared by a
+ * previous extension.
+ */
+template <class T>
+void IndexAll(std::unordered_map<gd::String, ExtensionAndMetadata<T>>& index,
+              const gd::PlatformExtension& extension,
+              const std::map<gd::String, T>& allMetadata) {
+  for (const auto& it : allMetadata)
+    index.emplace(it.first, ExtensionAndMetadata<T>(extension, it.second));
+}
+}  // namespace
+
+MetadataIndex::MetadataIndex(const gd::Platform& platform) {
+  // Extensions are indexed in the order they are searched by
+  // gd::MetadataProvider, so that the same metadata are found.
+  for (auto& extension : platform.GetAllPlatformExtensions()) {
+    const std::vector<gd::String> objectsTypes =
+        extension->GetExtensionObjectsTypes();
+    const std::vector<gd::String> behaviorsTypes =
+        extension->GetBehaviorsTypes();
+
+    for (const gd::String& behaviorType : behaviorsTypes)
+      behaviors.emplace(behaviorType,
+                        ExtensionAndMetadata<BehaviorMetadata>(
+                            *extension,
+                            extension->GetBehaviorMetadata(behaviorType)));
+    for (const gd::String& objectType : objectsTypes)
+      objects.emplace(objectType,
+                      ExtensionAndMetadata<ObjectMetadata>(
+                          *extension, extension->GetObjectMetadata(objectType)));
+    for (const gd::String& effectType : extension->GetExtensionEffectTypes())
+      effects.emplace(effectType,
+                      ExtensionAndMetadata<EffectMetadata>(
+                          *extension, extension->GetEffectMetadata(effectType)));
+
+    IndexAll(actions, *extension, extension->GetAllActions());
+    IndexAll(conditions, *extension, extension->GetAllConditions());
+    for (const gd::String& objectType : objectsTypes) {
+      IndexAll(
+          actions, *extension, extension->GetAllActionsForObject(objectType));
+      IndexAll(conditions,
+               *extension,
+               extension->GetAllConditionsForObject(objectType));
+    }
+    for (const gd::String& behaviorType : behaviorsTypes) {
+      IndexAll(actions,
+               *extension,
+               extension->GetAllActionsForBehavior(behaviorType));
+      IndexAll(conditions,
+               *extension,
+               extension->GetAllConditionsForBehavior(behaviorType));
+    }
+
+    IndexAll(expressions, *extension, extension->GetAllExpressions());
+    IndexAll(strExpressions, *extension, extension->GetAllStrExpressions());
+    for (const gd::String& objectType : objectsTypes) {
+      IndexAll(objectsExpressions[objectType],
+               *extension,
+               extension->GetAllExpressionsForObject(objectType));
+      IndexAll(objectsStrExpressions[objectType],
+               *extension,
+               extension->GetAllStrExpressionsForObject(objectType));
+    }
+    for (const gd::String& behaviorType : behaviorsTypes) {
+      IndexAll(behaviorsExpressions[behaviorType],
+               *extension,
+               extension->GetAllExpressionsForBehavior(behaviorType));
+      IndexAll(behaviorsStrExpressions[behaviorType],
+               *extension,
+               extension->GetAllStrExpressionsForBehavior(behaviorType));
+    }
+
+    IndexAll(baseObjectExpressions,
+             *extension,
+             extension->GetAllExpressionsForObject(""));
+    IndexAll(baseObjectStrExpressions,
+             *extension,
+             extension->GetAllStrExpressionsForObject(""));
+    IndexAll(baseBehaviorExpressions,
+             *extension,
+             extension->GetAllExpressionsForBehavior(""));
+    IndexAll(baseBehaviorStrExpressions,
+             *extension,
+             extension->GetAllStrExpressionsForBehavior(""));
+  }
+}
+
+const ExtensionAndMetadata<ExpressionMetadata>* MetadataIndex::Find(
+    const ExpressionsByOwnerType& index,
+    const MetadataByType<ExpressionMetadata>& baseIndex,
+    const gd::String& ownerType,
+    const gd::String& exprType) {
+  auto ownerIt = index.find(ownerType);
+  if (ownerIt != index.end()) {
+    auto it = ownerIt->second.find(exprType);
+    if (it != ownerIt->second.end()) return &it->second;
+  }
+
+  // Then check in the expressions of the base object/behavior.
+  return Find(baseIndex, exprType);
+}
+
+}  // namespace gd
@@ -0,0 +1,157 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_METADATAINDEX_H
+#define GDCORE_METADATAINDEX_H
+#include <unordered_map>
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/String.h"
+namespace gd {
+class BehaviorMetadata;
+class EffectMetadata;
+class ExpressionMetadata;
+class InstructionMetadata;
+class ObjectMetadata;
+class Platform;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief An index of the metadata declared by the extensions of a platform,
+ * by type, so that gd::MetadataProvider can find them without iterating on
+ * all the extensions.
+ *
+ * When a type is declared by more than one extension, the metadata of the
+ * first extension of the platform declaring it is indexed.
+ *
+ * \see gd::Platform::GetMetadataIndex
+ * \ingroup PlatformDefinition
+ */
+class GD_CORE_API MetadataIndex {
+ public:
+  /**
+   * \brief Build the index of all the metadata of the extensions of the
+   * platform.
+   */
+  MetadataIndex(const gd::Platform& platform);
+
+  /**
+   * \brief The metadata of objects, behaviors and effects, by type.
+   */
+  ///@{
+  const ExtensionAndMetadata<BehaviorMetadata>* FindBehavior(
+      const gd::String& behaviorType) const {
+    return Find(behaviors, behaviorType);
+  }
+  const ExtensionAndMetadata<ObjectMetadata>* FindObject(
+      const gd::String& objectType) const {
+    return Find(objects, objectType);
+  }
+  const ExtensionAndMetadata<EffectMetadata>* FindEffect(
+      const gd::String& effectType) const {
+    return Find(effects, effectType);
+  }
+  ///@}
+
+  /**
+   * \brief The metadata of actions and conditions (free, object and behavior
+   * instructions), by type.
+   */
+  ///@{
+  const ExtensionAndMetadata<InstructionMetadata>* FindAction(
+      const gd::String& actionType) const {
+    return Find(actions, actionType);
+  }
+  const ExtensionAndMetadata<InstructionMetadata>* FindCondition(
+      const gd::String& conditionType) const {
+    return Find(conditions, conditionType);
+  }
+  ///@}
+
+  /**
+   * \brief The metadata of free expressions, by type.
+   */
+  ///@{
+  const ExtensionAndMetadata<ExpressionMetadata>* FindExpression(
+      const gd::String& exprType) const {
+    return Find(expressions, exprType);
+  }
+  const ExtensionAndMetadata<ExpressionMetadata>* FindStrExpression(
+      const gd::String& exprType) const {
+    return Find(strExpressions, exprType);
+  }
+  ///@}
+
+  /**
+   * \brief The metadata of object and behavior expressions, by type of
+   * object/behavior and type of expression. Expressions of the base object
+   * (or base behavior) are returned if not found for the object (or
+   * behavior).
+   */
+  ///@{
+  const ExtensionAndMetadata<ExpressionMetadata>* FindObjectExpression(
+      const gd::String& objectType, const gd::String& exprType) const {
+    return Find(objectsExpressions, baseObjectExpressions, objectType, exprType);
+  }
+  const ExtensionAndMetadata<ExpressionMetadata>* FindObjectStrExpression(
+      const gd::String& objectType, const gd::String& exprType) const {
+    return Find(
+        objectsStrExpressions, baseObjectStrExpressions, objectType, exprType);
+  }
+  const ExtensionAndMetadata<ExpressionMetadata>* FindBehaviorExpression(
+      const gd::String& behaviorType, const gd::String& exprType) const {
+    return Find(
+        behaviorsExpressions, baseBehaviorExpressions, behaviorType, exprType);
+  }
+  const ExtensionAndMetadata<ExpressionMetadata>* FindBehaviorStrExpression(
+      const gd::String& behaviorType, const gd::String& exprType) const {
+    return Find(behaviorsStrExpressions,
+                baseBehaviorStrExpressions,
+                behaviorType,
+                exprType);
+  }
+  ///@}
+
+ private:
+  template <class T>
+  using MetadataByType =
+      std::unordered_map<gd::String, ExtensionAndMetadata<T>>;
+  typedef std::unordered_map<gd::String, MetadataByType<ExpressionMetadata>>
+      ExpressionsByOwnerType;
+
+  template <class T>
+  static const ExtensionAndMetadata<T>* Find(const MetadataByType<T>& index,
+                                             const gd::String& type) {
+    auto it = index.find(type);
+    return it != index.end() ? &it->second : nullptr;
+  }
+
+  static const ExtensionAndMetadata<ExpressionMetadata>* Find(
+      const ExpressionsByOwnerType& index,
+      const MetadataByType<ExpressionMetadata>& baseIndex,
+      const gd::String& ownerType,
+      const gd::String& exprType);
+
+  MetadataByType<BehaviorMetadata> behaviors;
+  MetadataByType<ObjectMetadata> objects;
+  MetadataByType<EffectMetadata> effects;
+  MetadataByType<InstructionMetadata> actions;
+  MetadataByType<InstructionMetadata> conditions;
+  MetadataByType<ExpressionMetadata> expressions;
+  MetadataByType<ExpressionMetadata> strExpressions;
+  ExpressionsByOwnerType objectsExpressions;
+  ExpressionsByOwnerType objectsStrExpressions;
+  ExpressionsByOwnerType behaviorsExpressions;
+  ExpressionsByOwnerType behaviorsStrExpressions;
+  MetadataByType<ExpressionMetadata> baseObjectExpressions;
+  MetadataByType<ExpressionMetadata> baseObjectStrExpressions;
+  MetadataByType<ExpressionMetadata> baseBehaviorExpressions;
+  MetadataByType<ExpressionMetadata> baseBehaviorStrExpressions;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_METADATAINDEX_H
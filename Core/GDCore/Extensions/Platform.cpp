@@ -4,9 +4,11 @@
  * reserved. This project is released under the MIT License.
  */
 #include "Platform.h"
+#include "GDCore/Extensions/Metadata/MetadataIndex.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/MakeUnique.h"
 
 using namespace std;
 
@@ -29,6 +31,9 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
   if (enableExtensionLoadingLogs) std::cout << std::endl;
 
   extensionsLoaded.push_back(extension);
+#if defined(GD_IDE_ONLY)
+  metadataIndex.reset();
+#endif
 
   // Load all creation/destruction functions for objects provided by the
   // extension
@@ -61,6 +66,9 @@ void Platform::RemoveExtension(const gd::String& name) {
                   return extension->GetName() == name;
                 }),
       extensionsLoaded.end());
+#if defined(GD_IDE_ONLY)
+  metadataIndex.reset();
+#endif
 }
 
 bool Platform::IsExtensionLoaded(const gd::String& name) const {
@@ -101,6 +109,12 @@ std::unique_ptr<gd::Object> Platform::CreateObject(
 }
 
 #if defined(GD_IDE_ONLY)
+const gd::MetadataIndex& Platform::GetMetadataIndex() const {
+  if (!metadataIndex) metadataIndex = gd::make_unique<gd::MetadataIndex>(*this);
+
+  return *metadataIndex;
+}
+
 std::shared_ptr<gd::BaseEvent> Platform::CreateEvent(
     const gd::String& eventType) const {
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
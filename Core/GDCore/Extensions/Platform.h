@@ -23,6 +23,7 @@ class BehaviorsSharedData;
 class PlatformExtension;
 class LayoutEditorCanvas;
 class ProjectExporter;
+class MetadataIndex;
 }  // namespace gd
 
 typedef std::function<std::unique_ptr<gd::Object>(gd::String name)>
@@ -123,6 +124,17 @@ class GD_CORE_API Platform {
    * anymore.
    */
   virtual void RemoveExtension(const gd::String& name);
+
+#if defined(GD_IDE_ONLY)
+  /**
+   * \brief Get the index of the metadata of the extensions, used by
+   * gd::MetadataProvider.
+   *
+   * The index is built when first used after an extension was added or
+   * removed.
+   */
+  const gd::MetadataIndex& GetMetadataIndex() const;
+#endif
   ///@}
 
   /** \name Factory method
@@ -172,6 +184,11 @@ class GD_CORE_API Platform {
   std::map<gd::String, CreateFunPtr>
       creationFunctionTable;  ///< Creation functions for objects
   bool enableExtensionLoadingLogs;
+#if defined(GD_IDE_ONLY)
+  mutable std::unique_ptr<gd::MetadataIndex>
+      metadataIndex;  ///< The index of the metadata of the extensions, or
+                      ///< nullptr if not built since extensions changed.
+#endif
 };
 
 }  // namespace gd
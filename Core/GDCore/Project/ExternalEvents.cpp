@@ -23,6 +23,7 @@ ExternalEvents& ExternalEvents::operator=(const ExternalEvents& rhs) {
 
 void ExternalEvents::Init(const ExternalEvents& externalEvents) {
   name = externalEvents.GetName();
+  namedItemsIndexLink.NameChanged();
   associatedScene = externalEvents.GetAssociatedLayout();
   lastChangeTimeStamp = externalEvents.GetLastChangeTimeStamp();
   events = externalEvents.events;
@@ -39,6 +40,7 @@ void ExternalEvents::SerializeTo(SerializerElement& element) const {
 void ExternalEvents::UnserializeFrom(gd::Project& project,
                                      const SerializerElement& element) {
   name = element.GetStringAttribute("name", "", "Name");
+  namedItemsIndexLink.NameChanged();
   associatedScene =
       element.GetStringAttribute("associatedLayout", "", "AssociatedScene");
   lastChangeTimeStamp =
@@ -11,6 +11,7 @@
 #include <vector>
 #include "GDCore/Events/EventsList.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NamedItemsIndex.h"
 namespace gd {
 class BaseEvent;
 }
@@ -48,7 +49,18 @@ class GD_CORE_API ExternalEvents {
   /**
    * \brief Change external events name
    */
-  virtual void SetName(const gd::String& name_) { name = name_; };
+  virtual void SetName(const gd::String& name_) {
+    name = name_;
+    namedItemsIndexLink.NameChanged();
+  };
+
+  /**
+   * \brief Return the link used to tell the index of the container owning
+   * the external events that it was renamed (see gd::NamedItemsIndex).
+   */
+  const gd::NamedItemsIndexLink& GetNamedItemsIndexLink() const {
+    return namedItemsIndexLink;
+  }
 
   /**
    * \brief Get the layout associated with external events.
@@ -108,6 +120,7 @@ class GD_CORE_API ExternalEvents {
 
  private:
   gd::String name;
+  gd::NamedItemsIndexLink namedItemsIndexLink;
   gd::String associatedScene;
   time_t lastChangeTimeStamp;  ///< Time of the last build
   gd::EventsList events;       ///< List of events
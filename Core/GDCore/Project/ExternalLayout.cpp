@@ -14,6 +14,7 @@ namespace gd {
 
 void ExternalLayout::UnserializeFrom(const SerializerElement& element) {
   name = element.GetStringAttribute("name", "", "Name");
+  namedItemsIndexLink.NameChanged();
   instances.UnserializeFrom(element.GetChild("instances", 0, "Instances"));
 #if defined(GD_IDE_ONLY)
   editionSettings.UnserializeFrom(element.GetChild("editionSettings"));
@@ -9,6 +9,7 @@
 #include <memory>
 #include "GDCore/Project/InitialInstancesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NamedItemsIndex.h"
 namespace gd {
 class SerializerElement;
 }
@@ -40,7 +41,18 @@ class GD_CORE_API ExternalLayout {
   /**
    * \brief Change the name of the external layout.
    */
-  void SetName(const gd::String& name_) { name = name_; }
+  void SetName(const gd::String& name_) {
+    name = name_;
+    namedItemsIndexLink.NameChanged();
+  }
+
+  /**
+   * \brief Return the link used to tell the index of the container owning
+   * the external layout that it was renamed (see gd::NamedItemsIndex).
+   */
+  const gd::NamedItemsIndexLink& GetNamedItemsIndexLink() const {
+    return namedItemsIndexLink;
+  }
 
   /**
    * \brief Return the container storing initial instances.
@@ -98,6 +110,7 @@ class GD_CORE_API ExternalLayout {
 
  private:
   gd::String name;
+  gd::NamedItemsIndexLink namedItemsIndexLink;
   gd::InitialInstancesContainer instances;
 #if defined(GD_IDE_ONLY)
   gd::LayoutEditorCanvasOptions editionSettings;
@@ -108,6 +108,7 @@ void ImageManager::ReloadImage(const gd::String& name) const {
 
     ResourcesLoader::Get()->LoadSFMLImage(image.GetFile(), oldTexture->image);
     oldTexture->texture.loadFromImage(oldTexture->image);
+    oldTexture->InvalidateAlphaMasks();
     oldTexture->texture.setSmooth(image.smooth);
 
     return;
@@ -190,6 +191,30 @@ SFMLTextureWrapper::SFMLTextureWrapper() {}
 
 SFMLTextureWrapper::~SFMLTextureWrapper() {}
 
+const AlphaMask& SFMLTextureWrapper::GetAlphaMask(sf::Uint8 alphaLimit) const {
+  for (const auto& alphaMask : alphaMasks)
+    if (alphaMask.first == alphaLimit) return *alphaMask.second;
+
+  alphaMasks.push_back(
+      std::make_pair(alphaLimit, std::make_shared<AlphaMask>(image, alphaLimit)));
+  return *alphaMasks.back().second;
+}
+
+AlphaMask::AlphaMask(const sf::Image& image, sf::Uint8 alphaLimit)
+    : width(image.getSize().x),
+      height(image.getSize().y),
+      wordsPerRow((width + 63) / 64 + 1) {
+  words.assign(wordsPerRow * height, 0);
+  const sf::Uint8* pixels = image.getPixelsPtr();
+  for (unsigned int y = 0; y < height; ++y) {
+    std::uint64_t* row = &words[y * wordsPerRow];
+    for (unsigned int x = 0; x < width; ++x) {
+      if (pixels[(y * width + x) * 4 + 3] > alphaLimit)
+        row[x / 64] |= (std::uint64_t)1 << (x % 64);
+    }
+  }
+}
+
 OpenGLTextureWrapper::OpenGLTextureWrapper(
     std::shared_ptr<SFMLTextureWrapper> sfmlTexture_) {
   sfmlTexture = sfmlTexture_;
@@ -10,8 +10,10 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/OpenGL.hpp>
 #include <SFML/System.hpp>
+#include <cstdint>
 #include <iostream>
 #include <memory>
+#include <utility>
 #include <vector>
 #include "GDCore/String.h"
 namespace gd {
@@ -146,6 +148,53 @@ class GD_CORE_API ImageManager {
 
 }  // namespace gd
 
+/**
+ * \brief A bit for each pixel of an image, set if the pixel is opaque.
+ *
+ * Bits of each row are packed in 64 bits words, followed by an empty word so
+ * that 64 consecutive pixels can be read starting at any position (see
+ * GetBits). Used for pixel perfect collisions.
+ *
+ * \see SFMLTextureWrapper::GetAlphaMask
+ * \ingroup ResourcesManagement
+ */
+class GD_CORE_API AlphaMask {
+ public:
+  /**
+   * \brief Create the mask of an image, a pixel being opaque if its alpha is
+   * greater than \a alphaLimit.
+   */
+  AlphaMask(const sf::Image& image, sf::Uint8 alphaLimit);
+
+  unsigned int GetWidth() const { return width; }
+  unsigned int GetHeight() const { return height; }
+
+  /**
+   * \brief Return true if the pixel at (x, y) is opaque.
+   */
+  bool IsOpaque(unsigned int x, unsigned int y) const {
+    return (words[y * wordsPerRow + x / 64] >> (x % 64)) & 1;
+  }
+
+  /**
+   * \brief Return the bits of the 64 pixels of the row \a y starting at \a x
+   * (the first one being the least significant bit). Bits of pixels after the
+   * end of the row are not set.
+   */
+  std::uint64_t GetBits(unsigned int x, unsigned int y) const {
+    const std::uint64_t* word = &words[y * wordsPerRow + x / 64];
+    unsigned int shift = x % 64;
+    if (shift == 0) return word[0];
+    return (word[0] >> shift) | (word[1] << (64 - shift));
+  }
+
+ private:
+  unsigned int width;
+  unsigned int height;
+  std::size_t wordsPerRow;
+  std::vector<std::uint64_t> words;
+};
+
 /**
  * \brief Class wrapping an SFML texture.
  *
@@ -158,10 +207,31 @@ class GD_CORE_API SFMLTextureWrapper {
   SFMLTextureWrapper();
   ~SFMLTextureWrapper();
 
+  /**
+   * \brief Return the mask of the opaque pixels of the image, a pixel being
+   * opaque if its alpha is greater than \a alphaLimit.
+   *
+   * The mask is computed the first time it is requested and then kept until
+   * InvalidateAlphaMasks is called.
+   */
+  const AlphaMask& GetAlphaMask(sf::Uint8 alphaLimit) const;
+
+  /**
+   * \brief Remove the masks computed by GetAlphaMask. Must be called when the
+   * image is updated.
+   */
+  void InvalidateAlphaMasks() { alphaMasks.clear(); }
+
   sf::Texture texture;
   sf::Image image;  ///< Associated sfml image, used for pixel perfect collision
                     ///< for example. If you update the image, call
-                    ///< LoadFromImage on texture to update it also.
+                    ///< LoadFromImage on texture to update it also, and
+                    ///< InvalidateAlphaMasks.
+
+ private:
+  mutable std::vector<std::pair<sf::Uint8, std::shared_ptr<const AlphaMask> > >
+      alphaMasks;  ///< The masks computed from the image, for each alpha
+                   ///< limit.
 };
 
 /**
@@ -67,6 +67,7 @@ Layout::Layout()
 
 void Layout::SetName(const gd::String& name_) {
   name = name_;
+  namedItemsIndexLink.NameChanged();
   mangledName = gd::SceneNameMangler::Get()->GetMangledSceneName(name);
 };
 
@@ -402,7 +403,9 @@ void Layout::Init(const Layout& other) {
   initialLayers = other.initialLayers;
   variables = other.GetVariables();
 
+  UpdateGeneration();
   initialObjects = gd::Clone(other.initialObjects);
+  objectsIndex.Invalidate();
 
   behaviorsSharedData.clear();
   for (const auto& it : other.behaviorsSharedData) {
@@ -431,6 +434,55 @@ std::vector<gd::String> GetHiddenLayers(const Layout& layout) {
 }
 
 #if defined(GD_IDE_ONLY)
+namespace {
+/**
+ * \brief Compute the type of the objects of a group, or return false if the
+ * group has objects of different types.
+ */
+bool GetTypeOfGroupObjects(const gd::ObjectsContainer& project,
+                           const gd::ObjectsContainer& layout,
+                           const gd::ObjectGroup& group,
+                           gd::String& type) {
+  const vector<gd::String>& groupsObjects = group.GetAllObjectsNames();
+  type = groupsObjects.empty()
+             ? ""
+             : GetTypeOfObject(project, layout, groupsObjects[0], false);
+
+  for (std::size_t j = 1; j < groupsObjects.size(); ++j) {
+    if (GetTypeOfObject(project, layout, groupsObjects[j], false) != type)
+      return false;
+  }
+
+  return true;
+}
+
+gd::String GetTypeOfGroup(const gd::ObjectsContainer& project,
+                          const gd::ObjectsContainer& layout,
+                          const gd::String& name,
+                          const gd::String& objectType) {
+  gd::String type = objectType;
+  const gd::ObjectGroupsContainer* groupsContainers[] = {
+      &layout.GetObjectGroups(), &project.GetObjectGroups()};
+  for (const gd::ObjectGroupsContainer* groups : groupsContainers) {
+    if (!groups->Has(name)) continue;
+
+    // A group has the name searched
+    // Verifying now that all objects have the same type.
+    gd::String groupType;
+    if (!GetTypeOfGroupObjects(project, layout, groups->Get(name), groupType))
+      return "";  // The group has more than one type.
+
+    if (!type.empty() && groupType != type)
+      return "";  // The group has objects of different type, so the group
+                  // has not any type.
+
+    type = groupType;
+  }
+
+  return type;
+}
+}  // namespace
+
 gd::String GD_CORE_API GetTypeOfObject(const gd::ObjectsContainer& project,
                                        const gd::ObjectsContainer& layout,
                                        gd::String name,
@@ -444,58 +496,7 @@ gd::String GD_CORE_API GetTypeOfObject(const gd::ObjectsContainer& project,
     type = project.GetObject(name).GetType();
 
   // Search in groups
-  if (searchInGroups) {
-    for (std::size_t i = 0; i < layout.GetObjectGroups().size(); ++i) {
-      if (layout.GetObjectGroups()[i].GetName() == name) {
-        // A group has the name searched
-        // Verifying now that all objects have the same type.
-
-        vector<gd::String> groupsObjects =
-            layout.GetObjectGroups()[i].GetAllObjectsNames();
-        gd::String previousType =
-            groupsObjects.empty()
-                ? ""
-                : GetTypeOfObject(project, layout, groupsObjects[0], false);
-
-        for (std::size_t j = 0; j < groupsObjects.size(); ++j) {
-          if (GetTypeOfObject(project, layout, groupsObjects[j], false) !=
-              previousType)
-            return "";  // The group has more than one type.
-        }
-
-        if (!type.empty() && previousType != type)
-          return "";  // The group has objects of different type, so the group
-                      // has not any type.
-
-        type = previousType;
-      }
-    }
-    for (std::size_t i = 0; i < project.GetObjectGroups().size(); ++i) {
-      if (project.GetObjectGroups()[i].GetName() == name) {
-        // A group has the name searched
-        // Verifying now that all objects have the same type.
-
-        vector<gd::String> groupsObjects =
-            project.GetObjectGroups()[i].GetAllObjectsNames();
-        gd::String previousType =
-            groupsObjects.empty()
-                ? ""
-                : GetTypeOfObject(project, layout, groupsObjects[0], false);
-
-        for (std::size_t j = 0; j < groupsObjects.size(); ++j) {
-          if (GetTypeOfObject(project, layout, groupsObjects[j], false) !=
-              previousType)
-            return "";  // The group has more than one type.
-        }
-
-        if (!type.empty() && previousType != type)
-          return "";  // The group has objects of different type, so the group
-                      // has not any type.
-
-        type = previousType;
-      }
-    }
-  }
+  if (searchInGroups) type = GetTypeOfGroup(project, layout, name, type);
 
   return type;
 }
@@ -552,57 +553,30 @@ GetBehaviorsOfObject(const gd::ObjectsContainer& project,
 
   // Search in groups
   if (searchInGroups) {
-    for (std::size_t i = 0; i < layout.GetObjectGroups().size(); ++i) {
-      if (layout.GetObjectGroups()[i].GetName() == name) {
-        // A group has the name searched
-        // Verifying now that all objects have common behaviors.
-
-        vector<gd::String> groupsObjects =
-            layout.GetObjectGroups()[i].GetAllObjectsNames();
-        for (std::size_t j = 0; j < groupsObjects.size(); ++j) {
-          // Get behaviors of the object of the group and delete behavior which
-          // are not in commons.
-          vector<gd::String> objectBehaviors =
-              GetBehaviorsOfObject(project, layout, groupsObjects[j], false);
-          if (!behaviorsAlreadyInserted) {
-            behaviorsAlreadyInserted = true;
-            behaviors = objectBehaviors;
-          } else {
-            for (std::size_t a = 0; a < behaviors.size(); ++a) {
-              if (find(objectBehaviors.begin(),
-                       objectBehaviors.end(),
-                       behaviors[a]) == objectBehaviors.end()) {
-                behaviors.erase(behaviors.begin() + a);
-                --a;
-              }
-            }
-          }
-        }
-      }
-    }
-    for (std::size_t i = 0; i < project.GetObjectGroups().size(); ++i) {
-      if (project.GetObjectGroups()[i].GetName() == name) {
-        // A group has the name searched
-        // Verifying now that all objects have common behaviors.
-
-        vector<gd::String> groupsObjects =
-            project.GetObjectGroups()[i].GetAllObjectsNames();
-        for (std::size_t j = 0; j < groupsObjects.size(); ++j) {
-          // Get behaviors of the object of the group and delete behavior which
-          // are not in commons.
-          vector<gd::String> objectBehaviors =
-              GetBehaviorsOfObject(project, layout, groupsObjects[j], false);
-          if (!behaviorsAlreadyInserted) {
-            behaviorsAlreadyInserted = true;
-            behaviors = objectBehaviors;
-          } else {
-            for (std::size_t a = 0; a < behaviors.size(); ++a) {
-              if (find(objectBehaviors.begin(),
-                       objectBehaviors.end(),
-                       behaviors[a]) == objectBehaviors.end()) {
-                behaviors.erase(behaviors.begin() + a);
-                --a;
-              }
+    const gd::ObjectGroupsContainer* groupsContainers[] = {
+        &layout.GetObjectGroups(), &project.GetObjectGroups()};
+    for (const gd::ObjectGroupsContainer* groups : groupsContainers) {
+      if (!groups->Has(name)) continue;
+
+      // A group has the name searched
+      // Verifying now that all objects have common behaviors.
+      const vector<gd::String>& groupsObjects =
+          groups->Get(name).GetAllObjectsNames();
+      for (std::size_t j = 0; j < groupsObjects.size(); ++j) {
+        // Get behaviors of the object of the group and delete behavior which
+        // are not in commons.
+        vector<gd::String> objectBehaviors =
+            GetBehaviorsOfObject(project, layout, groupsObjects[j], false);
+        if (!behaviorsAlreadyInserted) {
+          behaviorsAlreadyInserted = true;
+          behaviors = objectBehaviors;
+        } else {
+          for (std::size_t a = 0; a < behaviors.size(); ++a) {
+            if (find(objectBehaviors.begin(),
+                     objectBehaviors.end(),
+                     behaviors[a]) == objectBehaviors.end()) {
+              behaviors.erase(behaviors.begin() + a);
+              --a;
             }
           }
         }
@@ -17,6 +17,7 @@
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NamedItemsIndex.h"
 #if defined(GD_IDE_ONLY)
 #include "GDCore/IDE/Dialogs/LayoutEditorCanvas/LayoutEditorCanvasOptions.h"
 #endif
@@ -65,6 +66,14 @@ class GD_CORE_API Layout : public ObjectsContainer {
    */
   const gd::String& GetName() const { return name; };
 
+  /**
+   * \brief Return the link used to tell the index of the container owning
+   * the layout that it was renamed (see gd::NamedItemsIndex).
+   */
+  const gd::NamedItemsIndexLink& GetNamedItemsIndexLink() const {
+    return namedItemsIndexLink;
+  }
+
   /**
    * Return the name of the layout mangled by SceneNameMangler.
    */
@@ -410,6 +419,7 @@ class GD_CORE_API Layout : public ObjectsContainer {
  private:
   gd::String name;         ///< Scene name
   gd::String mangledName;  ///< The scene name mangled by SceneNameMangler
+  gd::NamedItemsIndexLink namedItemsIndexLink;
   unsigned int backgroundColorR;     ///< Background color Red component
   unsigned int backgroundColorG;     ///< Background color Green component
   unsigned int backgroundColorB;     ///< Background color Blue component
@@ -22,7 +22,7 @@ namespace gd {
  */
 class GD_CORE_API LoadingScreen {
  public:
-  LoadingScreen(){};
+  LoadingScreen() : showGDevelopSplash(true){};
   virtual ~LoadingScreen(){};
 
   /**
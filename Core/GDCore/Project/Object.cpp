@@ -24,6 +24,7 @@ Object::Object(const gd::String& name_) : name(name_) {}
 
 void Object::Init(const gd::Object& object) {
   name = object.name;
+  namedItemsIndexLink.NameChanged();
   type = object.type;
   objectVariables = object.objectVariables;
   tags = object.tags;
@@ -115,6 +116,7 @@ void Object::UnserializeFrom(gd::Project& project,
                              const SerializerElement& element) {
   type = element.GetStringAttribute("type");
   name = element.GetStringAttribute("name", name, "nom");
+  namedItemsIndexLink.NameChanged();
   tags = element.GetStringAttribute("tags");
 
   objectVariables.UnserializeFrom(
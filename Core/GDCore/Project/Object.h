@@ -15,6 +15,7 @@
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/NamedItemsIndex.h"
 namespace gd {
 class PropertyDescriptor;
 class Project;
@@ -77,12 +78,23 @@ class GD_CORE_API Object {
 
   /** \brief Change the name of the object with the name passed as parameter.
    */
-  void SetName(const gd::String& name_) { name = name_; };
+  void SetName(const gd::String& name_) {
+    name = name_;
+    namedItemsIndexLink.NameChanged();
+  };
 
   /** \brief Return the name of the object.
    */
   const gd::String& GetName() const { return name; };
 
+  /**
+   * \brief Return the link used to tell the index of the container owning
+   * the object that it was renamed (see gd::NamedItemsIndex).
+   */
+  const gd::NamedItemsIndexLink& GetNamedItemsIndexLink() const {
+    return namedItemsIndexLink;
+  }
+
   /** \brief Change the type of the object.
    */
   void SetType(const gd::String& type_) { type = type_; }
@@ -313,6 +325,7 @@ class GD_CORE_API Object {
 
  protected:
   gd::String name;  ///< The full name of the object
+  gd::NamedItemsIndexLink namedItemsIndexLink;
   gd::String type;  ///< Which type is the object. ( To test if we can do
                     ///< something reserved to some objects with it )
   std::map<gd::String, std::unique_ptr<gd::BehaviorContent>>
@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 #include "GDCore/String.h"
+#include "GDCore/Tools/NamedItemsIndex.h"
 namespace gd {
 class SerializerElement;
 }
@@ -54,7 +55,18 @@ class GD_CORE_API ObjectGroup {
 
   /** \brief Change group name
    */
-  inline void SetName(const gd::String& name_) { name = name_; };
+  inline void SetName(const gd::String& name_) {
+    name = name_;
+    namedItemsIndexLink.NameChanged();
+  };
+
+  /**
+   * \brief Return the link used to tell the index of the container owning
+   * the group that it was renamed (see gd::NamedItemsIndex).
+   */
+  const gd::NamedItemsIndexLink& GetNamedItemsIndexLink() const {
+    return namedItemsIndexLink;
+  }
 
   /**
    * \brief Get a vector with objects names.
@@ -76,6 +88,7 @@ class GD_CORE_API ObjectGroup {
  private:
   std::vector<gd::String> memberObjects;
   gd::String name;  ///< Group name
+  gd::NamedItemsIndexLink namedItemsIndexLink;
 };
 
 }  // namespace gd
@@ -14,11 +14,7 @@ namespace gd {
 ObjectGroup ObjectGroupsContainer::badGroup;
 
 bool ObjectGroupsContainer::Has(const gd::String& name) const {
-  auto i = std::find_if(
-      objectGroups.begin(),
-      objectGroups.end(),
-      [&name](const ObjectGroup& group) { return group.GetName() == name; });
-  return (i != objectGroups.end());
+  return index.GetPosition(objectGroups, name) != gd::String::npos;
 }
 
 ObjectGroup& ObjectGroupsContainer::Get(std::size_t index) {
@@ -34,34 +30,19 @@ const ObjectGroup& ObjectGroupsContainer::Get(std::size_t index) const {
 }
 
 ObjectGroup& ObjectGroupsContainer::Get(const gd::String& name) {
-  auto i = std::find_if(
-      objectGroups.begin(),
-      objectGroups.end(),
-      [&name](const ObjectGroup& group) { return group.GetName() == name; });
-  if (i != objectGroups.end()) return *i;
-
-  return badGroup;
+  return Get(index.GetPosition(objectGroups, name));
 }
 
 const ObjectGroup& ObjectGroupsContainer::Get(const gd::String& name) const {
-  auto i = std::find_if(
-      objectGroups.begin(),
-      objectGroups.end(),
-      [&name](const ObjectGroup& group) { return group.GetName() == name; });
-  if (i != objectGroups.end()) return *i;
-
-  return badGroup;
+  return Get(index.GetPosition(objectGroups, name));
 }
 
 ObjectGroup& ObjectGroupsContainer::Insert(const gd::ObjectGroup& group,
                                            std::size_t position) {
-  if (position < objectGroups.size()) {
-    objectGroups.insert(objectGroups.begin() + position, group);
-    return objectGroups[position];
-  } else {
-    objectGroups.push_back(group);
-    return objectGroups.back();
-  }
+  if (position > objectGroups.size()) position = objectGroups.size();
+  objectGroups.insert(objectGroups.begin() + position, group);
+  index.ItemInserted(objectGroups, position);
+  return objectGroups[position];
 }
 
 #if defined(GD_IDE_ONLY)
@@ -72,14 +53,11 @@ void ObjectGroupsContainer::Remove(const gd::String& name) {
                                       return group.GetName() == name;
                                     }),
                      objectGroups.end());
+  index.Invalidate();
 }
 
 std::size_t ObjectGroupsContainer::GetPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < objectGroups.size(); ++i) {
-    if (objectGroups[i].GetName() == name) return i;
-  }
-
-  return gd::String::npos;
+  return index.GetPosition(objectGroups, name);
 }
 
 ObjectGroup& ObjectGroupsContainer::InsertNew(const gd::String& name,
@@ -93,12 +71,8 @@ bool ObjectGroupsContainer::Rename(const gd::String& oldName,
                                    const gd::String& newName) {
   if (Has(newName)) return false;
 
-  auto i = std::find_if(objectGroups.begin(),
-                        objectGroups.end(),
-                        [&oldName](const ObjectGroup& group) {
-                          return group.GetName() == oldName;
-                        });
-  if (i != objectGroups.end()) i->SetName(newName);
+  std::size_t position = index.GetPosition(objectGroups, oldName);
+  if (position != gd::String::npos) objectGroups[position].SetName(newName);
 
   return true;
 }
@@ -109,6 +83,7 @@ void ObjectGroupsContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
 
   auto group = objectGroups[oldIndex];
   objectGroups.erase(objectGroups.begin() + oldIndex);
+  index.Invalidate();
   Insert(group, newIndex);
 }
 #endif
@@ -123,6 +98,7 @@ void ObjectGroupsContainer::SerializeTo(SerializerElement& element) const {
 
 void ObjectGroupsContainer::UnserializeFrom(const SerializerElement& element) {
   objectGroups.clear();
+  index.Invalidate();
   element.ConsiderAsArrayOf("group", "Groupe");
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
     SerializerElement& groupElement = element.GetChild(i);
@@ -130,6 +106,7 @@ void ObjectGroupsContainer::UnserializeFrom(const SerializerElement& element) {
 
     objectGroup.UnserializeFrom(groupElement);
     objectGroups.push_back(objectGroup);
+    index.ItemInserted(objectGroups, objectGroups.size() - 1);
   }
 }
 
@@ -9,6 +9,7 @@
 #include <vector>
 #include "GDCore/Project/ObjectGroup.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NamedItemsIndex.h"
 namespace gd {
 class SerializerElement;
 }
@@ -112,7 +113,10 @@ class GD_CORE_API ObjectGroupsContainer {
   /**
    * \brief Clear all groups of the container.
    */
-  inline void Clear() { objectGroups.clear(); }
+  inline void Clear() {
+    objectGroups.clear();
+    index.Invalidate();
+  }
   ///@}
 
   /** \name Saving and loading
@@ -174,6 +178,7 @@ class GD_CORE_API ObjectGroupsContainer {
 
  private:
   std::vector<ObjectGroup> objectGroups;
+  gd::NamedItemsIndex index;  ///< The positions of the groups by name.
   static ObjectGroup badGroup;
 };
 
@@ -5,6 +5,7 @@
  */
 #include "GDCore/Project/ObjectsContainer.h"
 #include <algorithm>
+#include <atomic>
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/Project.h"
@@ -12,7 +13,11 @@
 
 namespace gd {
 
-ObjectsContainer::ObjectsContainer() {}
+namespace {
+std::atomic<std::size_t> lastGeneration(0);
+}
+
+ObjectsContainer::ObjectsContainer() { UpdateGeneration(); }
 
 ObjectsContainer::~ObjectsContainer() {}
 
@@ -25,9 +30,13 @@ void ObjectsContainer::SerializeObjectsTo(SerializerElement& element) const {
 }
 #endif
 
+void ObjectsContainer::UpdateGeneration() { generation = ++lastGeneration; }
+
 void ObjectsContainer::UnserializeObjectsFrom(
     gd::Project& project, const SerializerElement& element) {
+  UpdateGeneration();
   initialObjects.clear();
+  objectsIndex.Invalidate();
   element.ConsiderAsArrayOf("object", "Objet");
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
     const SerializerElement& objectElement = element.GetChild(i);
@@ -46,19 +55,13 @@ void ObjectsContainer::UnserializeObjectsFrom(
 }
 
 bool ObjectsContainer::HasObjectNamed(const gd::String& name) const {
-  return (find_if(initialObjects.begin(),
-                  initialObjects.end(),
-                  bind2nd(gd::ObjectHasName(), name)) != initialObjects.end());
+  return objectsIndex.GetPosition(initialObjects, name) != gd::String::npos;
 }
 gd::Object& ObjectsContainer::GetObject(const gd::String& name) {
-  return *(*find_if(initialObjects.begin(),
-                    initialObjects.end(),
-                    bind2nd(gd::ObjectHasName(), name)));
+  return *initialObjects[objectsIndex.GetPosition(initialObjects, name)];
 }
 const gd::Object& ObjectsContainer::GetObject(const gd::String& name) const {
-  return *(*find_if(initialObjects.begin(),
-                    initialObjects.end(),
-                    bind2nd(gd::ObjectHasName(), name)));
+  return *initialObjects[objectsIndex.GetPosition(initialObjects, name)];
 }
 gd::Object& ObjectsContainer::GetObject(std::size_t index) {
   return *initialObjects[index];
@@ -67,10 +70,7 @@ const gd::Object& ObjectsContainer::GetObject(std::size_t index) const {
   return *initialObjects[index];
 }
 std::size_t ObjectsContainer::GetObjectPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < initialObjects.size(); ++i) {
-    if (initialObjects[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return objectsIndex.GetPosition(initialObjects, name);
 }
 std::size_t ObjectsContainer::GetObjectsCount() const {
   return initialObjects.size();
@@ -80,10 +80,12 @@ gd::Object& ObjectsContainer::InsertNewObject(gd::Project& project,
                                               const gd::String& objectType,
                                               const gd::String& name,
                                               std::size_t position) {
+  UpdateGeneration();
+  if (position > initialObjects.size()) position = initialObjects.size();
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
-      position < initialObjects.size() ? initialObjects.begin() + position
-                                       : initialObjects.end(),
+      initialObjects.begin() + position,
       project.GetCurrentPlatform().CreateObject(objectType, name))));
+  objectsIndex.ItemInserted(initialObjects, position);
 
   return newlyCreatedObject;
 }
@@ -91,10 +93,12 @@ gd::Object& ObjectsContainer::InsertNewObject(gd::Project& project,
 
 gd::Object& ObjectsContainer::InsertObject(const gd::Object& object,
                                            std::size_t position) {
+  UpdateGeneration();
+  if (position > initialObjects.size()) position = initialObjects.size();
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
-      position < initialObjects.size() ? initialObjects.begin() + position
-                                       : initialObjects.end(),
+      initialObjects.begin() + position,
       std::unique_ptr<gd::Object>(object.Clone()))));
+  objectsIndex.ItemInserted(initialObjects, position);
 
   return newlyCreatedObject;
 }
@@ -105,6 +109,8 @@ void ObjectsContainer::SwapObjects(std::size_t firstObjectIndex,
       secondObjectIndex >= initialObjects.size())
     return;
 
+  UpdateGeneration();
+  objectsIndex.Invalidate();
   std::iter_swap(initialObjects.begin() + firstObjectIndex,
                  initialObjects.begin() + secondObjectIndex);
 }
@@ -113,39 +119,41 @@ void ObjectsContainer::MoveObject(std::size_t oldIndex, std::size_t newIndex) {
   if (oldIndex >= initialObjects.size() || newIndex >= initialObjects.size())
     return;
 
+  UpdateGeneration();
+  objectsIndex.Invalidate();
   std::unique_ptr<gd::Object> object = std::move(initialObjects[oldIndex]);
   initialObjects.erase(initialObjects.begin() + oldIndex);
   initialObjects.insert(initialObjects.begin() + newIndex, std::move(object));
 }
 
 void ObjectsContainer::RemoveObject(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::Object> >::iterator objectIt =
-      find_if(initialObjects.begin(),
-              initialObjects.end(),
-              bind2nd(ObjectHasName(), name));
-  if (objectIt == initialObjects.end()) return;
+  std::size_t position = objectsIndex.GetPosition(initialObjects, name);
+  if (position == gd::String::npos) return;
 
-  initialObjects.erase(objectIt);
+  UpdateGeneration();
+  objectsIndex.ItemRemoved(initialObjects, position);
+  initialObjects.erase(initialObjects.begin() + position);
 }
 
 void ObjectsContainer::MoveObjectToAnotherContainer(
     const gd::String& name,
     gd::ObjectsContainer& newContainer,
     std::size_t newPosition) {
-  std::vector<std::unique_ptr<gd::Object> >::iterator objectIt =
-      find_if(initialObjects.begin(),
-              initialObjects.end(),
-              bind2nd(ObjectHasName(), name));
-  if (objectIt == initialObjects.end()) return;
+  std::size_t position = objectsIndex.GetPosition(initialObjects, name);
+  if (position == gd::String::npos) return;
 
-  std::unique_ptr<gd::Object> object = std::move(*objectIt);
-  initialObjects.erase(objectIt);
+  UpdateGeneration();
+  newContainer.UpdateGeneration();
+  objectsIndex.ItemRemoved(initialObjects, position);
+  std::unique_ptr<gd::Object> object = std::move(initialObjects[position]);
+  initialObjects.erase(initialObjects.begin() + position);
 
+  if (newPosition > newContainer.initialObjects.size())
+    newPosition = newContainer.initialObjects.size();
   newContainer.initialObjects.insert(
-      newPosition < newContainer.initialObjects.size()
-          ? newContainer.initialObjects.begin() + newPosition
-          : newContainer.initialObjects.end(),
-      std::move(object));
+      newContainer.initialObjects.begin() + newPosition, std::move(object));
+  newContainer.objectsIndex.ItemInserted(newContainer.initialObjects,
+                                         newPosition);
 }
 
 }  // namespace gd
@@ -9,6 +9,7 @@
 #include <vector>
 #include "GDCore/String.h"
 #include "GDCore/Project/ObjectGroupsContainer.h"
+#include "GDCore/Tools/NamedItemsIndex.h"
 namespace gd {
 class Object;
 class Project;
@@ -144,6 +145,8 @@ class GD_CORE_API ObjectsContainer {
    * Provide a raw access to the vector containing the objects
    */
   std::vector<std::unique_ptr<gd::Object> >& GetObjects() {
+    UpdateGeneration();
+    objectsIndex.Invalidate();
     return initialObjects;
   }
 
@@ -190,10 +193,40 @@ class GD_CORE_API ObjectsContainer {
 
   ///@}
 
+  /**
+   * \brief Return a number identifying the container and the current state of
+   * its list of objects.
+   *
+   * The generation is unique across all containers and is changed every time
+   * objects are inserted, removed or reordered by the methods of the
+   * container, or when the list of objects is given by GetObjects. This allows
+   * to cache things computed from the container (like parsed expressions, see
+   * gd::ExpressionParser2Cache).
+   *
+   * \warning Modifications done to the objects or to the groups through the
+   * references given by the container are not tracked: caches must only be
+   * used during an operation that can't modify the objects (like a code
+   * generation).
+   */
+  std::size_t GetGeneration() const { return generation; }
+
  protected:
+  /**
+   * \brief Give a new generation to the container. Must be called by
+   * derived classes modifying directly the list of objects.
+   */
+  void UpdateGeneration();
+
   std::vector<std::unique_ptr<gd::Object> >
       initialObjects;  ///< Objects contained.
+  gd::NamedItemsIndex objectsIndex;  ///< The positions of the objects by
+                                     ///< name. Must be invalidated by derived
+                                     ///< classes modifying directly the
+                                     ///< objects.
   gd::ObjectGroupsContainer objectGroups;
+
+ private:
+  std::size_t generation;  ///< See GetGeneration.
 };
 
 }  // namespace gd
@@ -171,27 +171,20 @@ bool Project::RemovePlatform(const gd::String& platformName) {
 #endif
 
 bool Project::HasLayoutNamed(const gd::String& name) const {
-  return (find_if(scenes.begin(),
-                  scenes.end(),
-                  bind2nd(gd::LayoutHasName(), name)) != scenes.end());
+  return scenesIndex.GetPosition(scenes, name) != gd::String::npos;
 }
 gd::Layout& Project::GetLayout(const gd::String& name) {
-  return *(*find_if(
-      scenes.begin(), scenes.end(), bind2nd(gd::LayoutHasName(), name)));
+  return *scenes[scenesIndex.GetPosition(scenes, name)];
 }
 const gd::Layout& Project::GetLayout(const gd::String& name) const {
-  return *(*find_if(
-      scenes.begin(), scenes.end(), bind2nd(gd::LayoutHasName(), name)));
+  return *scenes[scenesIndex.GetPosition(scenes, name)];
 }
 gd::Layout& Project::GetLayout(std::size_t index) { return *scenes[index]; }
 const gd::Layout& Project::GetLayout(std::size_t index) const {
   return *scenes[index];
 }
 std::size_t Project::GetLayoutPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < scenes.size(); ++i) {
-    if (scenes[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return scenesIndex.GetPosition(scenes, name);
 }
 std::size_t Project::GetLayoutsCount() const { return scenes.size(); }
 
@@ -200,16 +193,18 @@ void Project::SwapLayouts(std::size_t first, std::size_t second) {
   if (first >= scenes.size() || second >= scenes.size()) return;
 
   std::iter_swap(scenes.begin() + first, scenes.begin() + second);
+  scenesIndex.Invalidate();
 }
 #endif
 
 gd::Layout& Project::InsertNewLayout(const gd::String& name,
                                      std::size_t position) {
-  gd::Layout& newlyInsertedLayout = *(*(scenes.emplace(
-      position < scenes.size() ? scenes.begin() + position : scenes.end(),
-      new Layout())));
+  if (position > scenes.size()) position = scenes.size();
+  gd::Layout& newlyInsertedLayout =
+      *(*(scenes.emplace(scenes.begin() + position, new Layout())));
 
   newlyInsertedLayout.SetName(name);
+  scenesIndex.ItemInserted(scenes, position);
 #if defined(GD_IDE_ONLY)
   newlyInsertedLayout.UpdateBehaviorsSharedData(*this);
 #endif
@@ -219,9 +214,10 @@ gd::Layout& Project::InsertNewLayout(const gd::String& name,
 
 gd::Layout& Project::InsertLayout(const gd::Layout& layout,
                                   std::size_t position) {
-  gd::Layout& newlyInsertedLayout = *(*(scenes.emplace(
-      position < scenes.size() ? scenes.begin() + position : scenes.end(),
-      new Layout(layout))));
+  if (position > scenes.size()) position = scenes.size();
+  gd::Layout& newlyInsertedLayout =
+      *(*(scenes.emplace(scenes.begin() + position, new Layout(layout))));
+  scenesIndex.ItemInserted(scenes, position);
 
 #if defined(GD_IDE_ONLY)
   newlyInsertedLayout.UpdateBehaviorsSharedData(*this);
@@ -231,30 +227,24 @@ gd::Layout& Project::InsertLayout(const gd::Layout& layout,
 }
 
 void Project::RemoveLayout(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::Layout> >::iterator scene =
-      find_if(scenes.begin(), scenes.end(), bind2nd(gd::LayoutHasName(), name));
-  if (scene == scenes.end()) return;
+  std::size_t position = scenesIndex.GetPosition(scenes, name);
+  if (position == gd::String::npos) return;
 
-  scenes.erase(scene);
+  scenesIndex.ItemRemoved(scenes, position);
+  scenes.erase(scenes.begin() + position);
 }
 
 #if defined(GD_IDE_ONLY)
 bool Project::HasExternalEventsNamed(const gd::String& name) const {
-  return (find_if(externalEvents.begin(),
-                  externalEvents.end(),
-                  bind2nd(gd::ExternalEventsHasName(), name)) !=
-          externalEvents.end());
+  return externalEventsIndex.GetPosition(externalEvents, name) !=
+         gd::String::npos;
 }
 gd::ExternalEvents& Project::GetExternalEvents(const gd::String& name) {
-  return *(*find_if(externalEvents.begin(),
-                    externalEvents.end(),
-                    bind2nd(gd::ExternalEventsHasName(), name)));
+  return *externalEvents[externalEventsIndex.GetPosition(externalEvents, name)];
 }
 const gd::ExternalEvents& Project::GetExternalEvents(
     const gd::String& name) const {
-  return *(*find_if(externalEvents.begin(),
-                    externalEvents.end(),
-                    bind2nd(gd::ExternalEventsHasName(), name)));
+  return *externalEvents[externalEventsIndex.GetPosition(externalEvents, name)];
 }
 gd::ExternalEvents& Project::GetExternalEvents(std::size_t index) {
   return *externalEvents[index];
@@ -263,10 +253,7 @@ const gd::ExternalEvents& Project::GetExternalEvents(std::size_t index) const {
   return *externalEvents[index];
 }
 std::size_t Project::GetExternalEventsPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < externalEvents.size(); ++i) {
-    if (externalEvents[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return externalEventsIndex.GetPosition(externalEvents, name);
 }
 std::size_t Project::GetExternalEventsCount() const {
   return externalEvents.size();
@@ -274,34 +261,32 @@ std::size_t Project::GetExternalEventsCount() const {
 
 gd::ExternalEvents& Project::InsertNewExternalEvents(const gd::String& name,
                                                      std::size_t position) {
+  if (position > externalEvents.size()) position = externalEvents.size();
   gd::ExternalEvents& newlyInsertedExternalEvents = *(*(externalEvents.emplace(
-      position < externalEvents.size() ? externalEvents.begin() + position
-                                       : externalEvents.end(),
-      new gd::ExternalEvents())));
+      externalEvents.begin() + position, new gd::ExternalEvents())));
 
   newlyInsertedExternalEvents.SetName(name);
+  externalEventsIndex.ItemInserted(externalEvents, position);
 
   return newlyInsertedExternalEvents;
 }
 
 gd::ExternalEvents& Project::InsertExternalEvents(
     const gd::ExternalEvents& events, std::size_t position) {
+  if (position > externalEvents.size()) position = externalEvents.size();
   gd::ExternalEvents& newlyInsertedExternalEvents = *(*(externalEvents.emplace(
-      position < externalEvents.size() ? externalEvents.begin() + position
-                                       : externalEvents.end(),
-      new gd::ExternalEvents(events))));
+      externalEvents.begin() + position, new gd::ExternalEvents(events))));
+  externalEventsIndex.ItemInserted(externalEvents, position);
 
   return newlyInsertedExternalEvents;
 }
 
 void Project::RemoveExternalEvents(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::ExternalEvents> >::iterator events =
-      find_if(externalEvents.begin(),
-              externalEvents.end(),
-              bind2nd(gd::ExternalEventsHasName(), name));
-  if (events == externalEvents.end()) return;
+  std::size_t position = externalEventsIndex.GetPosition(externalEvents, name);
+  if (position == gd::String::npos) return;
 
-  externalEvents.erase(events);
+  externalEventsIndex.ItemRemoved(externalEvents, position);
+  externalEvents.erase(externalEvents.begin() + position);
 }
 
 void Project::SwapExternalEvents(std::size_t first, std::size_t second) {
@@ -309,6 +294,7 @@ void Project::SwapExternalEvents(std::size_t first, std::size_t second) {
 
   std::iter_swap(externalEvents.begin() + first,
                  externalEvents.begin() + second);
+  externalEventsIndex.Invalidate();
 }
 
 void Project::SwapExternalLayouts(std::size_t first, std::size_t second) {
@@ -317,24 +303,21 @@ void Project::SwapExternalLayouts(std::size_t first, std::size_t second) {
 
   std::iter_swap(externalLayouts.begin() + first,
                  externalLayouts.begin() + second);
+  externalLayoutsIndex.Invalidate();
 }
 #endif
 bool Project::HasExternalLayoutNamed(const gd::String& name) const {
-  return (find_if(externalLayouts.begin(),
-                  externalLayouts.end(),
-                  bind2nd(gd::ExternalLayoutHasName(), name)) !=
-          externalLayouts.end());
+  return externalLayoutsIndex.GetPosition(externalLayouts, name) !=
+         gd::String::npos;
 }
 gd::ExternalLayout& Project::GetExternalLayout(const gd::String& name) {
-  return *(*find_if(externalLayouts.begin(),
-                    externalLayouts.end(),
-                    bind2nd(gd::ExternalLayoutHasName(), name)));
+  return *externalLayouts[externalLayoutsIndex.GetPosition(externalLayouts,
+                                                           name)];
 }
 const gd::ExternalLayout& Project::GetExternalLayout(
     const gd::String& name) const {
-  return *(*find_if(externalLayouts.begin(),
-                    externalLayouts.end(),
-                    bind2nd(gd::ExternalLayoutHasName(), name)));
+  return *externalLayouts[externalLayoutsIndex.GetPosition(externalLayouts,
+                                                           name)];
 }
 gd::ExternalLayout& Project::GetExternalLayout(std::size_t index) {
   return *externalLayouts[index];
@@ -343,10 +326,7 @@ const gd::ExternalLayout& Project::GetExternalLayout(std::size_t index) const {
   return *externalLayouts[index];
 }
 std::size_t Project::GetExternalLayoutPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < externalLayouts.size(); ++i) {
-    if (externalLayouts[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return externalLayoutsIndex.GetPosition(externalLayouts, name);
 }
 
 std::size_t Project::GetExternalLayoutsCount() const {
@@ -355,33 +335,32 @@ std::size_t Project::GetExternalLayoutsCount() const {
 
 gd::ExternalLayout& Project::InsertNewExternalLayout(const gd::String& name,
                                                      std::size_t position) {
+  if (position > externalLayouts.size()) position = externalLayouts.size();
   gd::ExternalLayout& newlyInsertedExternalLayout = *(*(externalLayouts.emplace(
-      position < externalLayouts.size() ? externalLayouts.begin() + position
-                                        : externalLayouts.end(),
-      new gd::ExternalLayout())));
+      externalLayouts.begin() + position, new gd::ExternalLayout())));
 
   newlyInsertedExternalLayout.SetName(name);
+  externalLayoutsIndex.ItemInserted(externalLayouts, position);
   return newlyInsertedExternalLayout;
 }
 
 gd::ExternalLayout& Project::InsertExternalLayout(
     const gd::ExternalLayout& layout, std::size_t position) {
+  if (position > externalLayouts.size()) position = externalLayouts.size();
   gd::ExternalLayout& newlyInsertedExternalLayout = *(*(externalLayouts.emplace(
-      position < externalLayouts.size() ? externalLayouts.begin() + position
-                                        : externalLayouts.end(),
-      new gd::ExternalLayout(layout))));
+      externalLayouts.begin() + position, new gd::ExternalLayout(layout))));
+  externalLayoutsIndex.ItemInserted(externalLayouts, position);
 
   return newlyInsertedExternalLayout;
 }
 
 void Project::RemoveExternalLayout(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::ExternalLayout> >::iterator externalLayout =
-      find_if(externalLayouts.begin(),
-              externalLayouts.end(),
-              bind2nd(gd::ExternalLayoutHasName(), name));
-  if (externalLayout == externalLayouts.end()) return;
+  std::size_t position =
+      externalLayoutsIndex.GetPosition(externalLayouts, name);
+  if (position == gd::String::npos) return;
 
-  externalLayouts.erase(externalLayout);
+  externalLayoutsIndex.ItemRemoved(externalLayouts, position);
+  externalLayouts.erase(externalLayouts.begin() + position);
 }
 
 #if defined(GD_IDE_ONLY)
@@ -653,6 +632,7 @@ void Project::UnserializeFrom(const SerializerElement& element) {
   GetVariables().UnserializeFrom(element.GetChild("variables", 0, "Variables"));
 
   scenes.clear();
+  scenesIndex.Invalidate();
   const SerializerElement& layoutsElement =
       element.GetChild("layouts", 0, "Scenes");
   layoutsElement.ConsiderAsArrayOf("layout", "Scene");
@@ -666,6 +646,7 @@ void Project::UnserializeFrom(const SerializerElement& element) {
 
 #if defined(GD_IDE_ONLY)
   externalEvents.clear();
+  externalEventsIndex.Invalidate();
   const SerializerElement& externalEventsElement =
       element.GetChild("externalEvents", 0, "ExternalEvents");
   externalEventsElement.ConsiderAsArrayOf("externalEvents", "ExternalEvents");
@@ -699,6 +680,7 @@ void Project::UnserializeFrom(const SerializerElement& element) {
 #endif
 
   externalLayouts.clear();
+  externalLayoutsIndex.Invalidate();
   const SerializerElement& externalLayoutsElement =
       element.GetChild("externalLayouts", 0, "ExternalLayouts");
   externalLayoutsElement.ConsiderAsArrayOf("externalLayout", "ExternalLayout");
@@ -972,15 +954,20 @@ void Project::Init(const gd::Project& game) {
   imageManager = std::make_shared<ImageManager>(*game.imageManager);
   imageManager->SetResourcesManager(&resourcesManager);
 
+  UpdateGeneration();
   initialObjects = gd::Clone(game.initialObjects);
+  objectsIndex.Invalidate();
 
   scenes = gd::Clone(game.scenes);
+  scenesIndex.Invalidate();
 
 #if defined(GD_IDE_ONLY)
   externalEvents = gd::Clone(game.externalEvents);
+  externalEventsIndex.Invalidate();
 #endif
 
   externalLayouts = gd::Clone(game.externalLayouts);
+  externalLayoutsIndex.Invalidate();
 #if defined(GD_IDE_ONLY)
   eventsFunctionsExtensions = gd::Clone(game.eventsFunctionsExtensions);
 
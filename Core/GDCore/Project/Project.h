@@ -17,6 +17,7 @@
 #include "GDCore/Project/ResourcesManager.h"
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NamedItemsIndex.h"
 namespace gd {
 class Platform;
 class Layout;
@@ -945,9 +946,12 @@ class GD_CORE_API Project : public ObjectsContainer {
                                           ///< found on the layer at the scene
                                           ///< startup.
   std::vector<std::unique_ptr<gd::Layout> > scenes;  ///< List of all scenes
+  gd::NamedItemsIndex scenesIndex;  ///< The positions of the scenes by name.
   gd::VariablesContainer variables;  ///< Initial global variables
   std::vector<std::unique_ptr<gd::ExternalLayout> >
       externalLayouts;  ///< List of all externals layouts
+  gd::NamedItemsIndex externalLayoutsIndex;  ///< The positions of the
+                                             ///< external layouts by name.
 #if defined(GD_IDE_ONLY)
   std::vector<std::unique_ptr<gd::EventsFunctionsExtension> >
       eventsFunctionsExtensions;
@@ -979,6 +983,8 @@ class GD_CORE_API Project : public ObjectsContainer {
   gd::LoadingScreen loadingScreen;
   std::vector<std::unique_ptr<gd::ExternalEvents> >
       externalEvents;  ///< List of all externals events
+  gd::NamedItemsIndex externalEventsIndex;  ///< The positions of the
+                                            ///< external events by name.
   ExtensionProperties
       extensionProperties;              ///< The properties of the extensions.
   mutable unsigned int gdMajorVersion;  ///< The GD major version used the last
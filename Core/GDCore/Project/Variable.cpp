@@ -11,6 +11,7 @@
 
 #include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/MakeUnique.h"
 
 using namespace std;
 
@@ -63,13 +64,15 @@ void Variable::CastTo(const Type newType) {
   else if (newType == Type::Boolean)
     SetBool(GetBool());
   else if (newType == Type::Structure) {
+    childrenIndex.reset();
     children.clear();
 
     // Conversion is only possible for non primitive types
     if (type == Type::Array)
       for (auto i = childrenArray.begin(); i != childrenArray.end(); ++i)
-        children.insert(
-            std::make_pair(gd::String::From(i - childrenArray.begin()), (*i)));
+        InsertChild(children.end(),
+                    gd::String::From(i - childrenArray.begin()),
+                    std::move(*i));
 
     type = Type::Structure;
     // Free now unused memory
@@ -80,10 +83,11 @@ void Variable::CastTo(const Type newType) {
     // Conversion is only possible for non primitive types
     if (type == Type::Structure)
       for (auto i = children.begin(); i != children.end(); ++i)
-        childrenArray.push_back((*i).second);
+        childrenArray.push_back(std::move(i->second));
 
     type = Type::Array;
     // Free now unused memory
+    childrenIndex.reset();
     children.clear();
   }
 }
@@ -128,7 +132,33 @@ bool Variable::GetBool() const {
 }
 
 bool Variable::HasChild(const gd::String& name) const {
-  return type == Type::Structure && children.find(name) != children.end();
+  return type == Type::Structure && FindChild(name) != nullptr;
+}
+
+Variable* Variable::FindChild(const gd::String& name) const {
+  if (!childrenIndex) {
+    childrenIndex = gd::make_unique<ChildrenIndex>();
+    childrenIndex->reserve(children.size());
+    for (auto& it : children)
+      childrenIndex->emplace(&it.first, it.second.get());
+  }
+
+  auto it = childrenIndex->find(&name);
+  return it != childrenIndex->end() ? it->second : nullptr;
+}
+
+Variable& Variable::InsertChild(ChildrenMap::iterator hint,
+                                const gd::String& name,
+                                std::unique_ptr<Variable> child) const {
+  auto it = children.emplace_hint(hint, name, std::move(child));
+  if (childrenIndex) childrenIndex->emplace(&it->first, it->second.get());
+  return *it->second;
+}
+
+Variable::ChildrenMap::iterator Variable::EraseChild(
+    ChildrenMap::iterator it) {
+  if (childrenIndex) childrenIndex->erase(&it->first);
+  return children.erase(it);
 }
 
 /**
@@ -138,12 +168,12 @@ bool Variable::HasChild(const gd::String& name) const {
  * the specified child, an empty variable is returned.
  */
 Variable& Variable::GetChild(const gd::String& name) {
-  auto it = children.find(name);
-  if (it != children.end()) return *it->second;
+  Variable* child = FindChild(name);
+  if (child) return *child;
 
   type = Type::Structure;
-  children[name] = std::make_shared<gd::Variable>();
-  return *children[name];
+  return InsertChild(
+      children.lower_bound(name), name, gd::make_unique<gd::Variable>());
 }
 
 /**
@@ -153,17 +183,18 @@ Variable& Variable::GetChild(const gd::String& name) {
  * the specified child, an empty variable is returned.
  */
 const Variable& Variable::GetChild(const gd::String& name) const {
-  auto it = children.find(name);
-  if (it != children.end()) return *it->second;
+  Variable* child = FindChild(name);
+  if (child) return *child;
 
   type = Type::Structure;
-  children[name] = std::make_shared<gd::Variable>();
-  return *children[name];
+  return InsertChild(
+      children.lower_bound(name), name, gd::make_unique<gd::Variable>());
 }
 
 void Variable::RemoveChild(const gd::String& name) {
   if (type != Type::Structure) return;
-  children.erase(name);
+  auto it = children.find(name);
+  if (it != children.end()) EraseChild(it);
 }
 
 bool Variable::RenameChild(const gd::String& oldName,
@@ -171,8 +202,10 @@ bool Variable::RenameChild(const gd::String& oldName,
   if (type != Type::Structure || !HasChild(oldName) || HasChild(newName))
     return false;
 
-  children[newName] = children[oldName];
-  children.erase(oldName);
+  auto it = children.find(oldName);
+  std::unique_ptr<Variable> child = std::move(it->second);
+  EraseChild(it);
+  InsertChild(children.lower_bound(newName), newName, std::move(child));
 
   return true;
 }
@@ -180,7 +213,7 @@ bool Variable::RenameChild(const gd::String& oldName,
 Variable& Variable::GetAtIndex(const size_t index) {
   type = Type::Array;
   while (childrenArray.size() <= index)
-    childrenArray.push_back(std::make_shared<gd::Variable>());
+    childrenArray.push_back(gd::make_unique<gd::Variable>());
   return *childrenArray[index];
 };
 
@@ -216,7 +249,7 @@ void Variable::SerializeTo(SerializerElement& element) const {
   } else if (type == Type::Array) {
     SerializerElement& childrenElement = element.AddChild("children");
     childrenElement.ConsiderAsArrayOf("variable");
-    for (auto child : childrenArray) {
+    for (const auto& child : childrenArray) {
       child->SerializeTo(childrenElement.AddChild("variable"));
     }
   }
@@ -254,8 +287,11 @@ void Variable::UnserializeFrom(const SerializerElement& element) {
       const SerializerElement& childElement = childrenElement.GetChild(i);
       if (type == Type::Structure) {
         gd::String name = childElement.GetStringAttribute("name", "", "Name");
-        children[name] = std::make_shared<gd::Variable>();
-        children[name]->UnserializeFrom(childElement);
+        auto child = gd::make_unique<gd::Variable>();
+        child->UnserializeFrom(childElement);
+        auto it = children.lower_bound(name);
+        if (it != children.end() && it->first == name) it = EraseChild(it);
+        InsertChild(it, name, std::move(child));
       } else if (type == Type::Array)
         PushNew().UnserializeFrom(childElement);
     }
@@ -288,7 +324,7 @@ bool Variable::Contains(const gd::Variable& variableToSearch,
 void Variable::RemoveRecursively(const gd::Variable& variableToRemove) {
   for (auto it = children.begin(); it != children.end();) {
     if (it->second.get() == &variableToRemove)
-      it = children.erase(it);
+      it = EraseChild(it);
     else {
       it->second->RemoveRecursively(variableToRemove);
       it++;
@@ -296,7 +332,7 @@ void Variable::RemoveRecursively(const gd::Variable& variableToRemove) {
   }
   for (auto it = childrenArray.begin(); it != childrenArray.end();)
     if (it->get() == &variableToRemove)
-      childrenArray.erase(it);
+      it = childrenArray.erase(it);
     else {
       (*it)->RemoveRecursively(variableToRemove);
       it++;
@@ -324,12 +360,19 @@ Variable& Variable::operator=(const Variable& other) {
 }
 
 void Variable::CopyChildren(const gd::Variable& other) {
+  // The index is built when a child is first searched, so that copying
+  // variables (like when creating objects) is not slowed down by indexing
+  // children that may never be searched.
+  childrenIndex.reset();
   children.clear();
   for (auto& it : other.children) {
-    children[it.first] = std::make_shared<gd::Variable>(*it.second);
+    InsertChild(
+        children.end(), it.first, gd::make_unique<gd::Variable>(*it.second));
   }
-  for (auto child : other.childrenArray) {
-    childrenArray.push_back(std::make_shared<gd::Variable>(*child.get()));
+  childrenArray.clear();
+  childrenArray.reserve(other.childrenArray.size());
+  for (const auto& child : other.childrenArray) {
+    childrenArray.push_back(gd::make_unique<gd::Variable>(*child));
   }
 }
 }  // namespace gd
@@ -8,6 +8,7 @@
 #define GDCORE_VARIABLE_H
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/String.h"
@@ -21,6 +22,11 @@ namespace gd {
  * \brief Defines a variable which can be used by an object, a layout or a
  * project.
  *
+ * Children of a structure are stored sorted by name, and also indexed in a
+ * hash table (built when a child is first searched) to find them quickly.
+ * Children are owned by the variable and are not moved in memory while they
+ * exist.
+ *
  * \see gd::VariablesContainer
  *
  * \ingroup PlatformDefinition
@@ -174,6 +180,7 @@ class GD_CORE_API Variable {
    * \brief Remove all the children.
    */
   void ClearChildren() {
+    childrenIndex.reset();
     children.clear();
     childrenArray.clear();
   };
@@ -238,7 +245,7 @@ class GD_CORE_API Variable {
   /**
    * \brief Get the map containing all the children.
    */
-  const std::map<gd::String, std::shared_ptr<Variable>>& GetAllChildren()
+  const std::map<gd::String, std::unique_ptr<Variable>>& GetAllChildren()
       const {
     return children;
   }
@@ -290,7 +297,7 @@ class GD_CORE_API Variable {
   /**
    * \brief Get the vector containing all the children.
    */
-  const std::vector<std::shared_ptr<Variable>>& GetAllChildrenArray() const {
+  const std::vector<std::unique_ptr<Variable>>& GetAllChildrenArray() const {
     return childrenArray;
   }
   ///@}
@@ -322,13 +329,55 @@ class GD_CORE_API Variable {
    */
   static Type StringAsType(const gd::String& str);
 
+  /**
+   * \brief Hash and compare the names of the children in the index, which
+   * are pointers to the keys of the children map.
+   */
+  struct ChildNameHash {
+    std::size_t operator()(const gd::String* name) const {
+      return std::hash<gd::String>()(*name);
+    }
+  };
+  struct ChildNameEqual {
+    bool operator()(const gd::String* a, const gd::String* b) const {
+      return *a == *b;
+    }
+  };
+  typedef std::map<gd::String, std::unique_ptr<Variable>> ChildrenMap;
+  typedef std::unordered_map<const gd::String*,
+                             Variable*,
+                             ChildNameHash,
+                             ChildNameEqual>
+      ChildrenIndex;
+
+  /**
+   * \brief Return the child with the specified name, or nullptr if it does
+   * not exist. The index is built if it does not exist yet.
+   */
+  Variable* FindChild(const gd::String& name) const;
+
+  /**
+   * \brief Add a child (which must not exist) to the children and the index.
+   */
+  Variable& InsertChild(ChildrenMap::iterator hint,
+                        const gd::String& name,
+                        std::unique_ptr<Variable> child) const;
+
+  /**
+   * \brief Remove a child from the children and the index.
+   */
+  ChildrenMap::iterator EraseChild(ChildrenMap::iterator it);
+
   mutable Type type;
   mutable gd::String str;
   mutable double value;
   mutable bool boolVal;
-  mutable std::map<gd::String, std::shared_ptr<Variable>>
+  mutable ChildrenMap
       children;  ///< Children, when the variable is considered as a structure.
-  mutable std::vector<std::shared_ptr<Variable>>
+  mutable std::unique_ptr<ChildrenIndex>
+      childrenIndex;  ///< The children, indexed by name (or nullptr if no
+                      ///< child was searched since the last copy).
+  mutable std::vector<std::unique_ptr<Variable>>
       childrenArray;  ///< Children, when the variable is considered as an
                       ///< array.
 
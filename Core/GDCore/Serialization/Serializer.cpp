@@ -6,17 +6,23 @@
 
 #include "GDCore/Serialization/Serializer.h"
 
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Serialization/SerializerElement.h"
-#include "rapidjson/document.h"
-#include "rapidjson/prettywriter.h"
+#include "rapidjson/error/en.h"
+#include "rapidjson/ostreamwrapper.h"
 #include "rapidjson/rapidjson.h"
+#include "rapidjson/reader.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
 #if !defined(EMSCRIPTEN)
 #include "GDCore/TinyXml/tinyxml.h"
 #endif
@@ -111,120 +117,467 @@ gd::String Serializer::ToEscapedXMLString(const gd::String& str) {
 }
 
 namespace {
-void RapidJsonValueToElement(const Value& value,
-                             gd::SerializerElement& element) {
-  if (value.IsBool()) {
-    element.SetBoolValue(value.GetBool());
-  } else if (value.IsNumber()) {
-    if (value.IsInt64())
-      element.SetIntValue(value.GetInt64());
-    else if (value.IsUint64())
-      element.SetIntValue(value.GetUint64());
-    else if (value.IsInt())
-      element.SetValue(value.GetInt());
-    else if (value.IsUint())
-      element.SetValue(value.GetUint());
-    else if (value.IsDouble())
-      element.SetValue(value.GetDouble());
-    else if (value.IsFloat())
-      element.SetValue(value.GetFloat());
-  } else if (value.IsString()) {
-    element.SetStringValue(value.GetString());
-  } else if (value.IsObject()) {
-    for (auto& m : value.GetObject()) {
-      RapidJsonValueToElement(m.value, element.AddChild(m.name.GetString()));
-    }
-  } else if (value.IsArray()) {
+/**
+ * \brief Handler for rapidjson::Reader, building a gd::SerializerElement
+ * directly from the parsing events (without building a rapidjson::Document
+ * first).
+ */
+class SerializerElementReaderHandler
+    : public BaseReaderHandler<UTF8<>, SerializerElementReaderHandler> {
+ public:
+  SerializerElementReaderHandler(gd::SerializerElement& rootElement_)
+      : rootElement(rootElement_){};
+
+  bool Null() {
+    NextElement();
+    return true;
+  }
+  bool Bool(bool b) {
+    NextElement().SetBoolValue(b);
+    return true;
+  }
+  bool Int(int i) {
+    NextElement().SetIntValue(i);
+    return true;
+  }
+  bool Uint(unsigned u) {
+    NextElement().SetIntValue(u);
+    return true;
+  }
+  bool Int64(int64_t i) {
+    NextElement().SetIntValue(i);
+    return true;
+  }
+  bool Uint64(uint64_t u) {
+    NextElement().SetIntValue(u);
+    return true;
+  }
+  bool Double(double d) {
+    NextElement().SetDoubleValue(d);
+    return true;
+  }
+  bool String(const char* str, SizeType length, bool copy) {
+    value.Raw().assign(str, length);
+    NextElement().SetStringValue(value);
+    return true;
+  }
+  bool StartObject() {
+    parents.push_back(&NextElement());
+    return true;
+  }
+  bool Key(const char* str, SizeType length, bool copy) {
+    key.Raw().assign(str, length);
+    return true;
+  }
+  bool EndObject(SizeType memberCount) {
+    parents.pop_back();
+    return true;
+  }
+  bool StartArray() {
+    gd::SerializerElement& element = NextElement();
     element.ConsiderAsArray();
-    for (auto& m : value.GetArray()) {
-      RapidJsonValueToElement(m, element.AddChild(""));
-    }
+    parents.push_back(&element);
+    return true;
   }
+  bool EndArray(SizeType elementCount) {
+    parents.pop_back();
+    return true;
+  }
+
+ private:
+  /**
+   * \brief Return the element that the next value must be stored into: the
+   * root element, or a new child of the array or object being read.
+   */
+  gd::SerializerElement& NextElement() {
+    if (parents.empty()) return rootElement;
+
+    gd::SerializerElement& parent = *parents.back();
+    return parent.ConsideredAsArray() ? parent.AddChild("")
+                                      : parent.AddChild(key);
+  }
+
+  gd::SerializerElement& rootElement;
+  std::vector<gd::SerializerElement*>
+      parents;       ///< The objects and arrays being read.
+  gd::String key;    ///< The key of the next member of the object being read.
+  gd::String value;  ///< Buffer for the string values being read.
+};
+
+template <typename Writer>
+void WriteValue(const gd::SerializerValue& value, Writer& writer) {
+  if (value.IsBoolean())
+    writer.Bool(value.GetBool());
+  else if (value.IsDouble())
+    writer.Double(value.GetDouble());
+  else if (value.IsInt())
+    writer.Int(value.GetInt());
+  else if (value.IsString()) {
+    const std::string& str = value.GetRawString().Raw();
+    writer.String(str.c_str(), str.size());
+  } else
+    writer.Null();
+}
+
+template <typename Writer>
+void WriteKey(const gd::String& key, Writer& writer) {
+  writer.Key(key.Raw().c_str(), key.Raw().size());
 }
 
-void ElementToRapidJson(const gd::SerializerElement& element,
-                        Value& value,
-                        Document::AllocatorType& allocator) {
+/**
+ * \brief Write the element to the rapidjson writer, directly from the
+ * element tree.
+ */
+template <typename Writer>
+void WriteElement(const gd::SerializerElement& element, Writer& writer) {
   if (!element.IsValueUndefined()) {
-    const SerializerValue& serializerValue = element.GetValue();
-    // TODO: use GetRaw to avoid conversions
-    if (serializerValue.IsBoolean())
-      value.SetBool(serializerValue.GetBool());
-    else if (serializerValue.IsDouble())
-      value.SetDouble(serializerValue.GetDouble());
-    else if (serializerValue.IsInt())
-      value.SetInt(serializerValue.GetInt());
-    else if (serializerValue.IsString()) {
-      // This does a copy of the string, and measure the string length.
-      value.SetString(serializerValue.GetRawString().c_str(), allocator);
-    }
+    WriteValue(element.GetValue(), writer);
   } else if (element.ConsideredAsArray()) {
-    value.SetArray();
-
-    const auto& children = element.GetAllChildren();
-    value.Reserve(children.size(), allocator);
-
-    for (const auto& child : children) {
-      Value childValue;
-      ElementToRapidJson(*child.second, childValue, allocator);
-      value.PushBack(childValue, allocator);
-    }
+    writer.StartArray();
+    for (const auto& child : element.GetAllChildren())
+      WriteElement(*child.second, writer);
+    writer.EndArray();
   } else {
-    value.SetObject();
-
-    const auto& attributes = element.GetAllAttributes();
-    const auto& children = element.GetAllChildren();
-
-    for (const auto& attribute : attributes) {
-      Value name(attribute.first.c_str(),
-                 allocator);  // Copying the name is required.
-      Value childValue;
-      ElementToRapidJson(attribute.second, childValue, allocator);
-      value.AddMember(name, childValue, allocator);
+    writer.StartObject();
+    for (const auto& attribute : element.GetAllAttributes()) {
+      WriteKey(attribute.first, writer);
+      WriteValue(attribute.second, writer);
     }
-    for (const auto& child : children) {
-      Value name(child.first.c_str(),
-                 allocator);  // Copying the name is required.
-      Value childValue;
-      ElementToRapidJson(*child.second, childValue, allocator);
-      value.AddMember(name, childValue, allocator);
+    for (const auto& child : element.GetAllChildren()) {
+      WriteKey(child.first, writer);
+      WriteElement(*child.second, writer);
     }
+    writer.EndObject();
   }
 }
 }  // namespace
 
 SerializerElement Serializer::FromJSON(const char* json) {
   SerializerElement element;
-  size_t len = strlen(json);
-  if (len != 0) {
-    Document document;
-
-    // In-situ parsing, decode strings directly in the source string. Source
-    // must be string.
-    char buffer[len + 1];
-    memcpy(buffer, json, len + 1);
-    if (document.ParseInsitu(buffer).HasParseError()) {
-      std::cout << "TODO: error while parsing" << std::endl;
-      return element;
+  if (json[0] != '\0') {
+    SerializerElementReaderHandler handler(element);
+    StringStream stream(json);
+    Reader reader;
+    if (reader.Parse(stream, handler).IsError()) {
+      std::cout << "Error while parsing JSON: "
+                << GetParseError_En(reader.GetParseErrorCode()) << " (at "
+                << reader.GetErrorOffset() << ")" << std::endl;
+      element = SerializerElement();  // Don't return a partially read element.
     }
-
-    RapidJsonValueToElement(document, element);
   }
 
   return element;
 }
 
 gd::String Serializer::ToJSON(const SerializerElement& element) {
-  Document document;
-  Document::AllocatorType& allocator = document.GetAllocator();
-
-  ElementToRapidJson(element, document, allocator);
-
   StringBuffer buffer;
   Writer<StringBuffer> writer(buffer);
-  document.Accept(writer);
+  WriteElement(element, writer);
 
   return buffer.GetString();  // Temporary copy
 }
 
+void Serializer::ToJSON(const SerializerElement& element,
+                        std::ostream& stream) {
+  OStreamWrapper streamWrapper(stream);
+  Writer<OStreamWrapper> writer(streamWrapper);
+  WriteElement(element, writer);
+}
+
+namespace {
+const char binaryMagic[4] = {'G', 'D', 'B', 'N'};
+const std::uint64_t binaryVersion = 1;
+
+/**
+ * \brief The type of a value stored in binary data.
+ */
+enum BinaryTag {
+  BinaryNull = 0,
+  BinaryFalse = 1,
+  BinaryTrue = 2,
+  BinaryInt = 3,     ///< Followed by a zigzag encoded variable length integer.
+  BinaryDouble = 4,  ///< Followed by 8 bytes (little endian).
+  BinaryString = 5,  ///< Followed by the index of the string in the table.
+  BinaryObject = 6,  ///< Followed by the size in bytes (4 bytes), the number
+                     ///< of members and the members (key index and value).
+  BinaryArray = 7,   ///< Followed by the size in bytes (4 bytes), the number
+                     ///< of elements and the elements.
+};
+
+/**
+ * \brief Write a gd::SerializerElement to binary data.
+ */
+class BinaryWriter {
+ public:
+  BinaryWriter() : tooLarge(false){};
+
+  std::string Write(const gd::SerializerElement& element) {
+    WriteElement(element);
+    if (tooLarge) {
+      std::cout << "Error while writing binary data: an element is larger "
+                   "than 4GB"
+                << std::endl;
+      return "";
+    }
+
+    std::string output(binaryMagic, sizeof(binaryMagic));
+    WriteVarUint(output, binaryVersion);
+    WriteVarUint(output, strings.size());
+    for (auto string : strings) {
+      WriteVarUint(output, string->Raw().size());
+      output += string->Raw();
+    }
+    output += body;
+
+    return output;
+  }
+
+ private:
+  static void WriteVarUint(std::string& output, std::uint64_t value) {
+    while (value >= 0x80) {
+      output.push_back(static_cast<char>((value & 0x7F) | 0x80));
+      value >>= 7;
+    }
+    output.push_back(static_cast<char>(value));
+  }
+
+  std::uint64_t InternString(const gd::String& string) {
+    auto it = stringsIndex.find(string);
+    if (it != stringsIndex.end()) return it->second;
+
+    it = stringsIndex.insert(std::make_pair(string, strings.size())).first;
+    strings.push_back(&it->first);
+    return it->second;
+  }
+
+  void WriteValue(const gd::SerializerValue& value) {
+    if (value.IsBoolean()) {
+      body.push_back(value.GetBool() ? BinaryTrue : BinaryFalse);
+    } else if (value.IsDouble()) {
+      double doubleValue = value.GetDouble();
+      std::uint64_t bits;
+      memcpy(&bits, &doubleValue, sizeof(bits));
+
+      body.push_back(BinaryDouble);
+      for (int i = 0; i < 8; ++i)
+        body.push_back(static_cast<char>((bits >> (i * 8)) & 0xFF));
+    } else if (value.IsInt()) {
+      std::int64_t intValue = value.GetInt();
+
+      body.push_back(BinaryInt);
+      WriteVarUint(body,
+                   (static_cast<std::uint64_t>(intValue) << 1) ^
+                       static_cast<std::uint64_t>(intValue >> 63));
+    } else if (value.IsString()) {
+      body.push_back(BinaryString);
+      WriteVarUint(body, InternString(value.GetRawString()));
+    } else {
+      body.push_back(BinaryNull);
+    }
+  }
+
+  void WriteElement(const gd::SerializerElement& element) {
+    if (!element.IsValueUndefined()) {
+      WriteValue(element.GetValue());
+      return;
+    }
+
+    bool isArray = element.ConsideredAsArray();
+    body.push_back(isArray ? BinaryArray : BinaryObject);
+    std::size_t sizePosition = body.size();
+    body.append(4, '\0');  // Size in bytes, written when known.
+
+    const auto& attributes = element.GetAllAttributes();
+    const auto& children = element.GetAllChildren();
+    WriteVarUint(body, isArray ? children.size()
+                               : attributes.size() + children.size());
+    if (!isArray) {
+      for (const auto& attribute : attributes) {
+        WriteVarUint(body, InternString(attribute.first));
+        WriteValue(attribute.second);
+      }
+    }
+    for (const auto& child : children) {
+      if (!isArray) WriteVarUint(body, InternString(child.first));
+      WriteElement(*child.second);
+    }
+
+    std::uint64_t size = body.size() - sizePosition - 4;
+    if (size > 0xFFFFFFFF) tooLarge = true;
+    for (int i = 0; i < 4; ++i)
+      body[sizePosition + i] = static_cast<char>((size >> (i * 8)) & 0xFF);
+  }
+
+  std::string body;
+  std::unordered_map<gd::String, std::uint64_t> stringsIndex;
+  std::vector<const gd::String*> strings;  ///< The strings, by index.
+  bool tooLarge;  ///< True if the size of an element can't be stored.
+};
+
+/**
+ * \brief Read binary data written by BinaryWriter into a
+ * gd::SerializerElement. All reads are checked against the end of the data.
+ */
+class BinaryReader {
+ public:
+  BinaryReader(const char* data, std::size_t size)
+      : current(reinterpret_cast<const unsigned char*>(data)),
+        end(reinterpret_cast<const unsigned char*>(data) + size){};
+
+  bool Read(gd::SerializerElement& element) {
+    if (end - current < static_cast<std::ptrdiff_t>(sizeof(binaryMagic)) ||
+        memcmp(current, binaryMagic, sizeof(binaryMagic)) != 0)
+      return Error("not a binary serialized element");
+    current += sizeof(binaryMagic);
+
+    std::uint64_t version;
+    if (!ReadVarUint(version)) return false;
+    if (version != binaryVersion) return Error("unsupported version");
+
+    std::uint64_t stringsCount;
+    if (!ReadVarUint(stringsCount)) return false;
+    if (stringsCount > static_cast<std::uint64_t>(end - current))
+      return Error("invalid strings count");
+    strings.resize(stringsCount);
+    for (auto& string : strings) {
+      std::uint64_t length;
+      if (!ReadVarUint(length)) return false;
+      if (length > static_cast<std::uint64_t>(end - current))
+        return Error("unexpected end of data");
+
+      string.Raw().assign(reinterpret_cast<const char*>(current), length);
+      current += length;
+    }
+
+    return ReadElement(element);
+  }
+
+ private:
+  bool Error(const char* message) {
+    std::cout << "Error while reading binary data: " << message << std::endl;
+    return false;
+  }
+
+  bool ReadVarUint(std::uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (current == end) return Error("unexpected end of data");
+
+      unsigned char byte = *current++;
+      value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80)) return true;
+    }
+
+    return Error("invalid integer");
+  }
+
+  bool ReadString(const gd::String*& string) {
+    std::uint64_t index;
+    if (!ReadVarUint(index)) return false;
+    if (index >= strings.size()) return Error("invalid string index");
+
+    string = &strings[index];
+    return true;
+  }
+
+  bool ReadElement(gd::SerializerElement& element) {
+    if (current == end) return Error("unexpected end of data");
+
+    unsigned char tag = *current++;
+    switch (tag) {
+      case BinaryNull:
+        return true;
+      case BinaryFalse:
+      case BinaryTrue:
+        element.SetBoolValue(tag == BinaryTrue);
+        return true;
+      case BinaryInt: {
+        std::uint64_t value;
+        if (!ReadVarUint(value)) return false;
+
+        element.SetIntValue(static_cast<std::int64_t>(value >> 1) ^
+                            -static_cast<std::int64_t>(value & 1));
+        return true;
+      }
+      case BinaryDouble: {
+        if (end - current < 8) return Error("unexpected end of data");
+
+        std::uint64_t bits = 0;
+        for (int i = 0; i < 8; ++i)
+          bits |= static_cast<std::uint64_t>(current[i]) << (i * 8);
+        current += 8;
+
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        element.SetDoubleValue(value);
+        return true;
+      }
+      case BinaryString: {
+        const gd::String* string;
+        if (!ReadString(string)) return false;
+
+        element.SetStringValue(*string);
+        return true;
+      }
+      case BinaryObject:
+      case BinaryArray: {
+        if (end - current < 4) return Error("unexpected end of data");
+
+        std::uint64_t size = 0;
+        for (int i = 0; i < 4; ++i)
+          size |= static_cast<std::uint64_t>(current[i]) << (i * 8);
+        current += 4;
+        if (size > static_cast<std::uint64_t>(end - current))
+          return Error("unexpected end of data");
+        const unsigned char* containerEnd = current + size;
+
+        std::uint64_t count;
+        if (!ReadVarUint(count)) return false;
+        if (count > size) return Error("invalid children count");
+
+        if (tag == BinaryArray) {
+          element.ConsiderAsArray();
+          for (std::uint64_t i = 0; i < count; ++i)
+            if (!ReadElement(element.AddChild(""))) return false;
+        } else {
+          for (std::uint64_t i = 0; i < count; ++i) {
+            const gd::String* key;
+            if (!ReadString(key) || !ReadElement(element.AddChild(*key)))
+              return false;
+          }
+        }
+
+        if (current != containerEnd) return Error("invalid container size");
+        return true;
+      }
+      default:
+        return Error("unknown value type");
+    }
+  }
+
+  const unsigned char* current;
+  const unsigned char* end;
+  std::vector<gd::String> strings;  ///< The table of strings.
+};
+}  // namespace
+
+std::string Serializer::ToBinary(const SerializerElement& element) {
+  BinaryWriter writer;
+  return writer.Write(element);
+}
+
+SerializerElement Serializer::FromBinary(const char* data, std::size_t size) {
+  SerializerElement element;
+  BinaryReader reader(data, size);
+  if (!reader.Read(element))
+    element = SerializerElement();  // Don't return a partially read element.
+
+  return element;
+}
+
+bool Serializer::IsBinary(const char* data, std::size_t size) {
+  return size >= sizeof(binaryMagic) &&
+         memcmp(data, binaryMagic, sizeof(binaryMagic)) == 0;
+}
+
 }  // namespace gd
@@ -6,6 +6,7 @@
 
 #ifndef GDCORE_SERIALIZER_H
 #define GDCORE_SERIALIZER_H
+#include <ostream>
 #include <string>
 #include "GDCore/Serialization/SerializerElement.h"
 class TiXmlElement;
@@ -35,7 +36,9 @@ class GD_CORE_API Serializer {
 
   /** \name JSON serialization.
    * Convert a gd::SerializerElement from/to JSON.
-   * This uses RapidJSON for fast parsing and stringification.
+   * This uses RapidJSON for fast parsing and stringification. Elements are
+   * built directly from the parsing events and written directly from the
+   * element tree (no intermediate JSON document is built).
    * See https://github.com/miloyip/nativejson-benchmark
    */
   ///@{
@@ -44,6 +47,12 @@ class GD_CORE_API Serializer {
    */
   static gd::String ToJSON(const SerializerElement& element);
 
+  /**
+   * \brief Serialize a gd::SerializerElement to JSON, written directly to
+   * the specified stream (for example, a file stream).
+   */
+  static void ToJSON(const SerializerElement& element, std::ostream& stream);
+
   /**
    * \brief Construct a gd::SerializerElement from a JSON string.
    */
@@ -57,6 +66,53 @@ class GD_CORE_API Serializer {
   }
   ///@}
 
+  /** \name Binary serialization.
+   * Convert a gd::SerializerElement from/to a compact binary format.
+   *
+   * The format is versioned and starts with a table of all the strings (keys
+   * and string values are stored only once). Numbers are stored with their
+   * type (integers as variable length integers, doubles as 8 bytes) and
+   * objects and arrays are prefixed by their size in bytes and their number
+   * of children, so that a reader can skip them without decoding them.
+   *
+   * Unserializing the binary data gives the same element as unserializing
+   * the JSON of the original element (i.e: attributes are read as children).
+   *
+   * \note The format is not used yet by the exporters or to load projects.
+   */
+  ///@{
+  /**
+   * \brief Serialize a gd::SerializerElement to binary data.
+   *
+   * \note The size of objects and arrays is stored on 4 bytes: if one of them
+   * is larger than 4GB, an error is logged and an empty string is returned.
+   */
+  static std::string ToBinary(const SerializerElement& element);
+
+  /**
+   * \brief Construct a gd::SerializerElement from binary data created with
+   * ToBinary. The data is read directly from the given memory (for example,
+   * a memory mapped file).
+   *
+   * \note If the data is invalid, an empty element is returned.
+   */
+  static SerializerElement FromBinary(const char* data, std::size_t size);
+
+  /**
+   * \brief Construct a gd::SerializerElement from binary data created with
+   * ToBinary.
+   */
+  static SerializerElement FromBinary(const std::string& data) {
+    return FromBinary(data.data(), data.size());
+  }
+
+  /**
+   * \brief Return true if the data starts like binary data created with
+   * ToBinary.
+   */
+  static bool IsBinary(const char* data, std::size_t size);
+  ///@}
+
   virtual ~Serializer(){};
 
  private:
@@ -1,21 +1,37 @@
 #include "GDCore/Serialization/SerializerElement.h"
 
+#include <algorithm>
 #include <iostream>
 
+namespace {
+/**
+ * Number of children from which the positions of the children are indexed by
+ * name. Below this, a linear search is as fast and avoids the allocations of
+ * the index.
+ */
+const std::size_t minChildrenCountForIndex = 8;
+}  // namespace
+
 namespace gd {
 
 SerializerElement SerializerElement::nullElement;
 
-SerializerElement::SerializerElement() : valueUndefined(true), isArray(false) {}
+SerializerElement::SerializerElement()
+    : valueUndefined(true), childrenIndexed(false), isArray(false) {}
 
 SerializerElement::SerializerElement(const SerializerValue& value)
-    : valueUndefined(false), elementValue(value), isArray(false) {}
+    : valueUndefined(false),
+      elementValue(value),
+      childrenIndexed(false),
+      isArray(false) {}
 
 SerializerElement::~SerializerElement() {}
 
 const SerializerValue& SerializerElement::GetValue() const {
-  if (valueUndefined && attributes.find("value") != attributes.end())
-    return attributes.find("value")->second;
+  if (valueUndefined) {
+    auto it = attributes.find("value");
+    if (it != attributes.end()) return it->second;
+  }
 
   return elementValue;
 }
@@ -63,14 +79,16 @@ SerializerElement& SerializerElement::SetAttribute(const gd::String& name,
 bool SerializerElement::GetBoolAttribute(const gd::String& name,
                                          bool defaultValue,
                                          gd::String deprecatedName) const {
-  if (attributes.find(name) != attributes.end()) {
-    return attributes.find(name)->second.GetBool();
+  auto it = attributes.find(name);
+  if (it != attributes.end()) {
+    return it->second.GetBool();
   } else if (!deprecatedName.empty() &&
-             attributes.find(deprecatedName) != attributes.end()) {
-    return attributes.find(deprecatedName)->second.GetBool();
+             (it = attributes.find(deprecatedName)) != attributes.end()) {
+    return it->second.GetBool();
   } else {
-    if (HasChild(name, deprecatedName)) {
-      SerializerElement& child = GetChild(name, 0, deprecatedName);
+    std::size_t position = FindChildPosition(name, 0, deprecatedName, false);
+    if (position != gd::String::npos) {
+      const SerializerElement& child = *children[position].second;
       if (!child.IsValueUndefined()) {
         return child.GetValue().GetBool();
       }
@@ -86,14 +104,16 @@ gd::String SerializerElement::GetStringAttribute(  // TODO: Use const ref?
     const gd::String& name,
     gd::String defaultValue,
     gd::String deprecatedName) const {
-  if (attributes.find(name) != attributes.end())
-    return attributes.find(name)->second.GetString();
+  auto it = attributes.find(name);
+  if (it != attributes.end())
+    return it->second.GetString();
   else if (!deprecatedName.empty() &&
-           attributes.find(deprecatedName) != attributes.end())
-    return attributes.find(deprecatedName)->second.GetString();
+           (it = attributes.find(deprecatedName)) != attributes.end())
+    return it->second.GetString();
   else {
-    if (HasChild(name, deprecatedName)) {
-      SerializerElement& child = GetChild(name, 0, deprecatedName);
+    std::size_t position = FindChildPosition(name, 0, deprecatedName, false);
+    if (position != gd::String::npos) {
+      const SerializerElement& child = *children[position].second;
       if (!child.IsValueUndefined()) return child.GetValue().GetString();
     }
   }
@@ -104,14 +124,16 @@ gd::String SerializerElement::GetStringAttribute(  // TODO: Use const ref?
 int SerializerElement::GetIntAttribute(const gd::String& name,
                                        int defaultValue,
                                        gd::String deprecatedName) const {
-  if (attributes.find(name) != attributes.end())
-    return attributes.find(name)->second.GetInt();
+  auto it = attributes.find(name);
+  if (it != attributes.end())
+    return it->second.GetInt();
   else if (!deprecatedName.empty() &&
-           attributes.find(deprecatedName) != attributes.end())
-    return attributes.find(deprecatedName)->second.GetInt();
+           (it = attributes.find(deprecatedName)) != attributes.end())
+    return it->second.GetInt();
   else {
-    if (HasChild(name, deprecatedName)) {
-      SerializerElement& child = GetChild(name, 0, deprecatedName);
+    std::size_t position = FindChildPosition(name, 0, deprecatedName, false);
+    if (position != gd::String::npos) {
+      const SerializerElement& child = *children[position].second;
       if (!child.IsValueUndefined()) return child.GetValue().GetInt();
     }
   }
@@ -122,14 +144,16 @@ int SerializerElement::GetIntAttribute(const gd::String& name,
 double SerializerElement::GetDoubleAttribute(const gd::String& name,
                                              double defaultValue,
                                              gd::String deprecatedName) const {
-  if (attributes.find(name) != attributes.end())
-    return attributes.find(name)->second.GetDouble();
+  auto it = attributes.find(name);
+  if (it != attributes.end())
+    return it->second.GetDouble();
   else if (!deprecatedName.empty() &&
-           attributes.find(deprecatedName) != attributes.end())
-    return attributes.find(deprecatedName)->second.GetDouble();
+           (it = attributes.find(deprecatedName)) != attributes.end())
+    return it->second.GetDouble();
   else {
-    if (HasChild(name, deprecatedName)) {
-      SerializerElement& child = GetChild(name, 0, deprecatedName);
+    std::size_t position = FindChildPosition(name, 0, deprecatedName, false);
+    if (position != gd::String::npos) {
+      const SerializerElement& child = *children[position].second;
       if (!child.IsValueUndefined()) return child.GetValue().GetDouble();
     }
   }
@@ -154,17 +178,16 @@ SerializerElement& SerializerElement::AddChild(gd::String name) {
 
   // In case of children of objects, there can be only one child with
   // a given name.
-  // Note: searching for the existing children is O(number of children). This
-  // could be improved, but in practice has no visible impact on saving
-  // large projects.
-  if (!isArray && HasChild(name)) {
-    return GetChild(name);
+  if (!isArray) {
+    std::size_t position = FindChildPosition(name, 0, "", false);
+    if (position != gd::String::npos) return *children[position].second;
   }
 
-  std::shared_ptr<SerializerElement> newElement(new SerializerElement);
-  children.push_back(std::make_pair(name, newElement));
+  children.push_back(
+      std::make_pair(name, std::make_shared<SerializerElement>()));
+  IndexChild(children.size() - 1);
 
-  return *newElement;
+  return *children.back().second;
 }
 
 SerializerElement& SerializerElement::GetChild(std::size_t index) const {
@@ -175,19 +198,9 @@ SerializerElement& SerializerElement::GetChild(std::size_t index) const {
     return nullElement;
   }
 
-  std::size_t currentIndex = 0;
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
-
-    if (children[i].first == arrayOf || children[i].first.empty() ||
-        (!deprecatedArrayOf.empty() &&
-         children[i].first == deprecatedArrayOf)) {
-      if (index == currentIndex)
-        return *children[i].second;
-      else
-        currentIndex++;
-    }
-  }
+  std::size_t position =
+      FindChildPosition(arrayOf, index, deprecatedArrayOf, true);
+  if (position != gd::String::npos) return *children[position].second;
 
   std::cout << "ERROR: Requested out of bound child at index " << index
             << std::endl;
@@ -206,19 +219,9 @@ SerializerElement& SerializerElement::GetChild(
     }
   }
 
-  std::size_t currentIndex = 0;
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
-
-    if (children[i].first == name ||
-        (isArray && children[i].first.empty()) ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName)) {
-      if (index == currentIndex)
-        return *children[i].second;
-      else
-        currentIndex++;
-    }
-  }
+  std::size_t position =
+      FindChildPosition(name, index, deprecatedName, isArray);
+  if (position != gd::String::npos) return *children[position].second;
 
   std::cout << "Child " << name << " not found in SerializerElement::GetChild"
             << std::endl;
@@ -240,39 +243,138 @@ std::size_t SerializerElement::GetChildrenCount(
     deprecatedName = deprecatedArrayOf;
   }
 
-  std::size_t currentIndex = 0;
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
-
-    if (children[i].first == name ||
-        (isArray && children[i].first.empty()) ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName))
-      currentIndex++;
-  }
-
-  return currentIndex;
+  return CountChildren(name, deprecatedName, isArray);
 }
 
 bool SerializerElement::HasChild(const gd::String& name,
                                  gd::String deprecatedName) const {
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+  return FindChildPosition(name, 0, deprecatedName, false) !=
+         gd::String::npos;
+}
+
+void SerializerElement::RemoveChild(const gd::String& name) {
+  if (childrenIndexed && childrenIndex.find(name) == childrenIndex.end())
+    return;
+
+  std::size_t previousSize = children.size();
+  children.erase(
+      std::remove_if(children.begin(),
+                     children.end(),
+                     [&name](const std::pair<gd::String,
+                                             std::shared_ptr<SerializerElement>>&
+                                 child) { return child.first == name; }),
+      children.end());
+
+  if (children.size() != previousSize) RebuildChildrenIndex();
+}
+
+std::size_t SerializerElement::FindChildPosition(
+    const gd::String& name,
+    std::size_t index,
+    const gd::String& deprecatedName,
+    bool includeUnnamed) const {
+  if (!childrenIndexed) {
+    std::size_t currentIndex = 0;
+    for (size_t i = 0; i < children.size(); ++i) {
+      if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+
+      if (children[i].first == name ||
+          (includeUnnamed && children[i].first.empty()) ||
+          (!deprecatedName.empty() && children[i].first == deprecatedName)) {
+        if (index == currentIndex)
+          return i;
+        else
+          currentIndex++;
+      }
+    }
 
-    if (children[i].first == name ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName))
-      return true;
+    return gd::String::npos;
   }
 
-  return false;
+  const std::vector<std::size_t>* lists[3] = {
+      GetIndexedPositions(name),
+      includeUnnamed && !name.empty() ? GetIndexedPositions("") : nullptr,
+      !deprecatedName.empty() && deprecatedName != name
+          ? GetIndexedPositions(deprecatedName)
+          : nullptr};
+
+  // Usually, children are only matching a single name: the position is
+  // directly read from the index.
+  const std::vector<std::size_t>* singleList = nullptr;
+  std::size_t listsCount = 0;
+  for (auto list : lists) {
+    if (list) {
+      singleList = list;
+      listsCount++;
+    }
+  }
+  if (listsCount == 0) return gd::String::npos;
+  if (listsCount == 1)
+    return index < singleList->size() ? (*singleList)[index]
+                                      : gd::String::npos;
+
+  // Otherwise, merge the (sorted) lists of positions.
+  std::size_t cursors[3] = {0, 0, 0};
+  for (std::size_t currentIndex = 0;; ++currentIndex) {
+    int nextList = -1;
+    for (int i = 0; i < 3; ++i) {
+      if (lists[i] && cursors[i] < lists[i]->size() &&
+          (nextList == -1 || (*lists[i])[cursors[i]] <
+                                 (*lists[nextList])[cursors[nextList]]))
+        nextList = i;
+    }
+    if (nextList == -1) return gd::String::npos;
+    if (currentIndex == index) return (*lists[nextList])[cursors[nextList]];
+
+    cursors[nextList]++;
+  }
 }
 
-void SerializerElement::RemoveChild(const gd::String& name) {
-  for (size_t i = 0; i < children.size();) {
-    if (children[i].first == name)
-      children.erase(children.begin() + i);
-    else
-      ++i;
+std::size_t SerializerElement::CountChildren(const gd::String& name,
+                                             const gd::String& deprecatedName,
+                                             bool includeUnnamed) const {
+  if (!childrenIndexed) {
+    std::size_t count = 0;
+    for (size_t i = 0; i < children.size(); ++i) {
+      if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+
+      if (children[i].first == name ||
+          (includeUnnamed && children[i].first.empty()) ||
+          (!deprecatedName.empty() && children[i].first == deprecatedName))
+        count++;
+    }
+
+    return count;
+  }
+
+  const std::vector<std::size_t>* positions = GetIndexedPositions(name);
+  std::size_t count = positions ? positions->size() : 0;
+  if (includeUnnamed && !name.empty()) {
+    positions = GetIndexedPositions("");
+    if (positions) count += positions->size();
+  }
+  if (!deprecatedName.empty() && deprecatedName != name) {
+    positions = GetIndexedPositions(deprecatedName);
+    if (positions) count += positions->size();
   }
+
+  return count;
+}
+
+void SerializerElement::IndexChild(std::size_t position) {
+  if (childrenIndexed)
+    childrenIndex[children[position].first].push_back(position);
+  else if (children.size() >= minChildrenCountForIndex)
+    RebuildChildrenIndex();
+}
+
+void SerializerElement::RebuildChildrenIndex() {
+  childrenIndex.clear();
+  childrenIndexed = children.size() >= minChildrenCountForIndex;
+  if (!childrenIndexed) return;
+
+  for (std::size_t i = 0; i < children.size(); ++i)
+    childrenIndex[children[i].first].push_back(i);
 }
 
 void SerializerElement::Init(const gd::SerializerElement& other) {
@@ -281,13 +383,15 @@ void SerializerElement::Init(const gd::SerializerElement& other) {
   attributes = other.attributes;
 
   children.clear();
+  children.reserve(other.children.size());
   for (const auto& child : other.children) {
-    children.push_back(
-        std::make_pair(child.first,
-                       std::shared_ptr<SerializerElement>(
-                           new SerializerElement(*child.second))));
+    children.push_back(std::make_pair(
+        child.first, std::make_shared<SerializerElement>(*child.second)));
   }
 
+  childrenIndex = other.childrenIndex;
+  childrenIndexed = other.childrenIndexed;
+
   isArray = other.isArray;
   arrayOf = other.arrayOf;
   deprecatedArrayOf = other.deprecatedArrayOf;
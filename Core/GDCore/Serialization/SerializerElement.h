@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "GDCore/Serialization/SerializerValue.h"
 #include "GDCore/String.h"
@@ -27,9 +28,11 @@ namespace gd {
  * It also has specialized methods in GDevelop.js (see postjs.js) to be
  * converted to a JavaScript object.
  *
- * \note Children are stored with their order preserved, but this also
- * means that their access/removal is O(number of children). This class
- * is not appropriated for a use in game where fast access is required.
+ * \note Children are stored with their order preserved. When an element has
+ * more than a few children, an index of the children positions by name is
+ * maintained so that access by name (or by index, for arrays) is O(1).
+ * Removal is still O(number of children). This class is not appropriated
+ * for a use in game where fast access is required.
  *
  * \see gd::Serializer
  */
@@ -59,6 +62,16 @@ class GD_CORE_API SerializerElement {
     return *this;
   }
 
+  /**
+   * Move constructor (avoid copying the whole tree of children).
+   */
+  SerializerElement(gd::SerializerElement &&object) = default;
+
+  /**
+   * Move assignment operator (avoid copying the whole tree of children).
+   */
+  SerializerElement &operator=(gd::SerializerElement &&object) = default;
+
   virtual ~SerializerElement();
 
   /** \name Value
@@ -412,7 +425,6 @@ class GD_CORE_API SerializerElement {
 
   /**
    * \brief Return true if the specified child exists.
-   * \note Complexity is O(number of children).
    * \param name The name of the child to find.
    */
   bool HasChild(const gd::String &name, gd::String deprecatedName = "") const;
@@ -442,12 +454,55 @@ class GD_CORE_API SerializerElement {
    */
   void Init(const gd::SerializerElement& other);
 
+  /**
+   * \brief Return the position, in the children vector, of the index-th child
+   * named \a name (or \a deprecatedName, or being unnamed if \a
+   * includeUnnamed is true). Return gd::String::npos if not found.
+   */
+  std::size_t FindChildPosition(const gd::String& name,
+                                std::size_t index,
+                                const gd::String& deprecatedName,
+                                bool includeUnnamed) const;
+
+  /**
+   * \brief Return the number of children named \a name (or \a
+   * deprecatedName, or being unnamed if \a includeUnnamed is true).
+   */
+  std::size_t CountChildren(const gd::String& name,
+                            const gd::String& deprecatedName,
+                            bool includeUnnamed) const;
+
+  /**
+   * \brief Add the child at the given position in the children vector to the
+   * index, building the whole index if the element just got enough children.
+   */
+  void IndexChild(std::size_t position);
+
+  /**
+   * \brief (Re)build the index of the children positions from scratch.
+   */
+  void RebuildChildrenIndex();
+
+  /**
+   * \brief Get the positions of the children having the specified name, or
+   * nullptr if there is none. The index must have been built.
+   */
+  const std::vector<std::size_t>* GetIndexedPositions(
+      const gd::String& name) const {
+    auto it = childrenIndex.find(name);
+    return it != childrenIndex.end() ? &it->second : nullptr;
+  }
+
   bool valueUndefined;  ///< If true, the element does not have a value.
   SerializerValue elementValue;
 
   std::map<gd::String, SerializerValue> attributes;
   std::vector<std::pair<gd::String, std::shared_ptr<SerializerElement> > >
       children;
+  std::unordered_map<gd::String, std::vector<std::size_t> >
+      childrenIndex;  ///< Positions of the children in \a children, by name.
+                      ///< Only built when there are enough children.
+  bool childrenIndexed;  ///< true if childrenIndex is built and up-to-date.
   mutable bool isArray;        ///< true if element is considered as an array
   mutable gd::String arrayOf;  ///< The name of the children (was useful for XML
                                ///< parsed elements).
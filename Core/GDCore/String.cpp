@@ -7,6 +7,7 @@
 #include "GDCore/String.h"
 
 #include <string.h>
+#include <algorithm>
 
 #include <SFML/System/String.hpp>
 #include "GDCore/CommonTools.h"
@@ -17,29 +18,30 @@ namespace gd
 
 constexpr String::size_type String::npos;
 
-String::String() : m_string()
+String::String() : m_string(), m_length(0)
 {
 
 }
 
-String::String(const char *characters) : m_string()
+String::String(const char *characters) : m_string(), m_length(npos)
 {
     *this = characters;
 }
 
-String::String(const sf::String &string) : m_string()
+String::String(const sf::String &string) : m_string(), m_length(npos)
 {
     *this = string;
 }
 
-String::String(const std::u32string &string) : m_string()
+String::String(const std::u32string &string) : m_string(), m_length(npos)
 {
     *this = string;
 }
 
 String& String::operator=(const char *characters)
 {
-    m_string = std::string(characters);
+    m_string = characters;
+    SetCachedLength(npos);
     return *this;
 }
 
@@ -59,6 +61,7 @@ String& String::operator=(const sf::String &string)
     }
 
     m_string.shrink_to_fit();
+    SetCachedLength(npos);
 
     return *this;
 }
@@ -79,13 +82,53 @@ String& String::operator=(const std::u32string &string)
     }
 
     m_string.shrink_to_fit();
+    SetCachedLength(npos);
 
     return *this;
 }
 
 String::size_type String::size() const
 {
-    return std::distance(begin(), end());
+    size_type length = GetCachedLength();
+    if (length == npos)
+    {
+        //Count all the bytes that are not continuation bytes (10xxxxxx), i.e:
+        //the first byte of each character.
+        length = 0;
+        for (char byte : m_string)
+            length += (static_cast<unsigned char>(byte) & 0xC0) != 0x80;
+
+        SetCachedLength(length);
+    }
+
+    return length;
+}
+
+std::string::size_type String::GetByteOffset( String::size_type position ) const
+{
+    if (IsASCII())
+        return std::min(position, m_string.size());
+
+    const_iterator it = begin();
+    while (position > 0 && it != end())
+    {
+        ++it;
+        --position;
+    }
+
+    return std::distance(m_string.begin(), it.base());
+}
+
+String::size_type String::GetPosition( std::string::size_type byteOffset ) const
+{
+    if (IsASCII())
+        return byteOffset;
+
+    size_type position = 0;
+    for (std::string::size_type i = 0; i < byteOffset; ++i)
+        position += (static_cast<unsigned char>(m_string[i]) & 0xC0) != 0x80;
+
+    return position;
 }
 
 String::iterator String::begin()
@@ -233,12 +276,16 @@ String& String::ReplaceInvalid( value_type replacement )
     ::utf8::replace_invalid(m_string.begin(), m_string.end(), std::back_inserter(validStr), replacement);
 
     m_string = validStr;
+    SetCachedLength(npos);
 
     return *this;
 }
 
 String::value_type String::operator[]( const String::size_type position ) const
 {
+    if (IsASCII())
+        return static_cast<unsigned char>(m_string[position]);
+
     const_iterator it = begin();
     std::advance(it, position);
     return *it;
@@ -246,6 +293,10 @@ String::value_type String::operator[]( const String::size_type position ) const
 
 String& String::operator+=( const String &other )
 {
+    size_type length = GetCachedLength();
+    size_type otherLength = other.GetCachedLength();
+    SetCachedLength(length != npos && otherLength != npos ? length + otherLength : npos);
+
     m_string += other.m_string;
     return *this;
 }
@@ -253,6 +304,7 @@ String& String::operator+=( const String &other )
 String& String::operator+=( const char *other )
 {
     m_string += other;
+    SetCachedLength(npos);
     return *this;
 }
 
@@ -264,21 +316,28 @@ String& String::operator+=( value_type character )
 
 void String::push_back( String::value_type character )
 {
+    size_type length = GetCachedLength();
+    SetCachedLength(length != npos ? length + 1 : npos);
+
     ::utf8::unchecked::append(character, std::back_inserter(m_string));
 }
 
 void String::pop_back()
 {
+    size_type length = GetCachedLength();
+    SetCachedLength(length != npos && length > 0 ? length - 1 : npos);
+
     m_string.erase((--end()).base(), end().base());
 }
 
 String& String::insert( size_type pos, const String &str )
 {
-    iterator it = begin();
-    std::advance(it, pos);
+    if(pos > size())
+        throw std::out_of_range("[gd::String::insert] starting pos greater than size");
 
-    //Use the real position as bytes using the std::string::iterators
-    m_string.insert( std::distance(m_string.begin(), it.base()), str.m_string );
+    //Use the real position as bytes
+    m_string.insert( GetByteOffset(pos), str.m_string );
+    SetCachedLength(npos);
 
     return *this;
 }
@@ -286,6 +345,7 @@ String& String::insert( size_type pos, const String &str )
 String& String::replace( iterator i1, iterator i2, const String &str )
 {
     m_string.replace(i1.base(), i2.base(), str.m_string);
+    SetCachedLength(npos);
 
     return *this;
 }
@@ -295,26 +355,24 @@ String& String::replace( String::size_type pos, String::size_type len, const Str
     if(pos > size())
         throw std::out_of_range("[gd::String::replace] starting pos greater than size");
 
-    iterator i1 = begin();
-    std::advance( i1, pos );
+    std::string::size_type start = GetByteOffset(pos);
+    std::string::size_type end = len >= size() - pos ? m_string.size() : GetByteOffset(pos + len);
 
-    iterator i2 = i1;
-    while(i2 != end() && len > 0) //Increment "len" times and stop if end() is reached
-    {
-        ++i2;
-        --len;
-    }
+    m_string.replace(start, end - start, str.m_string);
+    SetCachedLength(npos);
 
-    return replace( i1, i2, str );
+    return *this;
 }
 
 String::iterator String::erase( String::iterator first, String::iterator last )
 {
+    SetCachedLength(npos);
     return iterator( m_string.erase( first.base(), last.base() ) );
 }
 
 String::iterator String::erase( String::iterator p )
 {
+    SetCachedLength(npos);
     return iterator( m_string.erase( p.base() ) );
 }
 
@@ -323,35 +381,33 @@ void String::erase( String::size_type pos, String::size_type len )
     if(pos > size())
         throw std::out_of_range("[gd::String::erase] starting pos greater than size");
 
-    iterator i1 = begin();
-    std::advance(i1, pos);
-
-    iterator i2 = i1;
-    while(i2 != end() && len != 0) //Increment "len" times and stop if end() is reached
-    {
-        ++i2;
-        len--;
-    }
+    std::string::size_type start = GetByteOffset(pos);
+    std::string::size_type end = len >= size() - pos ? m_string.size() : GetByteOffset(pos + len);
 
-    erase( i1, i2 );
+    m_string.erase(start, end - start);
+    SetCachedLength(npos);
 }
 
 std::vector<String> String::Split( String::value_type delimiter ) const
 {
-    std::vector<String> splittedStrings(1);
-    String::const_iterator it = begin();
+    //As UTF8 is self-synchronizing, the delimiter can be searched directly
+    //in the raw std::string.
+    std::string rawDelimiter;
+    ::utf8::unchecked::append(delimiter, std::back_inserter(rawDelimiter));
 
-    for(; it != end(); ++it)
+    std::vector<String> splittedStrings;
+    std::string::size_type start = 0;
+    while (true)
     {
-        String::value_type codepoint = *it;
-        if(codepoint == delimiter) //It's the delimiter, insert a new String in the vector
-        {
-            splittedStrings.emplace_back();
-        }
-        else
-        {
-            splittedStrings.back().push_back(codepoint);
-        }
+        std::string::size_type end = m_string.find(rawDelimiter, start);
+
+        splittedStrings.emplace_back();
+        splittedStrings.back().m_string.assign(m_string, start,
+            end != std::string::npos ? end - start : std::string::npos);
+        splittedStrings.back().SetCachedLength(npos);
+
+        if (end == std::string::npos) break;
+        start = end + rawDelimiter.size();
     }
 
     return splittedStrings;
@@ -388,19 +444,25 @@ String String::LowerCase() const
 
 String String::FindAndReplace(String search, String replacement, bool all) const
 {
-    gd::String result(*this);
+    if (search.empty())
+        return *this;
 
-    size_type pos, lastPos = 0;
-    do {
-        pos = result.find(search, lastPos);
-        lastPos = pos;
-        if (pos != npos)
-        {
-            result.replace(pos, search.size(), replacement);
-            lastPos += replacement.size();
-        }
+    //As UTF8 is self-synchronizing, the search can be done directly
+    //in the raw std::string.
+    gd::String result;
+    result.m_string.reserve(m_string.size());
 
-    } while(lastPos != npos && all);
+    std::string::size_type pos, lastPos = 0;
+    while ((pos = m_string.find(search.m_string, lastPos)) != std::string::npos)
+    {
+        result.m_string.append(m_string, lastPos, pos - lastPos);
+        result.m_string += replacement.m_string;
+        lastPos = pos + search.m_string.size();
+
+        if (!all) break;
+    }
+    result.m_string.append(m_string, lastPos, std::string::npos);
+    result.SetCachedLength(npos);
 
     return result;
 }
@@ -419,6 +481,7 @@ String& String::Normalize(String::NormForm form)
         newStr = utf8proc_NFKC((unsigned char*)m_string.c_str());
 
     m_string = (char*)newStr;
+    SetCachedLength(npos);
 
     free(newStr);
 
@@ -427,55 +490,36 @@ String& String::Normalize(String::NormForm form)
 
 String String::substr( String::size_type start, String::size_type length ) const
 {
-    String str;
+    if(start > size())
+        throw std::out_of_range("[gd::String::substr] starting pos greater than size");
 
-    const_iterator startIt = begin();
-    while(start > 0 && startIt != end())
+    String str;
+    if (length >= size() - start)
     {
-        ++startIt;
-        --start;
+        str.m_string.assign( m_string, GetByteOffset(start), std::string::npos );
+        str.SetCachedLength( size() - start );
     }
-    if(start > 0) //We reach the end of the string before the start position
-        throw std::out_of_range("[gd::String::substr] starting pos greater than size");
-
-    const_iterator endIt = startIt;
-    while(length > 0 && endIt != end())
+    else
     {
-        ++endIt;
-        --length;
+        std::string::size_type startOffset = GetByteOffset(start);
+        str.m_string.assign( m_string, startOffset, GetByteOffset(start + length) - startOffset );
+        str.SetCachedLength( length );
     }
 
-    str.m_string = std::string( startIt.base(), endIt.base() );
-
     return str;
 }
 
 String::size_type String::find( const String &search, String::size_type pos ) const
 {
-    const_iterator it = begin();
-
-    //Move to pos
-    if(pos < size())
-        std::advance( it, pos );
-    else
+    if(pos >= size())
         return npos;
 
-    //Use the standard std::string to find a string (using their internal std::strings).
-    //Use the raw std::string iterator to get the offset as a **byte** count for the starting
-    //position.
-    std::string::size_type findPos =
-        m_string.find( search.m_string, std::distance( m_string.begin(), it.base() ) );
+    //Use the standard std::string to find a string (using their internal std::strings),
+    //with the offset as a **byte** count for the starting position.
+    std::string::size_type findPos = m_string.find( search.m_string, GetByteOffset(pos) );
 
-    if( findPos != std::string::npos )
-    {
-        //Create a String::iterator from the std::string::iterator pointing to the find result.
-        const_iterator findPosIt( m_string.begin() + findPos );
-
-        //Return the distance in **characters** count (that's why we need a String::iterator).
-        return std::distance( begin(), findPosIt );
-    }
-    else
-        return npos;
+    //Return the position in **characters** count.
+    return findPos != std::string::npos ? GetPosition(findPos) : npos;
 }
 
 String::size_type String::find( const char *search, String::size_type pos ) const
@@ -485,40 +529,28 @@ String::size_type String::find( const char *search, String::size_type pos ) cons
 
 String::size_type String::find( const String::value_type search, String::size_type pos ) const
 {
+    if( search < 0x80 ) //ASCII characters can be searched directly in the std::string
+    {
+        if(pos >= size())
+            return npos;
+
+        std::string::size_type findPos = m_string.find( static_cast<char>(search), GetByteOffset(pos) );
+        return findPos != std::string::npos ? GetPosition(findPos) : npos;
+    }
+
     return find( String( std::u32string( 1, search ) ), pos );
 }
 
 String::size_type String::rfind( const String &search, String::size_type pos ) const
 {
-    //Move to pos + 1 (we will then get the last byte of the character at pos)
-    const_iterator it = begin();
-    std::string::const_iterator baseIt;
-    if( pos < size() ) //little optimization by testing npos directly (avoid calculating size())
-    {
-        std::advance( it, pos + 1 );
-        baseIt = it.base();
-        --baseIt; //Decrement the std::string::iterator by one because we need
-        //it to point to the last byte of the character at pos
-    }
-
     //The last character is included, so we need to put the position
     //of the last byte of the character at the position "pos"
     std::string::size_type findPos = m_string.rfind( search.m_string,
-        pos < size() ? std::distance( m_string.begin(), baseIt ) : std::string::npos
+        pos < size() ? GetByteOffset(pos + 1) - 1 : std::string::npos
         );
 
-    if( findPos != std::string::npos )
-    {
-        //Create a String::iterator to the find position to be able to get the real
-        //distance as characters count (it would be a distance as bytes count
-        //with a std::string::iterator)
-        const_iterator findPosIt( m_string.begin() + findPos );
-
-        //Return the distance (which is a distance as characters count)
-        return std::distance( begin(), findPosIt );
-    }
-    else
-        return npos;
+    //Return the position as characters count
+    return findPos != std::string::npos ? GetPosition(findPos) : npos;
 }
 
 String::size_type String::rfind( const char *search, String::size_type pos ) const
@@ -555,11 +587,19 @@ namespace priv
 
 String::size_type String::find_first_of( const String &match, size_type startPos ) const
 {
+    //Non ASCII characters of match can't be found in an ASCII string, so
+    //comparing bytes is enough.
+    if (IsASCII())
+        return m_string.find_first_of(match.m_string, startPos);
+
     return priv::find_first_of(*this, match, startPos, false);
 }
 
 String::size_type String::find_first_not_of( const String &match, size_type startPos ) const
 {
+    if (IsASCII())
+        return m_string.find_first_not_of(match.m_string, startPos);
+
     return priv::find_first_of(*this, match, startPos, true);
 }
 
@@ -589,11 +629,17 @@ namespace priv
 
 String::size_type String::find_last_of( const String &match, size_type endPos ) const
 {
+    if (IsASCII())
+        return m_string.find_last_of(match.m_string, endPos);
+
     return priv::find_last_of( *this, match, endPos, false );
 }
 
 String::size_type String::find_last_not_of( const String &match, size_type endPos ) const
 {
+    if (IsASCII())
+        return m_string.find_last_not_of(match.m_string, endPos);
+
     return priv::find_last_of( *this, match, endPos, true );
 }
 
@@ -7,6 +7,7 @@
 #ifndef GDCORE_UTF8_STRING_H
 #define GDCORE_UTF8_STRING_H
 
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -126,6 +127,13 @@ public:
      */
     String(const sf::String &string);
 
+    String(const String &other) : m_string(other.m_string), m_length(other.GetCachedLength()) {};
+
+    String(String &&other) noexcept : m_string(std::move(other.m_string)), m_length(other.GetCachedLength())
+    {
+        other.SetCachedLength(npos);
+    };
+
 /**
  * \}
  */
@@ -150,6 +158,21 @@ public:
 
     String& operator=(const std::u32string &string);
 
+    String& operator=(const String &other)
+    {
+        m_string = other.m_string;
+        SetCachedLength(other.GetCachedLength());
+        return *this;
+    }
+
+    String& operator=(String &&other) noexcept
+    {
+        m_string = std::move(other.m_string);
+        SetCachedLength(other.GetCachedLength());
+        other.SetCachedLength(npos);
+        return *this;
+    }
+
 /**
  * \}
  */
@@ -166,6 +189,9 @@ public:
 
     /**
      * \brief Returns the string's length.
+     *
+     * The length is computed on the first call (linear on the string size) and
+     * then cached until the string is modified.
      */
     size_type size() const;
 
@@ -179,7 +205,7 @@ public:
      *
      * **Iterators :** Obviously, all iterators are invalidated.
      */
-    void clear() { m_string.clear(); }
+    void clear() { m_string.clear(); SetCachedLength(0); }
 
     void reserve(gd::String::size_type size) { m_string.reserve(size); }
 
@@ -368,16 +394,21 @@ public:
 
     /**
      * \brief Returns the code point at the specified position
-     * \warning This operator has a linear complexity on the character's
-     * position. You should avoid to use it in a loop and use the iterators
-     * provided by this class instead.
+     * \warning This operator is constant time if the string is only made of
+     * ASCII characters, but has a linear complexity on the character's
+     * position otherwise. You should avoid to use it in a loop and use the
+     * iterators provided by this class instead.
      */
     value_type operator[]( const size_type position ) const;
 
     /**
      * \brief Get the raw UTF8-encoded std::string
+     *
+     * \warning The cached length of the string is reset by this method: don't
+     * keep the returned reference to modify the string after calling other
+     * methods of the String.
      */
-    std::string& Raw() { return m_string; }
+    std::string& Raw() { SetCachedLength(npos); return m_string; }
 
     /**
      * \brief Get the raw UTF8-encoded std::string
@@ -666,7 +697,29 @@ public:
  */
 
 private:
+    /**
+     * \brief Return true if the string is only made of ASCII characters, in
+     * which case positions are also byte offsets in the std::string.
+     */
+    bool IsASCII() const { return size() == m_string.size(); }
+
+    /**
+     * \brief Return the offset, in bytes, of the character at **position**
+     * (or the size of the std::string if **position** is past the end).
+     */
+    std::string::size_type GetByteOffset( size_type position ) const;
+
+    /**
+     * \brief Return the position of the character starting at the byte
+     * **byteOffset**.
+     */
+    size_type GetPosition( std::string::size_type byteOffset ) const;
+
+    size_type GetCachedLength() const { return m_length.load(std::memory_order_relaxed); }
+    void SetCachedLength( size_type length ) const { m_length.store(length, std::memory_order_relaxed); }
+
     std::string m_string; ///< Internal std::string container
+    mutable std::atomic<size_type> m_length; ///< The number of characters, or npos if not computed yet.
 
 };
 
@@ -844,8 +897,13 @@ namespace std
  * \section Performance Performance
  * The UTF8 encoding has the advantage to reduce the RAM consumption compared to UTF16 or UTF32 for strings using a lot
  * of latin characters. But the characters variable length brings some performance issues compared to fixed size encoding.
- * That's why the complexity of each methods is written in their documentation. For instance, the size() method is linear
- * on the string size and so is the operator[]().
+ * That's why the complexity of each methods is written in their documentation.
+ *
+ * To mitigate this, the number of characters is cached (and reset when the string is modified): size() is only linear
+ * on the string size the first time it's called. When the string is only made of ASCII characters (which is the case
+ * of most identifiers and expressions), positions are used directly as byte offsets so that operator[](), substr(),
+ * find() and the other position based methods are as fast as their std::string counterparts. For other strings,
+ * operator[]() and the methods taking a position are still linear on the position.
  *
  * \section Conversion Conversions from/to other string types
  * The String handles implicit conversion with sf::String (implicit constructor and implicit conversion
@@ -0,0 +1,32 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/NamedItemsIndex.h"
+
+namespace gd {
+
+NamedItemsIndexLink& NamedItemsIndexLink::operator=(
+    const NamedItemsIndexLink&) {
+  // The item stays in the same container but can now have another name.
+  NameChanged();
+  return *this;
+}
+
+NamedItemsIndex::NamedItemsIndex()
+    : upToDate(false),
+      hasDuplicates(false),
+      renamesCount(std::make_shared<std::size_t>(0)),
+      renamesCountWhenBuilt(0) {}
+
+NamedItemsIndex::NamedItemsIndex(const NamedItemsIndex&)
+    : NamedItemsIndex() {}
+
+NamedItemsIndex& NamedItemsIndex::operator=(const NamedItemsIndex&) {
+  // The items of the container were replaced: build the index again when used.
+  Invalidate();
+  return *this;
+}
+
+}  // namespace gd
@@ -0,0 +1,187 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_NAMEDITEMSINDEX_H
+#define GDCORE_NAMEDITEMSINDEX_H
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "GDCore/String.h"
+
+namespace gd {
+class NamedItemsIndex;
+
+/**
+ * \brief The link from an item to the gd::NamedItemsIndex of the container
+ * owning it, used to tell the index that the item was renamed.
+ *
+ * Items that can be indexed have a link, returned by a method
+ * `GetNamedItemsIndexLink`, and call gd::NamedItemsIndexLink::NameChanged when
+ * their name is changed. The link is set by the index when it is built or
+ * when the item is inserted.
+ */
+class GD_CORE_API NamedItemsIndexLink {
+ public:
+  NamedItemsIndexLink(){};
+  NamedItemsIndexLink(const NamedItemsIndexLink& other) = default;
+  NamedItemsIndexLink& operator=(const NamedItemsIndexLink& other);
+
+  /**
+   * \brief Must be called when the name of the item is changed, so that the
+   * index of its container is built again when used.
+   */
+  void NameChanged() const {
+    if (renamesCount) ++*renamesCount;
+  }
+
+ private:
+  friend class NamedItemsIndex;
+
+  mutable std::shared_ptr<std::size_t>
+      renamesCount;  ///< The renames count of the index of the container.
+};
+
+/**
+ * \brief An index of the positions of the items of a std::vector by their
+ * names, to find an item without comparing the names of all the items.
+ *
+ * The items (or pointers to the items) must have the methods `GetName` and
+ * `GetNamedItemsIndexLink` (see gd::NamedItemsIndexLink). The owner of the
+ * vector must tell the index when items are inserted, removed or reordered.
+ * Items being renamed tell the index through their link.
+ *
+ * Like a search with std::find_if, the position of the first item having a
+ * name is returned if several items have the same name.
+ *
+ * The index is built when first used, so that nothing is done if items are
+ * never searched by their names. Searching is thread-safe as long as the items
+ * are not modified at the same time.
+ */
+class GD_CORE_API NamedItemsIndex {
+ public:
+  NamedItemsIndex();
+  NamedItemsIndex(const NamedItemsIndex& other);
+  NamedItemsIndex& operator=(const NamedItemsIndex& other);
+  virtual ~NamedItemsIndex(){};
+
+  /**
+   * \brief Return the position of the first item with the specified name, or
+   * gd::String::npos if there is no such item.
+   */
+  template <class T>
+  std::size_t GetPosition(const std::vector<T>& items,
+                          const gd::String& name) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!IsUpToDate()) Update(items);
+
+    auto it = positions.find(name);
+    if (it == positions.end()) return gd::String::npos;
+    if (it->second >= items.size() || GetName(items[it->second]) != name) {
+      // The index was not told about a change of the items, so update it.
+      Update(items);
+      it = positions.find(name);
+      if (it == positions.end()) return gd::String::npos;
+    }
+
+    return it->second;
+  }
+
+  /**
+   * \brief Update the index after an item was inserted in the vector.
+   */
+  template <class T>
+  void ItemInserted(const std::vector<T>& items, std::size_t position) {
+    if (!IsUpToDate()) return;
+
+    const gd::String& name = GetName(items[position]);
+    if (positions.find(name) != positions.end()) {
+      Invalidate();  // Let the index find which item is the first one.
+      return;
+    }
+
+    for (auto& it : positions)
+      if (it.second >= position) it.second++;
+    positions[name] = position;
+    GetLink(items[position]).renamesCount = renamesCount;
+  }
+
+  /**
+   * \brief Update the index before the item at the specified position is
+   * removed from the vector.
+   */
+  template <class T>
+  void ItemRemoved(const std::vector<T>& items, std::size_t position) {
+    if (!IsUpToDate()) return;
+    if (hasDuplicates) {
+      Invalidate();  // Another item with the same name could be indexed.
+      return;
+    }
+
+    positions.erase(GetName(items[position]));
+    for (auto& it : positions)
+      if (it.second > position) it.second--;
+  }
+
+  /**
+   * \brief Mark the index as to be built again, for example after the items
+   * were reordered.
+   */
+  void Invalidate() { upToDate = false; }
+
+ private:
+  bool IsUpToDate() const {
+    return upToDate && renamesCountWhenBuilt == *renamesCount;
+  }
+
+  template <class T>
+  void Update(const std::vector<T>& items) const {
+    positions.clear();
+    positions.reserve(items.size());
+    hasDuplicates = false;
+    for (std::size_t i = 0; i < items.size(); ++i) {
+      if (!positions.emplace(GetName(items[i]), i).second) hasDuplicates = true;
+      GetLink(items[i]).renamesCount = renamesCount;
+    }
+
+    upToDate = true;
+    renamesCountWhenBuilt = *renamesCount;
+  }
+
+  template <class T>
+  static const gd::String& GetName(const std::unique_ptr<T>& item) {
+    return item->GetName();
+  }
+
+  template <class T>
+  static const gd::String& GetName(const T& item) {
+    return item.GetName();
+  }
+
+  template <class T>
+  static const NamedItemsIndexLink& GetLink(const std::unique_ptr<T>& item) {
+    return item->GetNamedItemsIndexLink();
+  }
+
+  template <class T>
+  static const NamedItemsIndexLink& GetLink(const T& item) {
+    return item.GetNamedItemsIndexLink();
+  }
+
+  mutable std::unordered_map<gd::String, std::size_t>
+      positions;  ///< The position of the first item having a name.
+  mutable bool upToDate;
+  mutable bool hasDuplicates;  ///< True if some items have the same name.
+  std::shared_ptr<std::size_t>
+      renamesCount;  ///< Incremented by the links of the items when they are
+                     ///< renamed.
+  mutable std::size_t renamesCountWhenBuilt;
+  mutable std::mutex mutex;  ///< Protects the index when it is built.
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_NAMEDITEMSINDEX_H
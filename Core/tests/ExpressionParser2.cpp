@@ -1337,6 +1337,21 @@ TEST_CASE("ExpressionParser2", "[common][events]") {
         REQUIRE(operatorNode.rightHandSide->location.GetStartPosition() == 7);
         REQUIRE(operatorNode.rightHandSide->location.GetEndPosition() == 10);
       }
+      {
+        // Locations are in characters, not in bytes.
+        auto node = parser.ParseExpression("string", u8"\"Déjà vu\" + \"ça\"");
+        REQUIRE(node != nullptr);
+        auto &operatorNode = dynamic_cast<gd::OperatorNode &>(*node);
+        REQUIRE(operatorNode.location.GetStartPosition() == 0);
+        REQUIRE(operatorNode.location.GetEndPosition() == 16);
+        REQUIRE(operatorNode.leftHandSide->location.GetStartPosition() == 0);
+        REQUIRE(operatorNode.leftHandSide->location.GetEndPosition() == 9);
+        REQUIRE(operatorNode.rightHandSide->location.GetStartPosition() == 12);
+        REQUIRE(operatorNode.rightHandSide->location.GetEndPosition() == 16);
+        auto &textNode =
+            dynamic_cast<gd::TextNode &>(*operatorNode.rightHandSide);
+        REQUIRE(textNode.text == u8"ça");
+      }
     }
     SECTION("Variable locations (simple variable name)") {
       auto node = parser.ParseExpression("scenevar", "MyVariable");
@@ -6,14 +6,86 @@
 #include <chrono>
 #include <numeric>
 #include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Cache.h"
 #include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
 #include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/IDE/WholeProjectRefactorer.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "catch.hpp"
 
+namespace {
+/**
+ * \brief Parse all the expressions used in the parameters of instructions,
+ * optionally using a cache.
+ */
+class ExpressionsParser : public gd::ArbitraryEventsWorkerWithContext {
+ public:
+  ExpressionsParser(const gd::Platform &platform_,
+                    gd::ExpressionParser2Cache *cache_ = nullptr)
+      : expressionsCount(0),
+        charactersCount(0),
+        invalidExpressionsCount(0),
+        platform(platform_),
+        cache(cache_){};
+  virtual ~ExpressionsParser(){};
+
+  std::size_t expressionsCount;
+  std::size_t charactersCount;
+  std::size_t invalidExpressionsCount;
+
+ private:
+  bool DoVisitInstruction(gd::Instruction &instruction,
+                          bool isCondition) override {
+    auto &metadata = isCondition ? gd::MetadataProvider::GetConditionMetadata(
+                                       platform, instruction.GetType())
+                                 : gd::MetadataProvider::GetActionMetadata(
+                                       platform, instruction.GetType());
+
+    for (std::size_t pNb = 0; pNb < metadata.parameters.size() &&
+                              pNb < instruction.GetParametersCount();
+         ++pNb) {
+      const gd::String &type = metadata.parameters[pNb].type;
+      const gd::String &expression =
+          instruction.GetParameter(pNb).GetPlainString();
+
+      const gd::String expressionType =
+          gd::ParameterMetadata::IsExpression("number", type) ? "number"
+                                                              : "string";
+      // Nodes are checked after the benchmark, as REQUIRE is slower than
+      // getting a tree from the cache.
+      if (cache) {
+        auto node = cache->ParseExpression(platform,
+                                           GetGlobalObjectsContainer(),
+                                           GetObjectsContainer(),
+                                           expressionType,
+                                           expression);
+        if (!node) invalidExpressionsCount++;
+      } else {
+        gd::ExpressionParser2 parser(
+            platform, GetGlobalObjectsContainer(), GetObjectsContainer());
+        auto node = parser.ParseExpression(expressionType, expression);
+        if (!node) invalidExpressionsCount++;
+      }
+
+      expressionsCount++;
+      charactersCount += expression.size();
+    }
+
+    return false;
+  }
+
+  const gd::Platform &platform;
+  gd::ExpressionParser2Cache *cache;
+};
+}  // namespace
+
 TEST_CASE("ExpressionParser2 - Benchmarks", "[common][events]") {
   gd::Project project;
   gd::Platform platform;
@@ -111,6 +183,139 @@ TEST_CASE("ExpressionParser2 - Benchmarks", "[common][events]") {
     });
   }
 
+  SECTION("Parse all expressions of a large project") {
+    std::vector<gd::String> expressions = {
+        "1+2*3",
+        "MySpriteObject.X() + MySpriteObject.Y() / 2",
+        "MyExtension::GetNumberWith2Params(12, \"Text\") * cos(3.14)",
+        "MySpriteObject.GetObjectStringWith1Param(1 + 2 + 3 + 4 + 5 + 6 + 7)",
+        u8"MyExtension::ToString(MySpriteObject.X()) + \"Déjà vu, ça va ?\"",
+        "MyExtension::GetVariableAsNumber(MyVariable.MyChild[\"Key\"]) + "
+        "MyExtension::GetVariableAsNumber(MyVariable.MyChild[\"Key\"]) + "
+        "MyExtension::GetVariableAsNumber(MyVariable.MyChild[\"Key\"]) + "
+        "MyExtension::GetVariableAsNumber(MyVariable.MyChild[\"Key\"])"};
+
+    const std::size_t layoutsCount = 10;
+    const std::size_t eventsCount = 1000;
+    for (std::size_t i = 0; i < layoutsCount; ++i) {
+      auto &layout = project.InsertNewLayout("Layout" + gd::String::From(i),
+                                             project.GetLayoutsCount());
+      layout.InsertNewObject(
+          project, "MyExtension::Sprite", "MySpriteObject", 0);
+
+      for (std::size_t j = 0; j < eventsCount; ++j) {
+        gd::StandardEvent event;
+        for (std::size_t k = 0; k < 3; ++k) {
+          gd::Instruction action("MyExtension::DoSomething");
+          action.SetParametersCount(1);
+          action.SetParameter(
+              0, expressions[(j + k) % expressions.size()]);
+          event.GetActions().Insert(action);
+        }
+        layout.GetEvents().InsertEvent(event);
+      }
+    }
+
+    ExpressionsParser expressionsParser(platform);
+    doBenchmark("Parse all expressions of a large project", 3, [&]() {
+      gd::WholeProjectRefactorer::ExposeProjectEvents(project,
+                                                      expressionsParser);
+    });
+
+    REQUIRE(expressionsParser.expressionsCount ==
+            3 * 3 * layoutsCount * eventsCount);
+    REQUIRE(expressionsParser.invalidExpressionsCount == 0);
+    std::cout << "Parsed " << expressionsParser.expressionsCount
+              << " expressions (" << expressionsParser.charactersCount
+              << " characters)" << std::endl;
+
+    // Parse again, with a cache for each layout like during code generation.
+    double hitRate = 0;
+    doBenchmark(
+        "Parse all expressions of a large project, with a cache", 3, [&]() {
+          std::size_t hitsCount = 0;
+          std::size_t lookupsCount = 0;
+          for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+            gd::ExpressionParser2Cache cache;
+            ExpressionsParser cachedExpressionsParser(platform, &cache);
+            cachedExpressionsParser.Launch(project.GetLayout(i).GetEvents(),
+                                           project,
+                                           project.GetLayout(i));
+            hitsCount += cache.GetHitsCount();
+            lookupsCount += cache.GetHitsCount() + cache.GetMissesCount();
+          }
+          hitRate = (double)hitsCount / (double)lookupsCount;
+        });
+    std::cout << "Expressions found in the cache: " << hitRate * 100 << "%"
+              << std::endl;
+  }
+
+  SECTION("Parse all expressions of a large project with unique expressions") {
+    // Like in real games, a few expressions (constants, positions of
+    // objects...) are used a lot while others are found only once.
+    std::vector<gd::String> commonExpressions = {
+        "0",
+        "1",
+        "MySpriteObject.X()",
+        "MySpriteObject.Y() + 32",
+        "MyExtension::GetVariableAsNumber(MyVariable)"};
+
+    const std::size_t layoutsCount = 10;
+    const std::size_t eventsCount = 1000;
+    for (std::size_t i = 0; i < layoutsCount; ++i) {
+      auto &layout = project.InsertNewLayout("Layout" + gd::String::From(i),
+                                             project.GetLayoutsCount());
+      layout.InsertNewObject(
+          project, "MyExtension::Sprite", "MySpriteObject", 0);
+
+      for (std::size_t j = 0; j < eventsCount; ++j) {
+        gd::StandardEvent event;
+        for (std::size_t k = 0; k < 3; ++k) {
+          gd::Instruction action("MyExtension::DoSomething");
+          action.SetParametersCount(1);
+          action.SetParameter(
+              0,
+              k == 0 ? "MySpriteObject.X() + " + gd::String::From(j) + " * 2"
+                     : commonExpressions[(j + k) % commonExpressions.size()]);
+          event.GetActions().Insert(action);
+        }
+        layout.GetEvents().InsertEvent(event);
+      }
+    }
+
+    // A code generation is done for each layout, so a cache is used for each
+    // layout.
+    auto parseAllLayouts = [&](bool useCache) {
+      std::size_t hitsCount = 0;
+      std::size_t lookupsCount = 0;
+      std::size_t invalidExpressionsCount = 0;
+      for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+        gd::ExpressionParser2Cache cache;
+        ExpressionsParser expressionsParser(platform,
+                                            useCache ? &cache : nullptr);
+        expressionsParser.Launch(project.GetLayout(i).GetEvents(),
+                                 project,
+                                 project.GetLayout(i));
+        invalidExpressionsCount += expressionsParser.invalidExpressionsCount;
+        hitsCount += cache.GetHitsCount();
+        lookupsCount += cache.GetHitsCount() + cache.GetMissesCount();
+      }
+      REQUIRE(invalidExpressionsCount == 0);
+      return useCache ? (double)hitsCount / (double)lookupsCount : 0;
+    };
+
+    doBenchmark("Parse unique and common expressions, without a cache",
+                3,
+                [&]() { parseAllLayouts(false); });
+    double hitRate = 0;
+    doBenchmark("Parse unique and common expressions, with a cache",
+                3,
+                [&]() { hitRate = parseAllLayouts(true); });
+    std::cout << "Expressions found in the cache: " << hitRate * 100 << "%"
+              << std::endl;
+    REQUIRE(hitRate > 0.6);
+  }
+
   SECTION("Parse long expression") {
     doBenchmark("Long identifier", 100, [&]() {
       REQUIRE_NOTHROW(parseExpression(
@@ -0,0 +1,129 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ExpressionParser2Cache.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/CodeGeneration/ExpressionCodeGenerator.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ExpressionValidator.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("ExpressionParser2Cache", "[common][events]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout1 = project.InsertNewLayout("Layout1", 0);
+  layout1.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+  auto &layout2 = project.InsertNewLayout("Layout2", 1);
+
+  gd::ExpressionParser2Cache cache(3);
+
+  SECTION("Same expression is parsed once") {
+    auto node1 = cache.ParseExpression(
+        platform, project, layout1, "number", "MySpriteObject.GetObjectNumber()");
+    auto node2 = cache.ParseExpression(
+        platform, project, layout1, "number", "MySpriteObject.GetObjectNumber()");
+    REQUIRE(node1 != nullptr);
+    REQUIRE(node1 == node2);
+    REQUIRE(cache.GetHitsCount() == 1);
+    REQUIRE(cache.GetMissesCount() == 1);
+    REQUIRE(cache.GetHitRate() == 0.5);
+    REQUIRE(cache.GetSize() == 1);
+
+    auto &functionNode = dynamic_cast<const gd::FunctionCallNode &>(*node2);
+    REQUIRE(functionNode.functionName == "GetObjectNumber");
+    REQUIRE(functionNode.objectName == "MySpriteObject");
+
+    gd::ExpressionValidator validator;
+    gd::ExpressionParser2Cache::Visit(*node2, validator);
+    REQUIRE(validator.GetErrors().size() == 0);
+  }
+
+  SECTION("Type, object name and containers are part of the key") {
+    auto node = cache.ParseExpression(platform, project, layout1, "number", "1");
+    REQUIRE(cache.ParseExpression(platform, project, layout1, "string", "1") !=
+            node);
+    REQUIRE(cache.ParseExpression(
+                platform, project, layout2, "number", "1") != node);
+    REQUIRE(cache.ParseExpression(
+                platform, project, layout1, "number", "1", "MySpriteObject") !=
+            node);
+    REQUIRE(cache.GetHitsCount() == 0);
+    REQUIRE(cache.GetMissesCount() == 4);
+  }
+
+  SECTION("Modifying the objects invalidates the trees") {
+    auto node = cache.ParseExpression(
+        platform, project, layout1, "number", "MySpriteObject.GetObjectNumber()");
+
+    layout1.RemoveObject("MySpriteObject");
+    auto nodeAfterRemoval = cache.ParseExpression(
+        platform, project, layout1, "number", "MySpriteObject.GetObjectNumber()");
+    REQUIRE(nodeAfterRemoval != node);
+    REQUIRE(cache.GetMissesCount() == 2);
+
+    // Accessing the objects without modifying them keeps the trees.
+    project.GetObjectGroups();
+    layout1.GetObject(0);
+    REQUIRE(cache.ParseExpression(platform,
+                                  project,
+                                  layout1,
+                                  "number",
+                                  "MySpriteObject.GetObjectNumber()") ==
+            nodeAfterRemoval);
+    REQUIRE(cache.GetMissesCount() == 2);
+    REQUIRE(cache.GetHitsCount() == 1);
+  }
+
+  SECTION("Each code generation has its own cache") {
+    unsigned int maxDepth = 0;
+    gd::EventsCodeGenerationContext context(&maxDepth);
+    gd::EventsCodeGenerator codeGenerator(project, layout1, platform);
+    REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                codeGenerator, context, "number", "1 + 2") == "1 + 2");
+    REQUIRE(gd::ExpressionCodeGenerator::GenerateExpressionCode(
+                codeGenerator, context, "number", "1 + 2") == "1 + 2");
+    REQUIRE(codeGenerator.GetExpressionParserCache().GetHitsCount() == 1);
+    REQUIRE(codeGenerator.GetExpressionParserCache().GetMissesCount() == 1);
+
+    gd::EventsCodeGenerator otherCodeGenerator(project, layout1, platform);
+    REQUIRE(otherCodeGenerator.GetExpressionParserCache().GetSize() == 0);
+  }
+
+  SECTION("Size is bounded") {
+    auto node1 = cache.ParseExpression(platform, project, layout1, "number", "1");
+    cache.ParseExpression(platform, project, layout1, "number", "2");
+    cache.ParseExpression(platform, project, layout1, "number", "3");
+
+    // Use the first expression so that the second one is the least recently
+    // used.
+    REQUIRE(cache.ParseExpression(
+                platform, project, layout1, "number", "1") == node1);
+    cache.ParseExpression(platform, project, layout1, "number", "4");
+    REQUIRE(cache.GetSize() == 3);
+
+    REQUIRE(cache.ParseExpression(
+                platform, project, layout1, "number", "1") == node1);
+    REQUIRE(cache.GetHitsCount() == 2);
+    cache.ParseExpression(platform, project, layout1, "number", "2");
+    REQUIRE(cache.GetMissesCount() == 5);
+
+    // The tree is still usable after being removed from the cache.
+    cache.SetMaxSize(0);
+    REQUIRE(cache.GetSize() == 0);
+    REQUIRE(dynamic_cast<const gd::NumberNode &>(*node1).number == "1");
+
+    cache.Clear();
+    REQUIRE(cache.GetHitsCount() == 0);
+    REQUIRE(cache.GetMissesCount() == 0);
+    REQUIRE(cache.GetHitRate() == 0);
+  }
+}
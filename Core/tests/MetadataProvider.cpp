@@ -0,0 +1,151 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the lookups of metadata in the extensions of a
+ * platform.
+ */
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataIndex.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+bool HasAction(const gd::Platform &platform, const gd::String &type) {
+  return &gd::MetadataProvider::GetActionMetadata(platform, type) !=
+         &gd::MetadataProvider::GetActionMetadata(platform, "");
+}
+}  // namespace
+
+TEST_CASE("MetadataProvider", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  SECTION("Objects and behaviors") {
+    REQUIRE(gd::MetadataProvider::GetObjectMetadata(platform,
+                                                    "MyExtension::Sprite")
+                .GetName() == "MyExtension::Sprite");
+    REQUIRE(gd::MetadataProvider::GetExtensionAndObjectMetadata(
+                platform, "MyExtension::Sprite")
+                .GetExtension()
+                .GetName() == "MyExtension");
+    REQUIRE(gd::MetadataProvider::GetObjectMetadata(platform,
+                                                    "MyExtension::Unknown")
+                .GetName() == "");
+
+    REQUIRE(gd::MetadataProvider::GetBehaviorMetadata(
+                platform, "MyExtension::MyBehavior")
+                .GetFullName() == "Dummy behavior");
+    REQUIRE(gd::MetadataProvider::IsBadBehaviorMetadata(
+        gd::MetadataProvider::GetBehaviorMetadata(platform,
+                                                  "MyExtension::Sprite")));
+  }
+
+  SECTION("Actions and conditions") {
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(platform,
+                                                    "MyExtension::DoSomething")
+                .GetFullName() == "Do something");
+    REQUIRE(!HasAction(platform, "MyExtension::Unknown"));
+    REQUIRE(&gd::MetadataProvider::GetConditionMetadata(
+                platform, "MyExtension::DoSomething") ==
+            &gd::MetadataProvider::GetActionMetadata(platform, ""));
+  }
+
+  SECTION("Expressions") {
+    REQUIRE(gd::MetadataProvider::GetExpressionMetadata(
+                platform, "MyExtension::GetNumber")
+                .GetFullName() == "Get me a number");
+    REQUIRE(gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetStrExpressionMetadata(
+            platform, "MyExtension::GetNumber")));
+    REQUIRE(gd::MetadataProvider::GetAnyExpressionMetadata(
+                platform, "MyExtension::ToString")
+                .GetFullName() == "ToString");
+
+    REQUIRE(gd::MetadataProvider::GetObjectExpressionMetadata(
+                platform, "MyExtension::Sprite", "GetObjectNumber")
+                .GetFullName() == "Get number from object");
+    REQUIRE(gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "MyExtension::Unknown", "GetObjectNumber")));
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectAnyExpressionMetadata(
+            platform, "MyExtension::Sprite", "GetObjectStringWith1Param")));
+  }
+
+  SECTION("Expressions of the base object") {
+    std::shared_ptr<gd::PlatformExtension> extension =
+        std::make_shared<gd::PlatformExtension>();
+    extension->SetExtensionInformation(
+        "BuiltinObject", "Base object expressions", "", "", "");
+    extension->AddObject<gd::Object>("", "Base object", "", "")
+        .AddExpression("X", "X position", "", "", "");
+    platform.AddExtension(extension);
+
+    // Expressions of the base object are found for all objects.
+    REQUIRE(gd::MetadataProvider::GetObjectExpressionMetadata(
+                platform, "MyExtension::Sprite", "X")
+                .GetFullName() == "X position");
+    REQUIRE(gd::MetadataProvider::GetObjectExpressionMetadata(
+                platform, "MyExtension::Unknown", "X")
+                .GetFullName() == "X position");
+    REQUIRE(gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectStrExpressionMetadata(
+            platform, "MyExtension::Sprite", "X")));
+  }
+
+  SECTION("The first extension declaring a type is used") {
+    // Builtin extensions have no namespace, so they can declare the same
+    // types.
+    std::shared_ptr<gd::PlatformExtension> extension =
+        std::make_shared<gd::PlatformExtension>();
+    extension->SetExtensionInformation(
+        "BuiltinAudio", "First extension", "", "", "");
+    extension->AddAction("PlaySound", "Play a sound", "", "", "", "", "");
+    platform.AddExtension(extension);
+
+    std::shared_ptr<gd::PlatformExtension> otherExtension =
+        std::make_shared<gd::PlatformExtension>();
+    otherExtension->SetExtensionInformation(
+        "BuiltinTime", "Second extension", "", "", "");
+    otherExtension->AddAction(
+        "PlaySound", "Play another sound", "", "", "", "", "");
+    otherExtension->AddAction("Wait", "Wait", "", "", "", "", "");
+    platform.AddExtension(otherExtension);
+
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(platform, "PlaySound")
+                .GetFullName() == "Play a sound");
+    REQUIRE(gd::MetadataProvider::GetExtensionAndActionMetadata(platform,
+                                                                "Wait")
+                .GetExtension()
+                .GetName() == "BuiltinTime");
+  }
+
+  SECTION("Metadata are found after extensions are added or removed") {
+    REQUIRE(!HasAction(platform, "MyNewExtension::DoSomething"));
+    const gd::MetadataIndex &index = platform.GetMetadataIndex();
+    REQUIRE(&platform.GetMetadataIndex() == &index);
+
+    std::shared_ptr<gd::PlatformExtension> extension =
+        std::make_shared<gd::PlatformExtension>();
+    extension->SetExtensionInformation(
+        "MyNewExtension", "My new extension", "", "", "");
+    extension->AddAction(
+        "DoSomething", "Do something new", "", "", "", "", "");
+    platform.AddExtension(extension);
+    REQUIRE(HasAction(platform, "MyNewExtension::DoSomething"));
+
+    platform.RemoveExtension("MyNewExtension");
+    REQUIRE(!HasAction(platform, "MyNewExtension::DoSomething"));
+    REQUIRE(HasAction(platform, "MyExtension::DoSomething"));
+  }
+}
@@ -0,0 +1,108 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <chrono>
+#include <numeric>
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "catch.hpp"
+
+TEST_CASE("MetadataProvider - Benchmarks", "[common]") {
+  // A platform with as many extensions and instructions as the platforms
+  // used by the IDE.
+  gd::Platform platform;
+  platform.EnableExtensionLoadingLogs(false);
+  const std::size_t extensionsCount = 80;
+  const std::size_t objectsCount = 2;
+  const std::size_t instructionsCount = 20;
+  std::vector<gd::String> actionsTypes;
+  std::vector<gd::String> conditionsTypes;
+  std::vector<std::pair<gd::String, gd::String>> objectsExpressions;
+  for (std::size_t i = 0; i < extensionsCount; ++i) {
+    std::shared_ptr<gd::PlatformExtension> extension =
+        std::make_shared<gd::PlatformExtension>();
+    gd::String extensionName = "Extension" + gd::String::From(i);
+    extension->SetExtensionInformation(extensionName, "", "", "", "");
+    for (std::size_t j = 0; j < instructionsCount; ++j) {
+      gd::String name = "Instruction" + gd::String::From(j);
+      extension->AddAction(name, "", "", "", "", "", "");
+      extension->AddCondition(name, "", "", "", "", "", "");
+      extension->AddExpression(name, "", "", "", "");
+      actionsTypes.push_back(extensionName + "::" + name);
+    }
+    for (std::size_t j = 0; j < objectsCount; ++j) {
+      gd::String objectName = "Object" + gd::String::From(j);
+      auto &object =
+          extension->AddObject<gd::Object>(objectName, "", "", "");
+      for (std::size_t k = 0; k < instructionsCount; ++k) {
+        gd::String name = objectName + "Instruction" + gd::String::From(k);
+        object.AddCondition(name, "", "", "", "", "", "");
+        object.AddStrExpression(name, "", "", "", "");
+        conditionsTypes.push_back(extensionName + "::" + name);
+        objectsExpressions.push_back(
+            std::make_pair(extensionName + "::" + objectName, name));
+      }
+    }
+    platform.AddExtension(extension);
+  }
+
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  SECTION("Find metadata of instructions") {
+    doBenchmark("Find metadata of instructions", 3, [&]() {
+      std::size_t foundCount = 0;
+      for (const gd::String &type : actionsTypes)
+        if (&gd::MetadataProvider::GetActionMetadata(platform, type) !=
+            &gd::MetadataProvider::GetActionMetadata(platform, ""))
+          foundCount++;
+      for (const gd::String &type : conditionsTypes)
+        if (&gd::MetadataProvider::GetConditionMetadata(platform, type) !=
+            &gd::MetadataProvider::GetConditionMetadata(platform, ""))
+          foundCount++;
+
+      REQUIRE(foundCount == actionsTypes.size() + conditionsTypes.size());
+    });
+  }
+
+  SECTION("Find metadata of object expressions") {
+    doBenchmark("Find metadata of object expressions", 3, [&]() {
+      std::size_t foundCount = 0;
+      for (const auto &objectExpression : objectsExpressions)
+        if (!gd::MetadataProvider::IsBadExpressionMetadata(
+                gd::MetadataProvider::GetObjectAnyExpressionMetadata(
+                    platform,
+                    objectExpression.first,
+                    objectExpression.second)))
+          foundCount++;
+
+      REQUIRE(foundCount == objectsExpressions.size());
+    });
+  }
+}
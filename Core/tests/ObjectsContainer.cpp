@@ -0,0 +1,221 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the search of objects, groups and layouts by name.
+ */
+#include "GDCore/Project/ObjectsContainer.h"
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/ExternalLayout.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("ObjectsContainer", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+  layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject1", 0);
+  layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject2", 1);
+  layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject3", 2);
+
+  auto requireObjectAt = [&layout](const gd::String &name,
+                                   std::size_t position) {
+    REQUIRE(layout.HasObjectNamed(name));
+    REQUIRE(layout.GetObjectPosition(name) == position);
+    REQUIRE(&layout.GetObject(name) == &layout.GetObject(position));
+  };
+
+  SECTION("Objects are found after being inserted or removed") {
+    requireObjectAt("MyObject1", 0);
+    requireObjectAt("MyObject3", 2);
+    REQUIRE(!layout.HasObjectNamed("MyObject4"));
+    REQUIRE(layout.GetObjectPosition("MyObject4") == gd::String::npos);
+
+    layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject4", 1);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject5", -1);
+    requireObjectAt("MyObject1", 0);
+    requireObjectAt("MyObject4", 1);
+    requireObjectAt("MyObject2", 2);
+    requireObjectAt("MyObject5", 4);
+
+    layout.RemoveObject("MyObject2");
+    REQUIRE(!layout.HasObjectNamed("MyObject2"));
+    requireObjectAt("MyObject4", 1);
+    requireObjectAt("MyObject3", 2);
+    requireObjectAt("MyObject5", 3);
+  }
+
+  SECTION("Objects are found after being renamed or moved") {
+    REQUIRE(layout.HasObjectNamed("MyObject2"));
+    layout.GetObject("MyObject2").SetName("MyRenamedObject");
+    REQUIRE(!layout.HasObjectNamed("MyObject2"));
+    requireObjectAt("MyRenamedObject", 1);
+
+    layout.SwapObjects(0, 2);
+    requireObjectAt("MyObject3", 0);
+    requireObjectAt("MyObject1", 2);
+
+    layout.MoveObject(0, 2);
+    requireObjectAt("MyRenamedObject", 0);
+    requireObjectAt("MyObject1", 1);
+    requireObjectAt("MyObject3", 2);
+
+    layout.MoveObjectToAnotherContainer("MyObject1", project, 0);
+    REQUIRE(!layout.HasObjectNamed("MyObject1"));
+    requireObjectAt("MyObject3", 1);
+    REQUIRE(project.GetObjectPosition("MyObject1") == 0);
+  }
+
+  SECTION("First object is found when objects have the same name") {
+    gd::Object &object = layout.GetObject("MyObject3");
+    layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject3", 0);
+    requireObjectAt("MyObject3", 0);
+
+    layout.RemoveObject("MyObject3");
+    requireObjectAt("MyObject3", 2);
+    REQUIRE(&layout.GetObject("MyObject3") == &object);
+  }
+
+  SECTION("Objects are found in copies of the layout") {
+    REQUIRE(layout.HasObjectNamed("MyObject1"));
+    gd::Layout otherLayout;
+    otherLayout.InsertNewObject(project, "MyExtension::Sprite", "Other", 0);
+    REQUIRE(otherLayout.HasObjectNamed("Other"));
+
+    otherLayout = layout;
+    REQUIRE(!otherLayout.HasObjectNamed("Other"));
+    REQUIRE(otherLayout.GetObjectPosition("MyObject2") == 1);
+    REQUIRE(&otherLayout.GetObject("MyObject2") != &layout.GetObject(1));
+  }
+
+  SECTION("Objects renamed after being copied or moved are found") {
+    gd::Layout otherLayout = layout;
+    REQUIRE(otherLayout.HasObjectNamed("MyObject2"));
+    otherLayout.GetObject("MyObject2").SetName("MyRenamedObject");
+    REQUIRE(otherLayout.GetObjectPosition("MyRenamedObject") == 1);
+    REQUIRE(!layout.HasObjectNamed("MyRenamedObject"));
+    requireObjectAt("MyObject2", 1);
+
+    REQUIRE(!project.HasObjectNamed("MyObject1"));
+    layout.MoveObjectToAnotherContainer("MyObject1", project, 0);
+    REQUIRE(project.HasObjectNamed("MyObject1"));
+    project.GetObject("MyObject1").SetName("MyGlobalObject");
+    REQUIRE(project.GetObjectPosition("MyGlobalObject") == 0);
+    REQUIRE(!layout.HasObjectNamed("MyGlobalObject"));
+  }
+
+  SECTION("Groups are found after being inserted, renamed or removed") {
+    gd::ObjectGroupsContainer &groups = layout.GetObjectGroups();
+    groups.InsertNew("MyGroup1");
+    groups.InsertNew("MyGroup2", 0);
+    REQUIRE(groups.Has("MyGroup1"));
+    REQUIRE(groups.GetPosition("MyGroup1") == 1);
+    REQUIRE(groups.Get("MyGroup2").GetName() == "MyGroup2");
+
+    REQUIRE(groups.Rename("MyGroup1", "MyRenamedGroup"));
+    REQUIRE(!groups.Has("MyGroup1"));
+    REQUIRE(groups.GetPosition("MyRenamedGroup") == 1);
+
+    groups.Move(1, 0);
+    REQUIRE(groups.GetPosition("MyRenamedGroup") == 0);
+
+    gd::ObjectGroup otherGroup;
+    otherGroup.SetName("MyAssignedGroup");
+    groups.Get("MyGroup2") = otherGroup;
+    REQUIRE(!groups.Has("MyGroup2"));
+    REQUIRE(groups.GetPosition("MyAssignedGroup") == 1);
+    groups.Get("MyAssignedGroup").SetName("MyGroup2");
+
+    groups.Remove("MyRenamedGroup");
+    REQUIRE(!groups.Has("MyRenamedGroup"));
+    REQUIRE(groups.GetPosition("MyGroup2") == 0);
+  }
+
+  SECTION("Type of groups") {
+    project.InsertNewObject(project, "", "MyBaseObject", 0);
+    gd::ObjectGroup &group = layout.GetObjectGroups().InsertNew("MyGroup");
+    group.AddObject("MyObject1");
+    group.AddObject("MyObject2");
+    REQUIRE(gd::GetTypeOfObject(project, layout, "MyGroup", true) ==
+            "MyExtension::Sprite");
+    REQUIRE(gd::GetTypeOfObject(project, layout, "MyGroup", false) == "");
+
+    // Modifying a group given before is taken into account.
+    group.AddObject("MyBaseObject");
+    REQUIRE(gd::GetTypeOfObject(project, layout, "MyGroup", true) == "");
+    group.RemoveObject("MyBaseObject");
+    REQUIRE(gd::GetTypeOfObject(project, layout, "MyGroup", true) ==
+            "MyExtension::Sprite");
+
+    // Groups of the project are also used.
+    gd::ObjectGroup &globalGroup =
+        project.GetObjectGroups().InsertNew("MyGlobalGroup");
+    globalGroup.AddObject("MyBaseObject");
+    globalGroup.AddObject("MyObject3");
+    REQUIRE(gd::GetTypeOfObject(project, layout, "MyGlobalGroup", true) == "");
+    project.GetObject("MyBaseObject").SetName("MyOtherObject");
+    layout.GetObject("MyObject1").SetName("MyBaseObject");
+    REQUIRE(gd::GetTypeOfObject(project, layout, "MyGlobalGroup", true) ==
+            "MyExtension::Sprite");
+  }
+}
+
+TEST_CASE("Project layouts and external events", "[common]") {
+  gd::Project project;
+  project.InsertNewLayout("Layout1", 0);
+  project.InsertNewLayout("Layout2", 1);
+  project.InsertNewExternalEvents("Events1", 0);
+  project.InsertNewExternalLayout("ExternalLayout1", 0);
+
+  SECTION("Layouts") {
+    REQUIRE(project.HasLayoutNamed("Layout2"));
+    REQUIRE(project.GetLayoutPosition("Layout2") == 1);
+    REQUIRE(&project.GetLayout("Layout1") == &project.GetLayout(0));
+
+    project.InsertNewLayout("Layout0", 0);
+    REQUIRE(project.GetLayoutPosition("Layout2") == 2);
+    project.SwapLayouts(0, 2);
+    REQUIRE(project.GetLayoutPosition("Layout2") == 0);
+    project.GetLayout("Layout2").SetName("RenamedLayout");
+    REQUIRE(!project.HasLayoutNamed("Layout2"));
+    REQUIRE(project.GetLayoutPosition("RenamedLayout") == 0);
+
+    project.RemoveLayout("RenamedLayout");
+    REQUIRE(!project.HasLayoutNamed("RenamedLayout"));
+    REQUIRE(project.GetLayoutPosition("Layout0") == 1);
+  }
+
+  SECTION("External events and layouts") {
+    REQUIRE(project.HasExternalEventsNamed("Events1"));
+    REQUIRE(!project.HasExternalEventsNamed("Layout1"));
+    project.InsertNewExternalEvents("Events0", 0);
+    REQUIRE(project.GetExternalEventsPosition("Events1") == 1);
+    project.RemoveExternalEvents("Events0");
+    REQUIRE(project.GetExternalEventsPosition("Events1") == 0);
+
+    REQUIRE(project.HasExternalLayoutNamed("ExternalLayout1"));
+    project.GetExternalLayout("ExternalLayout1").SetName("Renamed");
+    REQUIRE(project.HasExternalLayoutNamed("Renamed"));
+    project.RemoveExternalLayout("Renamed");
+    REQUIRE(project.GetExternalLayoutsCount() == 0);
+  }
+
+  SECTION("Copy of a project") {
+    REQUIRE(project.HasLayoutNamed("Layout1"));
+    gd::Project otherProject;
+    otherProject.InsertNewLayout("Other", 0);
+    REQUIRE(otherProject.HasLayoutNamed("Other"));
+
+    otherProject = project;
+    REQUIRE(!otherProject.HasLayoutNamed("Other"));
+    REQUIRE(otherProject.GetLayoutPosition("Layout2") == 1);
+    REQUIRE(otherProject.HasExternalEventsNamed("Events1"));
+  }
+}
@@ -0,0 +1,76 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <chrono>
+#include <numeric>
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("ObjectsContainer - Benchmarks", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+
+  const std::size_t objectsCount = 3000;
+  const std::size_t groupsCount = 200;
+  gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+  std::vector<gd::String> names;
+  for (std::size_t i = 0; i < objectsCount; ++i) {
+    gd::String name = "MyObject" + gd::String::From(i);
+    layout.InsertNewObject(
+        project, "MyExtension::Sprite", name, layout.GetObjectsCount());
+    names.push_back(name);
+  }
+  for (std::size_t i = 0; i < groupsCount; ++i) {
+    gd::String name = "MyGroup" + gd::String::From(i);
+    gd::ObjectGroup &group =
+        layout.GetObjectGroups().InsertNew(name, layout.GetObjectGroups().size());
+    for (std::size_t j = 0; j < 10; ++j)
+      group.AddObject(names[(i * 10 + j) % objectsCount]);
+    names.push_back(name);
+  }
+
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  SECTION("Find the types of all objects and groups") {
+    const gd::Project &constProject = project;
+    const gd::Layout &constLayout = layout;
+    doBenchmark("Find the types of all objects and groups", 3, [&]() {
+      std::size_t spritesCount = 0;
+      for (const gd::String &name : names) {
+        if (gd::GetTypeOfObject(constProject, constLayout, name, true) ==
+            "MyExtension::Sprite")
+          spritesCount++;
+      }
+
+      REQUIRE(spritesCount == names.size());
+    });
+  }
+}
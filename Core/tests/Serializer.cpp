@@ -7,6 +7,7 @@
  * @file Tests covering serialization to JSON.
  */
 #include "GDCore/Serialization/Serializer.h"
+#include <sstream>
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Event.h"
@@ -99,6 +100,51 @@ TEST_CASE("SerializerElement", "[common]") {
     REQUIRE(element.GetStringAttribute("attr1") == "attr123");
     REQUIRE(element.GetStringAttribute("child1") == "value456");
   }
+
+  SECTION("Many children (indexed by name)") {
+    SerializerElement element;
+    for (std::size_t i = 0; i < 100; ++i)
+      element.AddChild("child" + gd::String::From(i)).SetIntValue(i);
+    element.AddChild("child50").SetIntValue(-50);
+
+    REQUIRE(element.GetAllChildren().size() == 100);
+    REQUIRE(element.HasChild("child99") == true);
+    REQUIRE(element.HasChild("child100") == false);
+    REQUIRE(element.GetChild("child3").GetIntValue() == 3);
+    REQUIRE(element.GetChild("child50").GetIntValue() == -50);
+    REQUIRE(element.GetIntAttribute("child42") == 42);
+    REQUIRE(element.GetIntAttribute("oldName", 0, "child43") == 43);
+
+    element.RemoveChild("child3");
+    REQUIRE(element.GetAllChildren().size() == 99);
+    REQUIRE(element.HasChild("child3") == false);
+    REQUIRE(element.GetChild("child4").GetIntValue() == 4);
+    REQUIRE(element.GetChild("child99").GetIntValue() == 99);
+
+    SerializerElement copiedElement = element;
+    REQUIRE(copiedElement.GetChild("child98").GetIntValue() == 98);
+    copiedElement.AddChild("child100").SetIntValue(100);
+    REQUIRE(copiedElement.GetChild("child100").GetIntValue() == 100);
+    REQUIRE(element.HasChild("child100") == false);
+  }
+
+  SECTION("Many children, in arrays with named and unnamed children") {
+    SerializerElement element;
+    element.ConsiderAsArray();
+    for (std::size_t i = 0; i < 50; ++i)
+      element.AddChild("").SetIntValue(i * 2);
+    element.ConsiderAsArrayOf("namedElement", "oldElement");
+    for (std::size_t i = 0; i < 50; ++i)
+      element.AddChild("namedElement").SetIntValue(100 + i);
+
+    REQUIRE(element.GetChildrenCount() == 100);
+    REQUIRE(element.GetChild(0).GetIntValue() == 0);
+    REQUIRE(element.GetChild(49).GetIntValue() == 98);
+    REQUIRE(element.GetChild(50).GetIntValue() == 100);
+    REQUIRE(element.GetChild(99).GetIntValue() == 149);
+    REQUIRE(element.GetChild("namedElement", 51).GetIntValue() == 101);
+    REQUIRE(&element.GetChild(100) == &SerializerElement::nullElement);
+  }
 }
 
 TEST_CASE("Serializer", "[common]") {
@@ -203,4 +249,118 @@ TEST_CASE("Serializer", "[common]") {
     gd::String json = Serializer::ToJSON(element);
     REQUIRE(json == "{\"hello\":\"world1\",\"ok\":true,\"hello2\":\"world2\"}");
   }
+
+  SECTION("Null values and invalid JSON") {
+    SerializerElement element =
+        Serializer::FromJSON("{\"a\":null,\"b\":[null,1.5]}");
+    REQUIRE(element.HasChild("a") == true);
+    REQUIRE(element.GetChild("a").IsValueUndefined() == true);
+    REQUIRE(element.GetChild("b").GetChildrenCount() == 2);
+    REQUIRE(element.GetChild("b").GetChild(1).GetDoubleValue() == 1.5);
+
+    SerializerElement invalidElement =
+        Serializer::FromJSON("{\"a\":1,\"b\":[2,");
+    REQUIRE(invalidElement.IsValueUndefined() == true);
+    REQUIRE(invalidElement.GetAllChildren().size() == 0);
+  }
+
+  SECTION("Writing to a stream") {
+    gd::String originalJSON =
+        u8"{\"hello\":{\"world\":[{},[],3,\"4\"],\"官话\":[-1,\"-2\","
+        u8"{\"-3\":[-4.5]}]}}";
+    SerializerElement element = Serializer::FromJSON(originalJSON);
+
+    std::stringstream stream;
+    Serializer::ToJSON(element, stream);
+    REQUIRE(stream.str() == originalJSON.Raw());
+  }
+
+  SECTION("Large JSON") {
+    SerializerElement element;
+    element.ConsiderAsArrayOf("item");
+    for (std::size_t i = 0; i < 100000; ++i) {
+      SerializerElement& item = element.AddChild("item");
+      item.SetAttribute("name", "Item number " + gd::String::From(i));
+      item.AddChild("value").SetIntValue(i);
+    }
+
+    gd::String json = Serializer::ToJSON(element);
+    SerializerElement unserializedElement = Serializer::FromJSON(json);
+    REQUIRE(unserializedElement.GetChildrenCount() == 100000);
+    REQUIRE(unserializedElement.GetChild(99999)
+                .GetStringAttribute("name") == "Item number 99999");
+    REQUIRE(Serializer::ToJSON(unserializedElement) == json);
+  }
+}
+
+TEST_CASE("Serializer (binary)", "[common]") {
+  auto binaryRoundTripToJSON = [](const SerializerElement& element) {
+    std::string binary = Serializer::ToBinary(element);
+    REQUIRE(Serializer::IsBinary(binary.data(), binary.size()) == true);
+    return Serializer::ToJSON(Serializer::FromBinary(binary));
+  };
+
+  SECTION("Round trip, compared to JSON") {
+    std::vector<gd::String> tests = {
+        "\"\"",
+        "123.455",
+        "-42",
+        "true",
+        "{}",
+        "[]",
+        "[1,2,-2147483648,2147483647]",
+        "{\"a\":1,\"b\":{\"c\":2.5,\"d\":false}}",
+        "{\"hello\":{\"world\":[{},[],3,\"4\"],\"world2\":[-1,\"-2\","
+        "{\"-3\":[-4]}]}}",
+        u8"{\"Ich heiße GDevelop\":\"Gut!\",\"官话\":[\"官话\",\"官话\"]}",
+        "{\"special-\\b\\f\\n\\r\\t\\\"\":\"\\b\\f\\n\\r\\t\"}"};
+    for (auto& json : tests) {
+      REQUIRE(binaryRoundTripToJSON(Serializer::FromJSON(json)) == json);
+    }
+  }
+
+  SECTION("Attributes are read as children") {
+    SerializerElement element;
+    element.SetAttribute("name", "MyObject");
+    element.SetAttribute("x", 12.5);
+    element.AddChild("children").ConsiderAsArrayOf("child");
+    element.GetChild("children").AddChild("child").SetValue(3);
+
+    REQUIRE(binaryRoundTripToJSON(element) == Serializer::ToJSON(element));
+
+    SerializerElement unserializedElement =
+        Serializer::FromBinary(Serializer::ToBinary(element));
+    REQUIRE(unserializedElement.GetStringAttribute("name") == "MyObject");
+    REQUIRE(unserializedElement.GetDoubleAttribute("x") == 12.5);
+    REQUIRE(unserializedElement.GetChild("children").GetChild(0).GetIntValue() ==
+            3);
+  }
+
+  SECTION("Strings are stored once") {
+    SerializerElement element;
+    element.ConsiderAsArrayOf("instance");
+    for (std::size_t i = 0; i < 1000; ++i) {
+      element.AddChild("instance").SetAttribute(
+          "name", "A long object name, repeated in every instance");
+    }
+
+    REQUIRE(Serializer::ToBinary(element).size() < 10000);
+  }
+
+  SECTION("Invalid data") {
+    std::string binary =
+        Serializer::ToBinary(Serializer::FromJSON("{\"a\":[1,2,\"3\"]}"));
+    for (std::size_t size = 0; size < binary.size(); ++size) {
+      SerializerElement element = Serializer::FromBinary(binary.data(), size);
+      REQUIRE(element.GetAllChildren().empty() == true);
+    }
+
+    std::string corrupted = binary;
+    corrupted[4] = 99;  // Version
+    REQUIRE(Serializer::FromBinary(corrupted).GetAllChildren().empty() == true);
+
+    REQUIRE(Serializer::IsBinary("{\"a\":1}", 7) == false);
+    REQUIRE(Serializer::FromBinary("{\"a\":1}", 7).GetAllChildren().empty() ==
+            true);
+  }
 }
@@ -0,0 +1,102 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <chrono>
+#include <numeric>
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/InitialInstance.h"
+#include "GDCore/Project/InitialInstancesContainer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+TEST_CASE("Serializer - Benchmarks", "[common]") {
+  gd::Project project;
+  gd::Platform platform;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout1 = project.InsertNewLayout("Layout1", 0);
+  layout1.InsertNewObject(project, "MyExtension::Sprite", "MySpriteObject", 0);
+
+  const std::size_t instancesCount = 50000;
+  for (std::size_t i = 0; i < instancesCount; ++i) {
+    gd::InitialInstance &instance =
+        layout1.GetInitialInstances().InsertNewInitialInstance();
+    instance.SetObjectName("MySpriteObject");
+    instance.SetX(i % 1000);
+    instance.SetY(i / 1000);
+    instance.SetZOrder(i);
+    instance.GetVariables().InsertNew("Variable", 0).SetValue(i);
+  }
+
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  SECTION("Serialize and unserialize a project with 50k instances") {
+    gd::SerializerElement element;
+    doBenchmark("Project::SerializeTo (50k instances)", 3, [&]() {
+      element = gd::SerializerElement();
+      project.SerializeTo(element);
+    });
+
+    gd::String json;
+    doBenchmark("Serializer::ToJSON (50k instances)", 3, [&]() {
+      json = gd::Serializer::ToJSON(element);
+    });
+
+    gd::SerializerElement unserializedElement;
+    doBenchmark("Serializer::FromJSON (50k instances)", 3, [&]() {
+      unserializedElement = gd::Serializer::FromJSON(json);
+    });
+    REQUIRE(gd::Serializer::ToJSON(unserializedElement) == json);
+
+    std::string binary;
+    doBenchmark("Serializer::ToBinary (50k instances)", 3, [&]() {
+      binary = gd::Serializer::ToBinary(element);
+    });
+
+    gd::SerializerElement unserializedBinaryElement;
+    doBenchmark("Serializer::FromBinary (50k instances)", 3, [&]() {
+      unserializedBinaryElement = gd::Serializer::FromBinary(binary);
+    });
+    REQUIRE(gd::Serializer::ToJSON(unserializedBinaryElement) == json);
+    std::cout << "JSON size: " << json.Raw().size()
+              << " bytes, binary size: " << binary.size() << " bytes"
+              << std::endl;
+
+    gd::Project unserializedProject;
+    unserializedProject.AddPlatform(platform);
+    doBenchmark("Project::UnserializeFrom (50k instances)", 3, [&]() {
+      unserializedProject.UnserializeFrom(unserializedElement);
+    });
+
+    REQUIRE(unserializedProject.HasLayoutNamed("Layout1"));
+    REQUIRE(unserializedProject.GetLayout("Layout1")
+                .GetInitialInstances()
+                .GetInstancesCount() == instancesCount);
+  }
+}
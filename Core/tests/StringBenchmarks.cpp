@@ -0,0 +1,78 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <chrono>
+#include <numeric>
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+TEST_CASE("String - Benchmarks", "[common][utf8]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount
+              << " runs): " << std::accumulate(timesInMicroseconds.begin(),
+                                               timesInMicroseconds.end(),
+                                               0) /
+                                   (double)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  auto makeString = [](const gd::String &word, std::size_t count) {
+    gd::String str;
+    for (std::size_t i = 0; i < count; ++i) {
+      str += word;
+      str += ";";
+    }
+    return str;
+  };
+
+  std::vector<std::pair<gd::String, gd::String>> strings = {
+      {"ASCII", makeString("MyObject.X()", 1000)},
+      {"multi-byte", makeString(u8"MonObjet.Élément()", 1000)}};
+
+  for (auto &namedString : strings) {
+    const gd::String &name = namedString.first;
+    const gd::String &str = namedString.second;
+    std::size_t count = 0;
+
+    doBenchmark("size (" + name + ")", 10, [&]() {
+      for (std::size_t i = 0; i < 10000; ++i) count += str.size();
+    });
+    REQUIRE(count > 0);
+
+    doBenchmark("operator[] (" + name + ")", 10, [&]() {
+      for (std::size_t i = 0; i < str.size(); ++i)
+        if (str[i] == U';') count++;
+    });
+
+    doBenchmark("find (" + name + ")", 10, [&]() {
+      for (std::size_t pos = str.find(";"); pos != gd::String::npos;
+           pos = str.find(";", pos + 1))
+        count++;
+    });
+
+    doBenchmark("substr (" + name + ")", 10, [&]() {
+      for (std::size_t i = 0; i < str.size(); i += 10)
+        count += str.substr(i, 10).empty() ? 0 : 1;
+    });
+
+    std::vector<gd::String> parts;
+    doBenchmark("Split (" + name + ")", 10, [&]() { parts = str.Split(U';'); });
+    REQUIRE(parts.size() == 1001);
+  }
+}
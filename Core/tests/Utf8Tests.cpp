@@ -290,6 +290,75 @@ TEST_CASE("Utf8 String", "[common][utf8]") {
     REQUIRE(str6.FindAndReplace(u8"ßß", u8"ß") == u8"ßß");
   }
 
+  SECTION("cached length") {
+    gd::String str = "ASCII only";
+    REQUIRE(str.size() == 10);
+    REQUIRE(str[6] == U'o');
+
+    str += u8" (or not: é)";
+    REQUIRE(str.size() == 22);
+    REQUIRE(str[20] == U'é');
+    REQUIRE(str.substr(11, 2) == "(o");
+
+    str.erase(10, gd::String::npos);
+    REQUIRE(str.size() == 10);
+    REQUIRE(str == "ASCII only");
+
+    str.insert(5, u8"ß");
+    REQUIRE(str.size() == 11);
+    REQUIRE(str.find(U'o') == 7);
+    REQUIRE(str.find_first_of(u8" ß") == 5);
+
+    str.replace(5, 1, "!");
+    REQUIRE(str.size() == 11);
+    REQUIRE(str.find(U'o') == 7);
+
+    str.Raw() += u8"ééé";
+    REQUIRE(str.size() == 14);
+    REQUIRE(str[13] == U'é');
+
+    str.push_back(U'ß');
+    str.pop_back();
+    str.pop_back();
+    REQUIRE(str.size() == 13);
+
+    gd::String copy = str;
+    REQUIRE(copy.size() == 13);
+
+    gd::String moved = std::move(str);
+    REQUIRE(moved.size() == 13);
+    REQUIRE(moved == copy);
+
+    str = "abc";
+    REQUIRE(str.size() == 3);
+    str.clear();
+    REQUIRE(str.size() == 0);
+  }
+
+  SECTION("ASCII and non ASCII strings") {
+    gd::String ascii = "The quick brown fox jumps over the lazy dog";
+    gd::String nonAscii = u8"Thé quick brown fox jumps över the lazy dög";
+
+    REQUIRE(ascii.size() == nonAscii.size());
+    for (std::size_t i = 0; i < ascii.size(); ++i) {
+      if (ascii[i] < 0x80 && nonAscii[i] < 0x80) {
+        REQUIRE(ascii[i] == nonAscii[i]);
+      }
+    }
+
+    REQUIRE(ascii.find("fox") == nonAscii.find("fox"));
+    REQUIRE(ascii.find(U'o', 13) == nonAscii.find(U'o', 13));
+    REQUIRE(ascii.rfind("the") == nonAscii.rfind("the"));
+    REQUIRE(ascii.find_last_of("qz") == nonAscii.find_last_of("qz"));
+    REQUIRE(ascii.find_first_not_of("The ") ==
+            nonAscii.find_first_not_of(u8"Thé "));
+    REQUIRE(ascii.substr(10, 9) == nonAscii.substr(10, 9));
+    REQUIRE(ascii.Split(U' ').size() == 9);
+    REQUIRE(nonAscii.Split(U' ').size() == 9);
+    REQUIRE(nonAscii.Split(U' ')[5] == u8"över");
+    REQUIRE(nonAscii.Split(U' ')[5].size() == 4);
+  }
+
   SECTION("trimming") {
     REQUIRE(gd::String("").Trim() == "");
     REQUIRE(gd::String("").LeftTrim() == "");
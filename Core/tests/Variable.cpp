@@ -12,6 +12,7 @@
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/VariablesContainer.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "catch.hpp"
 
 TEST_CASE("Variable", "[common][variables]") {
@@ -91,4 +92,90 @@ TEST_CASE("Variable", "[common][variables]") {
             "Hello second copied World");
     REQUIRE(variable3.GetChild("Child2").GetValue() == 44);
   }
+  SECTION("Assignment of arrays") {
+    gd::Variable variable1;
+    gd::Variable variable2;
+
+    variable1.PushNew().SetValue(1);
+    variable1.PushNew().SetValue(2);
+    variable2.PushNew().SetValue(3);
+
+    variable2 = variable1;
+    REQUIRE(variable2.GetChildrenCount() == 2);
+    REQUIRE(variable2.GetAtIndex(0).GetValue() == 1);
+    REQUIRE(variable2.GetAtIndex(1).GetValue() == 2);
+
+    variable2.GetAtIndex(1).SetValue(4);
+    REQUIRE(variable1.GetAtIndex(1).GetValue() == 2);
+  }
+  SECTION("Children are created when accessed") {
+    gd::Variable variable;
+    variable.GetChild("b").SetValue(2);
+    variable.GetChild("a").SetValue(1);
+    variable.GetChild("c").SetValue(3);
+    variable.GetChild("b").SetValue(4);
+
+    REQUIRE(variable.GetType() == gd::Variable::Type::Structure);
+    REQUIRE(variable.GetChildrenCount() == 3);
+    REQUIRE(variable.GetAllChildrenNames() ==
+            std::vector<gd::String>({"a", "b", "c"}));
+    REQUIRE(variable.GetChild("b").GetValue() == 4);
+  }
+  SECTION("Children are found after being renamed, removed or copied") {
+    gd::Variable variable;
+    gd::Variable &child = variable.GetChild("a");
+    child.SetValue(1);
+    variable.GetChild("b").SetValue(2);
+
+    REQUIRE(variable.RenameChild("a", "c") == true);
+    REQUIRE(variable.HasChild("a") == false);
+    REQUIRE(&variable.GetChild("c") == &child);
+    REQUIRE(variable.GetChildrenCount() == 2);
+
+    variable.RemoveChild("b");
+    REQUIRE(variable.HasChild("b") == false);
+    REQUIRE(variable.GetAllChildrenNames() == std::vector<gd::String>({"c"}));
+
+    gd::Variable copiedVariable(variable);
+    copiedVariable.GetChild("d").SetValue(4);
+    REQUIRE(copiedVariable.GetChild("c").GetValue() == 1);
+    REQUIRE(&copiedVariable.GetChild("c") != &child);
+    REQUIRE(copiedVariable.GetChildrenCount() == 2);
+    REQUIRE(variable.HasChild("d") == false);
+
+    copiedVariable.RemoveRecursively(copiedVariable.GetChild("c"));
+    REQUIRE(copiedVariable.HasChild("c") == false);
+    REQUIRE(copiedVariable.GetChildrenCount() == 1);
+  }
+  SECTION("Children are found after being replaced by unserialization") {
+    gd::Variable variable;
+    variable.GetChild("a").SetValue(5);
+    REQUIRE(variable.HasChild("a") == true);
+
+    gd::Variable otherVariable;
+    otherVariable.GetChild("a").SetValue(1);
+    gd::SerializerElement element;
+    otherVariable.SerializeTo(element);
+
+    variable.UnserializeFrom(element);
+    REQUIRE(variable.GetChildrenCount() == 1);
+    REQUIRE(variable.GetChild("a").GetValue() == 1);
+    REQUIRE(variable.GetAllChildren().at("a")->GetValue() == 1);
+  }
+  SECTION("Children are kept when casting between structures and arrays") {
+    gd::Variable variable;
+    gd::Variable &first = variable.PushNew();
+    first.SetValue(1);
+    variable.PushNew().SetValue(2);
+
+    variable.CastTo(gd::Variable::Type::Structure);
+    REQUIRE(variable.HasChild("0") == true);
+    REQUIRE(&variable.GetChild("0") == &first);
+    REQUIRE(variable.GetChild("1").GetValue() == 2);
+
+    variable.CastTo(gd::Variable::Type::Array);
+    REQUIRE(variable.GetChildrenCount() == 2);
+    REQUIRE(&variable.GetAtIndex(0) == &first);
+    REQUIRE(variable.HasChild("0") == false);
+  }
 }
@@ -24,7 +24,7 @@ std::map<RuntimeScene*, ObjectsLinksManager> ObjectsLinksManager::managers;
 
 bool GD_EXTENSION_API PickObjectsLinkedTo(
     RuntimeScene& scene,
-    std::map<gd::String, std::vector<RuntimeObject*>*> pickedObjectsLists,
+    const RuntimeObjectsLists& pickedObjectsLists,
     RuntimeObject* object) {
   if (!object) return false;
 
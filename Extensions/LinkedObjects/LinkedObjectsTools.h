@@ -10,6 +10,7 @@ This project is released under the MIT License.
 #include <map>
 #include <string>
 #include <vector>
+#include "GDCpp/Runtime/RuntimeContext.h"
 #include "GDCpp/Runtime/String.h"
 class RuntimeObject;
 class RuntimeScene;
@@ -28,7 +29,7 @@ void GD_EXTENSION_API RemoveAllLinksOf(RuntimeScene &scene,
                                        RuntimeObject *object);
 bool GD_EXTENSION_API PickObjectsLinkedTo(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectsLists,
+    const RuntimeObjectsLists &pickedObjectsLists,
     RuntimeObject *object);
 
 }  // namespace LinkedObjects
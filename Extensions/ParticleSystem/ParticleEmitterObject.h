@@ -343,6 +343,9 @@ class GD_EXTENSION_API RuntimeParticleEmitterObject
   }
 
   virtual bool Draw(sf::RenderTarget& renderTarget);
+  virtual bool IsDrawnInsideAABB() const {
+    return false;
+  };  ///< Particles go outside of the emitter.
 
   virtual void OnPositionChanged();
 
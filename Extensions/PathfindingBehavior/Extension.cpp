@@ -391,6 +391,39 @@ void DeclarePathfindingBehaviorExtension(gd::PlatformExtension& extension) {
         .SetFunctionName("IsObjectRotated")
         .SetIncludeFile("PathfindingBehavior/PathfindingRuntimeBehavior.h");
 
+    aut.AddAction("UseJumpPointSearch",
+                  _("Jump point search"),
+                  _("Enable or disable jump point search to compute the "
+                    "paths. It is only used when diagonal movement is "
+                    "allowed and the obstacles are all impassable. Only "
+                    "supported by native games: HTML5 games always use the "
+                    "default search."),
+                  _("Use jump point search for _PARAM0_: _PARAM2_"),
+                  _("Pathfinding configuration"),
+                  "CppPlatform/Extensions/AStaricon24.png",
+                  "CppPlatform/Extensions/AStaricon16.png")
+
+        .AddParameter("object", _("Object"))
+        .AddParameter("behavior", _("Behavior"), "PathfindingBehavior")
+        .AddParameter("yesorno", _("Use jump point search?"))
+        .SetFunctionName("SetUseJumpPointSearch")
+        .SetIncludeFile("PathfindingBehavior/PathfindingRuntimeBehavior.h");
+
+    aut.AddCondition("JumpPointSearchUsed",
+                     _("Jump point search"),
+                     _("Check if jump point search is used to compute the "
+                       "paths of the object. Only supported by native games: "
+                       "HTML5 games always use the default search."),
+                     _("_PARAM0_ uses jump point search"),
+                     _("Pathfinding configuration"),
+                     "CppPlatform/Extensions/AStaricon24.png",
+                     "CppPlatform/Extensions/AStaricon16.png")
+
+        .AddParameter("object", _("Object"))
+        .AddParameter("behavior", _("Behavior"), "PathfindingBehavior")
+        .SetFunctionName("UsesJumpPointSearch")
+        .SetIncludeFile("PathfindingBehavior/PathfindingRuntimeBehavior.h");
+
     aut.AddExpression("GetNodeX",
                       _("Get a waypoint X position"),
                       _("Get next waypoint X position"),
@@ -105,6 +105,12 @@ class PathfindingBehaviorJsExtension : public gd::PlatformExtension {
           "setRotateObject");
       autConditions["PathfindingBehavior::ObjectRotated"].SetFunctionName(
           "isObjectRotated");
+      // Jump point search is not implemented by the JS runtime behavior: the
+      // setting is only stored so that it can be checked by events.
+      autActions["PathfindingBehavior::UseJumpPointSearch"].SetFunctionName(
+          "setUseJumpPointSearch");
+      autConditions["PathfindingBehavior::JumpPointSearchUsed"]
+          .SetFunctionName("usesJumpPointSearch");
 
       autExpressions["GetNodeX"].SetFunctionName("getNodeX");
       autExpressions["GetNodeY"].SetFunctionName("getNodeY");
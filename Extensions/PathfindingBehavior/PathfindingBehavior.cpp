@@ -24,6 +24,7 @@ void PathfindingBehavior::InitializeContent(
   behaviorContent.SetAttribute("gridOffsetX", 0);
   behaviorContent.SetAttribute("gridOffsetY", 0);
   behaviorContent.SetAttribute("extraBorder", 0);
+  behaviorContent.SetAttribute("useJumpPointSearch", false);
 }
 
 #if defined(GD_IDE_ONLY)
@@ -57,6 +58,13 @@ std::map<gd::String, gd::PropertyDescriptor> PathfindingBehavior::GetProperties(
       gd::String::From(behaviorContent.GetDoubleAttribute("gridOffsetY", 0)));
   properties[_("Extra border size")].SetValue(
       gd::String::From(behaviorContent.GetDoubleAttribute("extraBorder")));
+  properties[_("Use jump point search")]
+      .SetValue(behaviorContent.GetBoolAttribute("useJumpPointSearch", false)
+                    ? "true"
+                    : "false")
+      .SetType("Boolean")
+      .SetDescription(_("Only supported by native games: HTML5 games always "
+                        "use the default search."));
 
   return properties;
 }
@@ -72,6 +80,10 @@ bool PathfindingBehavior::UpdateProperty(gd::SerializerElement& behaviorContent,
     behaviorContent.SetAttribute("rotateObject", (value != "0"));
     return true;
   }
+  if (name == _("Use jump point search")) {
+    behaviorContent.SetAttribute("useJumpPointSearch", (value != "0"));
+    return true;
+  }
   if (name == _("Extra border size")) {
     behaviorContent.SetAttribute("extraBorder", value.To<float>());
     return true;
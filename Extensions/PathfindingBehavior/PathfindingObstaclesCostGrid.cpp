@@ -0,0 +1,119 @@
+/**
+
+GDevelop - Pathfinding Behavior Extension
+Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+#include "PathfindingObstaclesCostGrid.h"
+#include <algorithm>
+#include <cmath>
+
+PathfindingObstaclesCostGrid::PathfindingObstaclesCostGrid(float cellWidth_,
+                                                           float cellHeight_,
+                                                           float leftBorder_,
+                                                           float topBorder_,
+                                                           float rightBorder_,
+                                                           float bottomBorder_)
+    : passableObstaclesCount(0),
+      lastChunkValid(false),
+      lastChunkKey(0),
+      lastChunk(NULL),
+      cellWidth(cellWidth_),
+      cellHeight(cellHeight_),
+      leftBorder(leftBorder_),
+      topBorder(topBorder_),
+      rightBorder(rightBorder_),
+      bottomBorder(bottomBorder_) {}
+
+bool PathfindingObstaclesCostGrid::Matches(float cellWidth_,
+                                           float cellHeight_,
+                                           float leftBorder_,
+                                           float topBorder_,
+                                           float rightBorder_,
+                                           float bottomBorder_) const {
+  return cellWidth == cellWidth_ && cellHeight == cellHeight_ &&
+         leftBorder == leftBorder_ && topBorder == topBorder_ &&
+         rightBorder == rightBorder_ && bottomBorder == bottomBorder_;
+}
+
+float PathfindingObstaclesCostGrid::GetCost(int cellX, int cellY) const {
+  int chunkX = GetChunkCoordinate(cellX);
+  int chunkY = GetChunkCoordinate(cellY);
+  std::uint64_t key = GetChunkKey(chunkX, chunkY);
+  if (!lastChunkValid || lastChunkKey != key) {
+    auto it = chunks.find(key);
+    lastChunk = it != chunks.end() ? &it->second : NULL;
+    lastChunkKey = key;
+    lastChunkValid = true;
+  }
+
+  if (!lastChunk) return 1;  // No obstacles around the cell.
+
+  const Cell& cell = lastChunk->cells[(cellY - chunkY * chunkSize) * chunkSize +
+                                      (cellX - chunkX * chunkSize)];
+  if (cell.impassableObstaclesCount > 0) return -1;
+  if (cell.obstaclesCount > 0) return cell.costsSum;
+
+  return 1;  // Default cost when no objects put on the cell.
+}
+
+void PathfindingObstaclesCostGrid::UpdateCells(
+    const PathfindingObstacleBounds& obstacle, int direction) {
+  if (!obstacle.impassable) passableObstaclesCount += direction;
+
+  // The obstacle covers the cells strictly between these cells.
+  int topLeftCellX = floor((obstacle.x - rightBorder) / cellWidth);
+  int topLeftCellY = floor((obstacle.y - bottomBorder) / cellHeight);
+  int bottomRightCellX =
+      ceil((obstacle.x + obstacle.width + leftBorder) / cellWidth);
+  int bottomRightCellY =
+      ceil((obstacle.y + obstacle.height + topBorder) / cellHeight);
+  if (topLeftCellX + 1 >= bottomRightCellX ||
+      topLeftCellY + 1 >= bottomRightCellY)
+    return;
+
+  int firstCellX = topLeftCellX + 1;
+  int firstCellY = topLeftCellY + 1;
+  int lastCellX = bottomRightCellX - 1;
+  int lastCellY = bottomRightCellY - 1;
+  lastChunkValid = false;
+
+  for (int chunkY = GetChunkCoordinate(firstCellY);
+       chunkY <= GetChunkCoordinate(lastCellY);
+       ++chunkY) {
+    for (int chunkX = GetChunkCoordinate(firstCellX);
+         chunkX <= GetChunkCoordinate(lastCellX);
+         ++chunkX) {
+      std::uint64_t key = GetChunkKey(chunkX, chunkY);
+      auto it = chunks.find(key);
+      if (it == chunks.end()) {
+        if (direction < 0) continue;  // Nothing to remove.
+        it = chunks.emplace(key, Chunk()).first;
+      }
+      Chunk& chunk = it->second;
+
+      int startX = std::max(firstCellX, chunkX * chunkSize);
+      int endX = std::min(lastCellX, chunkX * chunkSize + chunkSize - 1);
+      int startY = std::max(firstCellY, chunkY * chunkSize);
+      int endY = std::min(lastCellY, chunkY * chunkSize + chunkSize - 1);
+      for (int y = startY; y <= endY; ++y) {
+        Cell* cell = &chunk.cells[(y - chunkY * chunkSize) * chunkSize +
+                                  (startX - chunkX * chunkSize)];
+        for (int x = startX; x <= endX; ++x, ++cell) {
+          cell->obstaclesCount += direction;
+          if (obstacle.impassable)
+            cell->impassableObstaclesCount += direction;
+          else
+            cell->costsSum += direction * obstacle.cost;
+
+          // Avoid accumulating rounding errors when obstacles are moved.
+          if (cell->obstaclesCount == cell->impassableObstaclesCount)
+            cell->costsSum = 0;
+        }
+      }
+
+      chunk.obstaclesCount += direction;
+      if (chunk.obstaclesCount == 0) chunks.erase(it);
+    }
+  }
+}
@@ -0,0 +1,152 @@
+/**
+
+GDevelop - Pathfinding Behavior Extension
+Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+#ifndef PATHFINDINGOBSTACLESCOSTGRID_H
+#define PATHFINDINGOBSTACLESCOSTGRID_H
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \brief The position and the properties of an obstacle, as rasterized in a
+ * PathfindingObstaclesCostGrid.
+ */
+struct PathfindingObstacleBounds {
+  float x;  ///< The drawable X position of the obstacle object.
+  float y;  ///< The drawable Y position of the obstacle object.
+  float width;
+  float height;
+  bool impassable;
+  float cost;
+
+  bool operator==(const PathfindingObstacleBounds& other) const {
+    return x == other.x && y == other.y && width == other.width &&
+           height == other.height && impassable == other.impassable &&
+           cost == other.cost;
+  }
+  bool operator!=(const PathfindingObstacleBounds& other) const {
+    return !(*this == other);
+  }
+};
+
+/**
+ * \brief The cost of moving on each cell of a scene, for a given cell size and
+ * a given size of the moving object.
+ *
+ * Obstacles are rasterized in the grid when added, and removed from it using
+ * the same bounds, so that the grid can be updated incrementally when
+ * obstacles are moved. Cells are stored by chunks, only where there are
+ * obstacles.
+ *
+ * \see ScenePathfindingObstaclesManager::GetCostGrid
+ */
+class GD_EXTENSION_API PathfindingObstaclesCostGrid {
+ public:
+  /**
+   * \brief Create an empty grid.
+   *
+   * The borders are the size of the moving object around its position: an
+   * obstacle covers a cell if the object, positioned on the cell, would
+   * overlap the obstacle.
+   */
+  PathfindingObstaclesCostGrid(float cellWidth,
+                               float cellHeight,
+                               float leftBorder,
+                               float topBorder,
+                               float rightBorder,
+                               float bottomBorder);
+
+  /**
+   * \brief Return true if the grid was created with these parameters.
+   */
+  bool Matches(float cellWidth,
+               float cellHeight,
+               float leftBorder,
+               float topBorder,
+               float rightBorder,
+               float bottomBorder) const;
+
+  /**
+   * \brief Add the cost of an obstacle to the cells it covers.
+   */
+  void AddObstacle(const PathfindingObstacleBounds& obstacle) {
+    UpdateCells(obstacle, 1);
+  }
+
+  /**
+   * \brief Remove the cost of an obstacle from the cells it covers.
+   * \note The bounds must be the same as the one used to add the obstacle.
+   */
+  void RemoveObstacle(const PathfindingObstacleBounds& obstacle) {
+    UpdateCells(obstacle, -1);
+  }
+
+  /**
+   * \brief Return the cost of moving on a cell: -1 if the cell is covered by
+   * an impassable obstacle, the sum of the costs of the obstacles covering it
+   * otherwise, or 1 if there is no obstacle on the cell.
+   */
+  float GetCost(int cellX, int cellY) const;
+
+  /**
+   * \brief Return true if all the cells that are not impassable have the same
+   * cost, i.e: there are only impassable obstacles.
+   */
+  bool HasUniformCosts() const { return passableObstaclesCount == 0; }
+
+  /**
+   * \brief Return the number of chunks of cells allocated in the grid.
+   */
+  std::size_t GetChunksCount() const { return chunks.size(); }
+
+ private:
+  struct Cell {
+    Cell() : obstaclesCount(0), impassableObstaclesCount(0), costsSum(0) {}
+
+    std::int32_t obstaclesCount;
+    std::int32_t impassableObstaclesCount;
+    double costsSum;  ///< The sum of the costs of passable obstacles.
+  };
+
+  struct Chunk {
+    Chunk() : cells(chunkSize * chunkSize), obstaclesCount(0) {}
+
+    std::vector<Cell> cells;
+    std::size_t obstaclesCount;  ///< The number of obstacles covering at least
+                                 ///< a cell of the chunk.
+  };
+
+  void UpdateCells(const PathfindingObstacleBounds& obstacle, int direction);
+
+  static int GetChunkCoordinate(int cellCoordinate) {
+    return cellCoordinate >= 0 ? cellCoordinate / chunkSize
+                               : (cellCoordinate + 1) / chunkSize - 1;
+  }
+
+  static std::uint64_t GetChunkKey(int chunkX, int chunkY) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(chunkX))
+            << 32) |
+           static_cast<std::uint32_t>(chunkY);
+  }
+
+  static const int chunkSize = 16;  ///< The size of a chunk, in cells.
+
+  std::unordered_map<std::uint64_t, Chunk> chunks;
+  std::size_t passableObstaclesCount;  ///< The number of obstacles that are
+                                       ///< not impassable.
+  mutable bool lastChunkValid;  ///< True if lastChunk is the chunk at
+                                ///< lastChunkKey (NULL if not allocated).
+  mutable std::uint64_t lastChunkKey;
+  mutable const Chunk* lastChunk;
+  float cellWidth;
+  float cellHeight;
+  float leftBorder;
+  float topBorder;
+  float rightBorder;
+  float bottomBorder;
+};
+
+#endif  // PATHFINDINGOBSTACLESCOSTGRID_H
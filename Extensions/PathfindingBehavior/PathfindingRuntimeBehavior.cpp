@@ -10,8 +10,6 @@ This project is released under the MIT License.
 #include <cmath>
 #include <iostream>
 #include <memory>
-#include <set>
-#include <unordered_map>
 #include "GDCore/Tools/Localization.h"
 #include "GDCpp/Extensions/Builtin/MathematicalTools.h"
 #include "GDCpp/Runtime/CommonTools.h"
@@ -20,99 +18,12 @@ This project is released under the MIT License.
 #include "GDCpp/Runtime/RuntimeScene.h"
 #include "GDCpp/Runtime/Serialization/SerializerElement.h"
 #include "PathfindingObstacleRuntimeBehavior.h"
+#include "PathfindingObstaclesCostGrid.h"
+#include "PathfindingSearchWorkspace.h"
 #include "ScenePathfindingObstaclesManager.h"
 
-/**
- * \brief Internal tool class representing the position of a node when looking
- * for a path.
- */
-class NodePosition {
- public:
-  NodePosition(int x_, int y_) : x(x_), y(y_){};
-
-  int x;
-  int y;
-};
-
-std::ostream& operator<<(std::ostream& stream, const NodePosition& nodePos) {
-  stream << nodePos.x << ";" << nodePos.y;
-  return stream;
-}
-
-bool operator==(const NodePosition& a, const NodePosition& b) {
-  return ((a.x == b.x) && (a.y == b.y));
-}
-
-namespace std {
-/**
- * \brief Tool function used to store a NodePosition as key in
- * std::unordered_set.
- */
-template <>
-struct hash<NodePosition> {
-  std::size_t operator()(NodePosition const& n) const {
-    return (std::hash<int>()(n.x)) ^ (std::hash<int>()(n.y) << 1);
-  }
-};
-
-}  // namespace std
-
 namespace {
-/**
- * \brief Internal tool class representing a node when looking for a path
- */
-class Node {
- public:
-  Node()
-      : pos(0, 0),
-        cost(0),
-        smallestCost(-1),
-        estimateCost(-1),
-        parent(NULL),
-        open(true){};
-  Node(int x, int y)
-      : pos(x, y),
-        cost(0),
-        smallestCost(-1),
-        estimateCost(-1),
-        parent(NULL),
-        open(true){};
-  Node(const NodePosition& pos_)
-      : pos(pos_),
-        cost(0),
-        smallestCost(-1),
-        estimateCost(-1),
-        parent(NULL),
-        open(true){};
-
-  NodePosition pos;
-  float cost;          ///< The cost for traveling on this node
-  float smallestCost;  ///< the cost to go to this node (when considering the
-                       ///< shortest path).
-  float estimateCost;  ///< the estimate cost total to go to the destination
-                       ///< through this node (when considering the shortest
-                       ///< path).
-  const Node* parent;  ///< The previous node to be visited to go to this node
-                       ///< (when considering the shortest path).
-  bool open;  ///< true if the node is "open" (must be explored), false if
-              ///< "close" (already explored)
-
-  /**
-   * \brief Tool function used to store a Node in a priority_queue.
-   */
-  class NodeComparator {
-   public:
-    bool operator()(const Node* n1, const Node* n2) {
-      return n1->estimateCost < n2->estimateCost;
-    }
-  };
-};
-
-bool operator==(Node const& n1, Node const& n2) {
-  return n1.pos.x == n2.pos.x && n1.pos.y == n2.pos.y;
-};
-
-typedef float (*DistanceFunPtr)(const NodePosition&, const NodePosition&);
+typedef float (*DistanceFunPtr)(int, int, int, int);
 
 /**
  * \brief Internal tool class containing the structures used by A* and members
@@ -120,21 +31,25 @@ typedef float (*DistanceFunPtr)(const NodePosition&, const NodePosition&);
  */
 class SearchContext {
  public:
-  SearchContext(ScenePathfindingObstaclesManager& obstacles_,
+  SearchContext(const PathfindingObstaclesCostGrid& costGrid_,
+                PathfindingSearchWorkspace& workspace_,
                 bool allowsDiagonal_ = true)
-      : obstacles(obstacles_),
-        finalNode(NULL),
-        destination(0, 0),
+      : costGrid(costGrid_),
+        workspace(workspace_),
+        finalNode(PathfindingSearchWorkspace::noNode),
+        destinationX(0),
+        destinationY(0),
         startX(0),
         startY(0),
         allowsDiagonal(allowsDiagonal_),
+        useJumpPointSearch(false),
         maxComplexityFactor(50),
         cellWidth(20),
         cellHeight(20),
-        leftBorder(0),
-        rightBorder(0),
-        topBorder(0),
-        bottomBorder(0) {
+        jumpMinX(0),
+        jumpMinY(0),
+        jumpMaxX(0),
+        jumpMaxY(0) {
     distanceFunction = allowsDiagonal ? &SearchContext::EuclideanDistance
                                       : &SearchContext::ManhattanDistance;
   }
@@ -151,21 +66,6 @@ class SearchContext {
     return *this;
   }
 
-  /**
-   * \brief Set the size to be considered for the object for which the path will
-   * be planned.
-   */
-  SearchContext& SetObjectSize(float leftBorder_,
-                               float topBorder_,
-                               float rightBorder_,
-                               float bottomBorder_) {
-    leftBorder = leftBorder_;
-    rightBorder = rightBorder_;
-    topBorder = topBorder_;
-    bottomBorder = bottomBorder_;
-    return *this;
-  }
-
   /**
    * \brief Change the size of a virtual cell, in pixels.
    */
@@ -176,6 +76,15 @@ class SearchContext {
     return *this;
   }
 
+  /**
+   * \brief Use jump point search, when diagonals are allowed and all the
+   * passable cells have the same cost.
+   */
+  SearchContext& SetUseJumpPointSearch(bool useJumpPointSearch_) {
+    useJumpPointSearch = useJumpPointSearch_;
+    return *this;
+  }
+
   /**
    * \brief Compute a path to the specified position, considering the obstacles
    * and the start position passed in the constructor.
@@ -185,157 +94,281 @@ class SearchContext {
    * coordinate on Y axis of the target position, in "world" coordinates.
    */
   bool ComputePathTo(float targetX, float targetY) {
-    destination = NodePosition(GDRound(targetX / cellWidth),
-                               GDRound(targetY / cellHeight));
-    NodePosition start(GDRound(startX / cellWidth),
-                       GDRound(startY / cellHeight));
-
-    // Initialize the algorithm
-    allNodes.clear();
-    Node& startNode = GetNode(start);
+    destinationX = GDRound(targetX / cellWidth);
+    destinationY = GDRound(targetY / cellHeight);
+
+    // Jump point search only explores an area around the start and the
+    // destination: if it fails, fall back to A*.
+    if (useJumpPointSearch && allowsDiagonal && costGrid.HasUniformCosts() &&
+        ComputePathWithJumpPoints())
+      return true;
+
+    return ComputePathWithAStar();
+  }
+
+  /**
+   * @return The index, in the workspace, of the final node of the computed
+   * path. Iterate on the parent member to create the path. Beware, the
+   * coordinates of the node must be multiplied by the cell size to get the
+   * "world" coordinates of the path.
+   */
+  std::uint32_t GetFinalNode() const { return finalNode; }
+
+ private:
+  bool ComputePathWithAStar() {
+    int startCellX = GDRound(startX / cellWidth);
+    int startCellY = GDRound(startY / cellHeight);
+
+    // Initialize the algorithm (the workspace grows if the explored area is
+    // larger than the cells around the start).
+    workspace.Reset(startCellX - searchMargin,
+                    startCellY - searchMargin,
+                    startCellX + searchMargin,
+                    startCellY + searchMargin);
+    std::uint32_t startNodeIndex = GetNode(startCellX, startCellY);
+    PathfindingNode& startNode = workspace.GetNode(startNodeIndex);
     startNode.smallestCost = 0;
-    startNode.estimateCost = 0 + distanceFunction(start, destination);
-    openNodes.clear();
-    openNodes.insert(&startNode);
+    startNode.estimateCost =
+        0 + distanceFunction(
+                startCellX, startCellY, destinationX, destinationY);
+    workspace.InsertOrUpdateOpenNode(startNodeIndex);
 
     // A* algorithm main loop
     std::size_t iterationCount = 0;
     std::size_t maxIterationCount =
         startNode.estimateCost * maxComplexityFactor;
-    while (!openNodes.empty()) {
+    while (!workspace.IsOpenListEmpty()) {
       if (iterationCount++ > maxIterationCount)
         return false;  // Make sure we do not search forever.
 
-      Node* n = *openNodes.begin();  // Get the most promising node...
-      n->open = false;               //...and flag it as explored
-      openNodes.erase(
-          openNodes.begin());  // Be sure to remove ONLY the first element!
+      // Get the most promising node and flag it as explored
+      std::uint32_t nodeIndex = workspace.PopOpenNode();
+      PathfindingNode& n = workspace.GetNode(nodeIndex);
+      n.open = false;
 
       // Check if we reached destination?
-      if (n->pos.x == destination.x && n->pos.y == destination.y) {
-        finalNode = n;
+      if (n.x == destinationX && n.y == destinationY) {
+        finalNode = nodeIndex;
         return true;
       }
 
       // No, so add neighbors to the nodes to explore.
-      InsertNeighbors(*n);
+      InsertNeighbors(nodeIndex);
     }
 
     return false;
   }
 
-  /**
-   * @return The final node of the computed path.
-   * Iterate on the parent member to create the path. Beware, the coordinates of
-   * the node must be multiplied by the cell size to get the "world" coordinates
-   * of the path.
-   */
-  Node* GetFinalNode() const { return finalNode; }
-
- private:
   /**
    * Insert the neighbors of the current node in the open list
    * (Only if they are not closed, and if the cost is better than the already
    * existing smallest cost).
    */
-  void InsertNeighbors(const Node& currentNode) {
-    AddOrUpdateNode(
-        NodePosition(currentNode.pos.x + 1, currentNode.pos.y), currentNode, 1);
-    AddOrUpdateNode(
-        NodePosition(currentNode.pos.x - 1, currentNode.pos.y), currentNode, 1);
-    AddOrUpdateNode(
-        NodePosition(currentNode.pos.x, currentNode.pos.y + 1), currentNode, 1);
-    AddOrUpdateNode(
-        NodePosition(currentNode.pos.x, currentNode.pos.y - 1), currentNode, 1);
+  void InsertNeighbors(std::uint32_t currentNodeIndex) {
+    // Nodes are copied when created: don't keep a reference to the current
+    // node.
+    const PathfindingNode currentNode = workspace.GetNode(currentNodeIndex);
+    int x = currentNode.x;
+    int y = currentNode.y;
+    AddOrUpdateNode(x + 1, y, currentNodeIndex, currentNode, 1);
+    AddOrUpdateNode(x - 1, y, currentNodeIndex, currentNode, 1);
+    AddOrUpdateNode(x, y + 1, currentNodeIndex, currentNode, 1);
+    AddOrUpdateNode(x, y - 1, currentNodeIndex, currentNode, 1);
     if (allowsDiagonal) {
-      AddOrUpdateNode(
-          NodePosition(currentNode.pos.x + 1, currentNode.pos.y + 1),
-          currentNode,
-          sqrt2);
-      AddOrUpdateNode(
-          NodePosition(currentNode.pos.x + 1, currentNode.pos.y - 1),
-          currentNode,
-          sqrt2);
-      AddOrUpdateNode(
-          NodePosition(currentNode.pos.x - 1, currentNode.pos.y - 1),
-          currentNode,
-          sqrt2);
-      AddOrUpdateNode(
-          NodePosition(currentNode.pos.x - 1, currentNode.pos.y + 1),
-          currentNode,
-          sqrt2);
+      AddOrUpdateNode(x + 1, y + 1, currentNodeIndex, currentNode, sqrt2);
+      AddOrUpdateNode(x + 1, y - 1, currentNodeIndex, currentNode, sqrt2);
+      AddOrUpdateNode(x - 1, y - 1, currentNodeIndex, currentNode, sqrt2);
+      AddOrUpdateNode(x - 1, y + 1, currentNodeIndex, currentNode, sqrt2);
     }
   }
 
   /**
-   * \brief Get (or dynamically construct) a node.
+   * \brief Compute a path using jump point search: straight and diagonal
+   * lines of cells are skipped until a cell where the path could turn is
+   * found, so that much fewer nodes are created and opened than with A*.
    *
-   * *All* nodes should be created using this method: The cost of the node is
-   * computed thanks to the objects flagged as obstacles.
+   * Only valid when all the passable cells have the same cost. Cells outside
+   * of an area around the start and the destination are considered as
+   * impassable.
    */
-  Node& GetNode(const NodePosition& pos) {
-    if (allNodes.find(pos) != allNodes.end()) return allNodes.find(pos)->second;
-
-    Node newNode(pos);
-
-    bool objectsOnCell = false;
-    const std::set<PathfindingObstacleRuntimeBehavior*>& allObstacles =
-        obstacles.GetAllObstacles();
-    for (std::set<PathfindingObstacleRuntimeBehavior*>::const_iterator it =
-             allObstacles.begin();
-         it != allObstacles.end();
-         ++it) {
-      RuntimeObject* obj = (*it)->GetObject();
-      int topLeftCellX =
-          floor((obj->GetDrawableX() - rightBorder) / (float)cellWidth);
-      int topLeftCellY =
-          floor((obj->GetDrawableY() - bottomBorder) / (float)cellHeight);
-      int bottomRightCellX =
-          ceil((obj->GetDrawableX() + obj->GetWidth() + leftBorder) /
-               (float)cellWidth);
-      int bottomRightCellY =
-          ceil((obj->GetDrawableY() + obj->GetHeight() + topBorder) /
-               (float)cellHeight);
-      if (topLeftCellX < pos.x && pos.x < bottomRightCellX &&
-          topLeftCellY < pos.y && pos.y < bottomRightCellY) {
-        objectsOnCell = true;
-        if ((*it)->IsImpassable()) {
-          newNode.cost = -1;
-          break;  // The cell is impassable, stop here.
-        } else    // Superimpose obstacles
-          newNode.cost += (*it)->GetCost();
+  bool ComputePathWithJumpPoints() {
+    int startCellX = GDRound(startX / cellWidth);
+    int startCellY = GDRound(startY / cellHeight);
+    int margin = std::max(std::max(std::abs(destinationX - startCellX),
+                                   std::abs(destinationY - startCellY)),
+                          searchMargin);
+    jumpMinX = std::min(startCellX, destinationX) - margin;
+    jumpMinY = std::min(startCellY, destinationY) - margin;
+    jumpMaxX = std::max(startCellX, destinationX) + margin;
+    jumpMaxY = std::max(startCellY, destinationY) + margin;
+
+    workspace.Reset(startCellX - searchMargin,
+                    startCellY - searchMargin,
+                    startCellX + searchMargin,
+                    startCellY + searchMargin);
+    std::uint32_t startNodeIndex = GetNode(startCellX, startCellY);
+    PathfindingNode& startNode = workspace.GetNode(startNodeIndex);
+    startNode.smallestCost = 0;
+    startNode.estimateCost = EuclideanDistance(
+        startCellX, startCellY, destinationX, destinationY);
+    workspace.InsertOrUpdateOpenNode(startNodeIndex);
+
+    while (!workspace.IsOpenListEmpty()) {
+      std::uint32_t nodeIndex = workspace.PopOpenNode();
+      PathfindingNode& n = workspace.GetNode(nodeIndex);
+      n.open = false;
+
+      if (n.x == destinationX && n.y == destinationY) {
+        finalNode = nodeIndex;
+        return true;
       }
+
+      InsertJumpPoints(nodeIndex);
     }
 
-    if (!objectsOnCell)
-      newNode.cost = 1;  // Default cost when no objects put on the cell.
+    return false;
+  }
+
+  /**
+   * Insert in the open list the jump points reachable from the current node,
+   * in the directions that can't be reached more directly by its parent.
+   */
+  void InsertJumpPoints(std::uint32_t currentNodeIndex) {
+    const PathfindingNode currentNode = workspace.GetNode(currentNodeIndex);
+    int x = currentNode.x;
+    int y = currentNode.y;
+
+    int directions[8][2];
+    std::size_t directionsCount = 0;
+    auto addDirection = [&directions, &directionsCount](int dx, int dy) {
+      directions[directionsCount][0] = dx;
+      directions[directionsCount][1] = dy;
+      directionsCount++;
+    };
+
+    if (currentNode.parent == PathfindingSearchWorkspace::noNode) {
+      for (int dx = -1; dx <= 1; ++dx)
+        for (int dy = -1; dy <= 1; ++dy)
+          if (dx != 0 || dy != 0) addDirection(dx, dy);
+    } else {
+      const PathfindingNode& parent = workspace.GetNode(currentNode.parent);
+      int dx = (x > parent.x) - (x < parent.x);
+      int dy = (y > parent.y) - (y < parent.y);
+      if (dx != 0 && dy != 0) {
+        addDirection(0, dy);
+        addDirection(dx, 0);
+        addDirection(dx, dy);
+        if (!IsWalkable(x - dx, y)) addDirection(-dx, dy);
+        if (!IsWalkable(x, y - dy)) addDirection(dx, -dy);
+      } else if (dx != 0) {
+        addDirection(dx, 0);
+        if (!IsWalkable(x, y + 1)) addDirection(dx, 1);
+        if (!IsWalkable(x, y - 1)) addDirection(dx, -1);
+      } else {
+        addDirection(0, dy);
+        if (!IsWalkable(x + 1, y)) addDirection(1, dy);
+        if (!IsWalkable(x - 1, y)) addDirection(-1, dy);
+      }
+    }
 
-    allNodes[pos] = newNode;
-    return allNodes[pos];
+    for (std::size_t i = 0; i < directionsCount; ++i) {
+      int dx = directions[i][0];
+      int dy = directions[i][1];
+      int jumpX, jumpY;
+      if (!Jump(x, y, dx, dy, jumpX, jumpY)) continue;
+
+      int steps = std::max(std::abs(jumpX - x), std::abs(jumpY - y));
+      AddOrUpdateNode(jumpX,
+                      jumpY,
+                      currentNodeIndex,
+                      currentNode,
+                      (dx != 0 && dy != 0) ? steps * sqrt2 : steps);
+    }
+  }
+
+  /**
+   * \brief Move from a cell in the specified direction, until a jump point
+   * (the destination, or a cell with a neighbor that can only be reached
+   * optimally through it) is found.
+   * \return false if an impassable cell was reached before a jump point.
+   */
+  bool Jump(int x, int y, int dx, int dy, int& jumpX, int& jumpY) const {
+    while (true) {
+      x += dx;
+      y += dy;
+      if (!IsWalkable(x, y)) return false;
+      if (x == destinationX && y == destinationY) break;
+
+      if (dx != 0 && dy != 0) {
+        if ((!IsWalkable(x - dx, y) && IsWalkable(x - dx, y + dy)) ||
+            (!IsWalkable(x, y - dy) && IsWalkable(x + dx, y - dy)))
+          break;
+
+        // Diagonal moves stop where a straight move would find a jump point.
+        int straightJumpX, straightJumpY;
+        if (Jump(x, y, dx, 0, straightJumpX, straightJumpY) ||
+            Jump(x, y, 0, dy, straightJumpX, straightJumpY))
+          break;
+      } else if (dx != 0) {
+        if ((!IsWalkable(x, y + 1) && IsWalkable(x + dx, y + 1)) ||
+            (!IsWalkable(x, y - 1) && IsWalkable(x + dx, y - 1)))
+          break;
+      } else {
+        if ((!IsWalkable(x + 1, y) && IsWalkable(x + 1, y + dy)) ||
+            (!IsWalkable(x - 1, y) && IsWalkable(x - 1, y + dy)))
+          break;
+      }
+    }
+
+    jumpX = x;
+    jumpY = y;
+    return true;
+  }
+
+  bool IsWalkable(int x, int y) const {
+    return x >= jumpMinX && x <= jumpMaxX && y >= jumpMinY &&
+           y <= jumpMaxY && costGrid.GetCost(x, y) >= 0;
+  }
+
+  /**
+   * \brief Get (or dynamically construct) a node.
+   *
+   * *All* nodes should be created using this method: The cost of the node is
+   * read from the grid of the costs of the obstacles.
+   * \return The index of the node in the workspace.
+   */
+  std::uint32_t GetNode(int x, int y) {
+    std::uint32_t index = workspace.FindNode(x, y);
+    if (index != PathfindingSearchWorkspace::noNode) return index;
+
+    return workspace.CreateNode(x, y, costGrid.GetCost(x, y));
   }
 
   /**
    * Compute the euclidean distance between two positions.
    */
-  static float EuclideanDistance(const NodePosition& a, const NodePosition& b) {
-    return sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y));
+  static float EuclideanDistance(int ax, int ay, int bx, int by) {
+    return sqrt((ax - bx) * (ax - bx) + (ay - by) * (ay - by));
   }
 
   /**
    * Compute the taxi distance between two positions.
    */
-  static float ManhattanDistance(const NodePosition& a, const NodePosition& b) {
-    return abs(a.x - b.x) + abs(a.y - b.y);
+  static float ManhattanDistance(int ax, int ay, int bx, int by) {
+    return abs(ax - bx) + abs(ay - by);
   }
 
   /**
-   * Add a node to the openNodes (only if the cost to reach it is less than the
-   * existing cost, if any).
+   * Add a node to the open nodes (only if the cost to reach it is less than
+   * the existing cost, if any).
    */
-  void AddOrUpdateNode(const NodePosition& newNodePosition,
-                       const Node& currentNode,
+  void AddOrUpdateNode(int x,
+                       int y,
+                       std::uint32_t currentNodeIndex,
+                       const PathfindingNode& currentNode,
                        float factor) {
-    Node& neighbor = GetNode(newNodePosition);
+    std::uint32_t neighborIndex = GetNode(x, y);
+    PathfindingNode& neighbor = workspace.GetNode(neighborIndex);
     if (!neighbor.open ||
         neighbor.cost < 0)  // cost < 0 means impassable obstacle
       return;
@@ -346,51 +379,49 @@ class SearchContext {
         neighbor.smallestCost >
             currentNode.smallestCost +
                 (currentNode.cost + neighbor.cost) / 2.0 * factor) {
-      if (neighbor.smallestCost != -1)  // The node is already in the open list:
-      {
-        // remove it as its estimate cost will be updated.
-        auto it = openNodes.find(&neighbor);
-        if (it !=
-            openNodes.end())  // /!\ ALWAYS use an iterator with multiset::erase
-          openNodes.erase(it);  // otherwise, other nodes which are equivalent
-                                // get removed too.
-      }
-
       neighbor.smallestCost = currentNode.smallestCost +
                               (currentNode.cost + neighbor.cost) / 2.0 * factor;
-      neighbor.parent = &currentNode;
+      neighbor.parent = currentNodeIndex;
       neighbor.estimateCost =
-          neighbor.smallestCost + distanceFunction(neighbor.pos, destination);
+          neighbor.smallestCost +
+          distanceFunction(neighbor.x, neighbor.y, destinationX, destinationY);
 
-      openNodes.insert(&neighbor);
+      // Nodes already in the open list are moved according to their new
+      // estimate cost.
+      workspace.InsertOrUpdateOpenNode(neighborIndex);
     }
   }
 
-  std::unordered_map<NodePosition, Node> allNodes;  ///< All the nodes
-  std::multiset<Node*, Node::NodeComparator>
-      openNodes;  ///< Only the open nodes (Such that Node::open == true)
-  const ScenePathfindingObstaclesManager&
-      obstacles;    ///< A reference to all the obstacles of the scene
-  Node* finalNode;  // If computation succeeded, the final node is stored here.
-  NodePosition destination;
+  const PathfindingObstaclesCostGrid&
+      costGrid;  ///< The costs of the cells, given the obstacles
+  PathfindingSearchWorkspace& workspace;  ///< The nodes and the open list.
+  std::uint32_t finalNode;  // If computation succeeded, the index of the
+                            // final node is stored here.
+  int destinationX;
+  int destinationY;
   int startX;  ///< The start X position, in "world" coordinates (not in "node"
                ///< coordinates!).
   int startY;  ///< The start Y position, in "world" coordinates (not in "node"
                ///< coordinates!).
   DistanceFunPtr distanceFunction;
   bool allowsDiagonal;  ///< True to allow diagonals when planning the path.
+  bool useJumpPointSearch;
   std::size_t maxComplexityFactor;
   float cellWidth;
   float cellHeight;
-  float leftBorder;
-  float rightBorder;
-  float topBorder;
-  float bottomBorder;
+  int jumpMinX;  ///< The area explored by jump point search, in "node"
+                 ///< coordinates.
+  int jumpMinY;
+  int jumpMaxX;
+  int jumpMaxY;
 
   static const float sqrt2;
+  static const int searchMargin;  ///< The number of cells around the start
+                                  ///< initially covered by the workspace.
 };
 
 const float SearchContext::sqrt2 = 1.414213562;
+const int SearchContext::searchMargin = 8;
 
 }  // namespace
 
@@ -409,6 +440,7 @@ PathfindingRuntimeBehavior::PathfindingRuntimeBehavior(
       cellWidth(20),
       cellHeight(20),
       extraBorder(0),
+      useJumpPointSearch(false),
       speed(0),
       angularSpeed(0),
       timeOnSegment(0),
@@ -422,6 +454,8 @@ PathfindingRuntimeBehavior::PathfindingRuntimeBehavior(
   rotateObject = behaviorContent.GetBoolAttribute("rotateObject");
   angleOffset = behaviorContent.GetDoubleAttribute("angleOffset");
   extraBorder = behaviorContent.GetDoubleAttribute("extraBorder");
+  if (behaviorContent.HasAttribute("useJumpPointSearch"))
+    useJumpPointSearch = behaviorContent.GetBoolAttribute("useJumpPointSearch");
   {
     int value = behaviorContent.GetIntAttribute("cellWidth", 0);
     if (value > 0) cellWidth = value;
@@ -458,23 +492,28 @@ void PathfindingRuntimeBehavior::MoveTo(RuntimeScene& scene, float x, float y) {
 
   // Start searching for a path
   // TODO: Customizable heuristic.
-  ::SearchContext ctx(*sceneManager, allowDiagonals);
+  const PathfindingObstaclesCostGrid& costGrid = sceneManager->GetCostGrid(
+      cellWidth,
+      cellHeight,
+      object->GetX() - object->GetDrawableX() + extraBorder,
+      object->GetY() - object->GetDrawableY() + extraBorder,
+      object->GetWidth() - (object->GetX() - object->GetDrawableX()) +
+          extraBorder,
+      object->GetHeight() - (object->GetY() - object->GetDrawableY()) +
+          extraBorder);
+  PathfindingSearchWorkspace& workspace = sceneManager->GetSearchWorkspace();
+  ::SearchContext ctx(costGrid, workspace, allowDiagonals);
   ctx.SetCellSize(cellWidth, cellHeight)
-      .SetStartPosition(object->GetX(), object->GetY());
-  ctx.SetObjectSize(object->GetX() - object->GetDrawableX() + extraBorder,
-                    object->GetY() - object->GetDrawableY() + extraBorder,
-                    object->GetWidth() -
-                        (object->GetX() - object->GetDrawableX()) + extraBorder,
-                    object->GetHeight() -
-                        (object->GetY() - object->GetDrawableY()) +
-                        extraBorder);
+      .SetStartPosition(object->GetX(), object->GetY())
+      .SetUseJumpPointSearch(useJumpPointSearch);
   if (ctx.ComputePathTo(x, y)) {
     // Path found: memorize it
-    const ::Node* node = ctx.GetFinalNode();
-    while (node) {
-      path.push_back(sf::Vector2f(node->pos.x * (float)cellWidth,
-                                  node->pos.y * (float)cellHeight));
-      node = node->parent;
+    std::uint32_t nodeIndex = ctx.GetFinalNode();
+    while (nodeIndex != PathfindingSearchWorkspace::noNode) {
+      const PathfindingNode& node = workspace.GetNode(nodeIndex);
+      path.push_back(sf::Vector2f(node.x * (float)cellWidth,
+                                  node.y * (float)cellHeight));
+      nodeIndex = node.parent;
     }
 
     std::reverse(path.begin(), path.end());
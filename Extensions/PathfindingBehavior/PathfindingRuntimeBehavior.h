@@ -68,6 +68,7 @@ class GD_EXTENSION_API PathfindingRuntimeBehavior : public RuntimeBehavior {
   unsigned int GetCellWidth() { return cellWidth; };
   unsigned int GetCellHeight() { return cellHeight; };
   float GetExtraBorder() { return extraBorder; };
+  bool UsesJumpPointSearch() { return useJumpPointSearch; };
 
   void SetAllowDiagonals(bool allowDiagonals_) {
     allowDiagonals = allowDiagonals_;
@@ -83,6 +84,15 @@ class GD_EXTENSION_API PathfindingRuntimeBehavior : public RuntimeBehavior {
   void SetCellHeight(unsigned int cellHeight_) { cellHeight = cellHeight_; };
   void SetExtraBorder(float extraBorder_) { extraBorder = extraBorder_; };
 
+  /**
+   * \brief Use jump point search to compute paths, when diagonals are allowed
+   * and there are no obstacles with a cost on the scene (only impassable
+   * ones). Paths are then made only of the nodes where the object turns.
+   */
+  void SetUseJumpPointSearch(bool useJumpPointSearch_) {
+    useJumpPointSearch = useJumpPointSearch_;
+  };
+
   float GetSpeed() { return speed; };
   void SetSpeed(float speed_) { speed = speed_; };
 
@@ -109,6 +119,7 @@ class GD_EXTENSION_API PathfindingRuntimeBehavior : public RuntimeBehavior {
   unsigned int cellWidth;
   unsigned int cellHeight;
   float extraBorder;
+  bool useJumpPointSearch;
 
   // Attributes used for traveling on the path:
   float speed;
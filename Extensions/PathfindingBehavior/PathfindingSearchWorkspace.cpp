@@ -0,0 +1,193 @@
+/**
+
+GDevelop - Pathfinding Behavior Extension
+Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+#include "PathfindingSearchWorkspace.h"
+#include <algorithm>
+#include <limits>
+
+const std::uint32_t PathfindingSearchWorkspace::noNode =
+    std::numeric_limits<std::uint32_t>::max();
+const std::size_t PathfindingSearchWorkspace::maxWindowCellsCount = 1 << 20;
+const std::size_t PathfindingSearchWorkspace::maxKeptCellsCount = 1 << 18;
+
+PathfindingSearchWorkspace::PathfindingSearchWorkspace()
+    : useHashedCells(false),
+      generation(0),
+      nextOpenOrder(0),
+      windowX(0),
+      windowY(0),
+      windowWidth(0),
+      windowHeight(0) {}
+
+void PathfindingSearchWorkspace::Reset(int minX, int minY, int maxX, int maxY) {
+  nodes.clear();
+  openList.clear();
+  nextOpenOrder = 0;
+
+  // Release the memory used by a previous search that explored a large area.
+  if (useHashedCells) {
+    std::unordered_map<std::uint64_t, std::uint32_t>().swap(hashedCellNodes);
+    useHashedCells = false;
+  }
+  if (cellNodes.size() > maxKeptCellsCount) {
+    std::vector<std::uint32_t>().swap(cellNodes);
+    std::vector<std::uint32_t>().swap(cellGenerations);
+  }
+
+  SetWindow(minX, minY, maxX, maxY);
+}
+
+std::uint32_t PathfindingSearchWorkspace::FindHashedNode(int x, int y) const {
+  auto it = hashedCellNodes.find(GetCellKey(x, y));
+  return it != hashedCellNodes.end() ? it->second : noNode;
+}
+
+void PathfindingSearchWorkspace::SetWindow(std::int64_t minX,
+                                           std::int64_t minY,
+                                           std::int64_t maxX,
+                                           std::int64_t maxY) {
+  // The bounds and the size of the window are computed on 64 bits, so that
+  // they don't overflow (the end of the window must also fit in an int).
+  std::int64_t width = maxX - minX + 1;
+  std::int64_t height = maxY - minY + 1;
+  if (width * height > static_cast<std::int64_t>(maxWindowCellsCount) ||
+      minX < std::numeric_limits<int>::min() ||
+      minY < std::numeric_limits<int>::min() ||
+      maxX >= std::numeric_limits<int>::max() ||
+      maxY >= std::numeric_limits<int>::max()) {
+    useHashedCells = true;
+    hashedCellNodes.reserve(nodes.size() * 2);
+    for (std::uint32_t i = 0; i < nodes.size(); ++i)
+      hashedCellNodes[GetCellKey(nodes[i].x, nodes[i].y)] = i;
+
+    return;
+  }
+
+  windowX = minX;
+  windowY = minY;
+  windowWidth = width;
+  windowHeight = height;
+
+  std::size_t cellsCount =
+      static_cast<std::size_t>(windowWidth) * windowHeight;
+  if (cellsCount > cellNodes.size()) {
+    cellNodes.resize(cellsCount);
+    cellGenerations.resize(cellsCount, generation);
+  }
+
+  // Invalidate all the cells, without clearing them.
+  generation++;
+  if (generation == 0) {
+    std::fill(cellGenerations.begin(), cellGenerations.end(), 0);
+    generation = 1;
+  }
+
+  for (std::uint32_t i = 0; i < nodes.size(); ++i) {
+    std::size_t cell = GetCellIndex(nodes[i].x, nodes[i].y);
+    cellNodes[cell] = i;
+    cellGenerations[cell] = generation;
+  }
+}
+
+std::uint32_t PathfindingSearchWorkspace::CreateNode(int x, int y, float cost) {
+  if (!useHashedCells &&
+      (x < windowX || y < windowY || x >= windowX + windowWidth ||
+       y >= windowY + windowHeight)) {
+    // Grow the window in all directions, to avoid growing it too often.
+    std::int64_t growX = std::max(windowWidth, 8);
+    std::int64_t growY = std::max(windowHeight, 8);
+    SetWindow(std::min<std::int64_t>(x, windowX) - growX,
+              std::min<std::int64_t>(y, windowY) - growY,
+              std::max<std::int64_t>(x, windowX + windowWidth - 1) + growX,
+              std::max<std::int64_t>(y, windowY + windowHeight - 1) + growY);
+  }
+
+  PathfindingNode node;
+  node.x = x;
+  node.y = y;
+  node.cost = cost;
+  node.smallestCost = -1;
+  node.estimateCost = -1;
+  node.parent = noNode;
+  node.heapIndex = noNode;
+  node.openOrder = 0;
+  node.open = true;
+  nodes.push_back(node);
+
+  std::uint32_t index = nodes.size() - 1;
+  if (useHashedCells) {
+    hashedCellNodes[GetCellKey(x, y)] = index;
+    return index;
+  }
+
+  std::size_t cell = GetCellIndex(x, y);
+  cellNodes[cell] = index;
+  cellGenerations[cell] = generation;
+  return index;
+}
+
+void PathfindingSearchWorkspace::InsertOrUpdateOpenNode(std::uint32_t index) {
+  PathfindingNode& node = nodes[index];
+  node.openOrder = nextOpenOrder++;
+  if (node.heapIndex == noNode) {
+    node.heapIndex = openList.size();
+    openList.push_back(index);
+    SiftUp(node.heapIndex);
+  } else {
+    std::size_t heapIndex = node.heapIndex;
+    SiftUp(heapIndex);
+    SiftDown(nodes[index].heapIndex);
+  }
+}
+
+std::uint32_t PathfindingSearchWorkspace::PopOpenNode() {
+  std::uint32_t index = openList.front();
+  nodes[index].heapIndex = noNode;
+
+  openList.front() = openList.back();
+  openList.pop_back();
+  if (!openList.empty()) {
+    nodes[openList.front()].heapIndex = 0;
+    SiftDown(0);
+  }
+
+  return index;
+}
+
+void PathfindingSearchWorkspace::SiftUp(std::size_t heapIndex) {
+  std::uint32_t index = openList[heapIndex];
+  while (heapIndex > 0) {
+    std::size_t parentHeapIndex = (heapIndex - 1) / 2;
+    if (!IsBefore(index, openList[parentHeapIndex])) break;
+
+    openList[heapIndex] = openList[parentHeapIndex];
+    nodes[openList[heapIndex]].heapIndex = heapIndex;
+    heapIndex = parentHeapIndex;
+  }
+
+  openList[heapIndex] = index;
+  nodes[index].heapIndex = heapIndex;
+}
+
+void PathfindingSearchWorkspace::SiftDown(std::size_t heapIndex) {
+  std::uint32_t index = openList[heapIndex];
+  std::size_t size = openList.size();
+  while (true) {
+    std::size_t childHeapIndex = heapIndex * 2 + 1;
+    if (childHeapIndex >= size) break;
+    if (childHeapIndex + 1 < size &&
+        IsBefore(openList[childHeapIndex + 1], openList[childHeapIndex]))
+      childHeapIndex++;
+    if (!IsBefore(openList[childHeapIndex], index)) break;
+
+    openList[heapIndex] = openList[childHeapIndex];
+    nodes[openList[heapIndex]].heapIndex = heapIndex;
+    heapIndex = childHeapIndex;
+  }
+
+  openList[heapIndex] = index;
+  nodes[index].heapIndex = heapIndex;
+}
@@ -0,0 +1,171 @@
+/**
+
+GDevelop - Pathfinding Behavior Extension
+Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+#ifndef PATHFINDINGSEARCHWORKSPACE_H
+#define PATHFINDINGSEARCHWORKSPACE_H
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \brief A node (i.e: a cell) explored when looking for a path.
+ */
+struct PathfindingNode {
+  int x;
+  int y;
+  float cost;          ///< The cost for traveling on this node
+  float smallestCost;  ///< the cost to go to this node (when considering the
+                       ///< shortest path), or -1 if not reached yet.
+  float estimateCost;  ///< the estimate cost total to go to the destination
+                       ///< through this node (when considering the shortest
+                       ///< path).
+  std::uint32_t parent;  ///< The index of the previous node to be visited to
+                         ///< go to this node, or
+                         ///< PathfindingSearchWorkspace::noNode.
+  std::uint32_t heapIndex;  ///< The position of the node in the open list,
+                            ///< or PathfindingSearchWorkspace::noNode.
+  std::uint32_t openOrder;  ///< Used to pop nodes having the same estimate
+                            ///< cost in the order they were opened.
+  bool open;  ///< true if the node is "open" (must be explored), false if
+              ///< "close" (already explored)
+};
+
+/**
+ * \brief The structures used to search for paths, reused by all the searches
+ * done on a scene so that they don't allocate memory.
+ *
+ * Nodes are stored in a flat array, and found from their position using a
+ * window of cells covering the explored area. The window starts around the
+ * start of the search and is grown when a node is created outside of it.
+ * Cells are stamped with the generation of the search, so that they don't need
+ * to be cleared for a new search. If the window would be too large, nodes are
+ * found using a hash table instead.
+ *
+ * The open nodes are stored in an indexed binary heap, so that the estimate
+ * cost of a node can be updated without removing it.
+ */
+class GD_EXTENSION_API PathfindingSearchWorkspace {
+ public:
+  PathfindingSearchWorkspace();
+
+  /**
+   * \brief Remove all the nodes, and start a new search with a window
+   * covering the specified area (in cells).
+   *
+   * The area should be small (like the cells around the start of the search):
+   * the window is grown when needed.
+   */
+  void Reset(int minX, int minY, int maxX, int maxY);
+
+  /**
+   * \brief Return the index of the node at the specified position, or noNode
+   * if it was not created.
+   */
+  std::uint32_t FindNode(int x, int y) const {
+    if (useHashedCells) return FindHashedNode(x, y);
+    if (x < windowX || y < windowY || x >= windowX + windowWidth ||
+        y >= windowY + windowHeight)
+      return noNode;
+
+    std::size_t cell = GetCellIndex(x, y);
+    return cellGenerations[cell] == generation ? cellNodes[cell] : noNode;
+  }
+
+  /**
+   * \brief Create a new node at the specified position, which must not have a
+   * node already.
+   * \return The index of the new node.
+   */
+  std::uint32_t CreateNode(int x, int y, float cost);
+
+  PathfindingNode& GetNode(std::uint32_t index) { return nodes[index]; }
+  const PathfindingNode& GetNode(std::uint32_t index) const {
+    return nodes[index];
+  }
+  std::size_t GetNodesCount() const { return nodes.size(); }
+
+  /**
+   * \brief Return true if there are no open nodes.
+   */
+  bool IsOpenListEmpty() const { return openList.empty(); }
+
+  /**
+   * \brief Add a node to the open nodes, or update its position if its
+   * estimate cost was changed.
+   */
+  void InsertOrUpdateOpenNode(std::uint32_t index);
+
+  /**
+   * \brief Remove and return the open node with the smallest estimate cost.
+   */
+  std::uint32_t PopOpenNode();
+
+  /**
+   * \brief Return true if the nodes are found using a hash table, because the
+   * window of cells would be too large.
+   */
+  bool UsesHashedCells() const { return useHashedCells; }
+
+  static const std::uint32_t noNode;
+  static const std::size_t maxWindowCellsCount;  ///< The maximum number of
+                                                 ///< cells of the window.
+  static const std::size_t maxKeptCellsCount;  ///< The maximum number of cells
+                                               ///< kept allocated between
+                                               ///< searches.
+
+ private:
+  std::size_t GetCellIndex(int x, int y) const {
+    return static_cast<std::size_t>(y - windowY) * windowWidth + (x - windowX);
+  }
+
+  static std::uint64_t GetCellKey(int x, int y) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) |
+           static_cast<std::uint32_t>(y);
+  }
+
+  std::uint32_t FindHashedNode(int x, int y) const;
+
+  /**
+   * \brief Change the window of cells so that it contains the specified
+   * area, and stamp the cells of the existing nodes.
+   *
+   * If the window would be larger than maxWindowCellsCount (or outside of the
+   * range of int), the nodes are put in the hash table instead.
+   */
+  void SetWindow(std::int64_t minX,
+                 std::int64_t minY,
+                 std::int64_t maxX,
+                 std::int64_t maxY);
+
+  bool IsBefore(std::uint32_t a, std::uint32_t b) const {
+    const PathfindingNode& nodeA = nodes[a];
+    const PathfindingNode& nodeB = nodes[b];
+    return nodeA.estimateCost < nodeB.estimateCost ||
+           (nodeA.estimateCost == nodeB.estimateCost &&
+            nodeA.openOrder < nodeB.openOrder);
+  }
+  void SiftUp(std::size_t heapIndex);
+  void SiftDown(std::size_t heapIndex);
+
+  std::vector<PathfindingNode> nodes;
+  std::vector<std::uint32_t> openList;  ///< The binary heap of open nodes.
+  std::vector<std::uint32_t> cellNodes;  ///< The node of each cell of the
+                                         ///< window.
+  std::vector<std::uint32_t> cellGenerations;  ///< The generation of the
+                                               ///< nodes of cellNodes.
+  std::unordered_map<std::uint64_t, std::uint32_t>
+      hashedCellNodes;  ///< The node of each cell, used instead of the
+                        ///< window when it would be too large.
+  bool useHashedCells;
+  std::uint32_t generation;
+  std::uint32_t nextOpenOrder;
+  int windowX;
+  int windowY;
+  int windowWidth;
+  int windowHeight;
+};
+
+#endif  // PATHFINDINGSEARCHWORKSPACE_H
@@ -5,12 +5,30 @@ Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
 This project is released under the MIT License.
 */
 #include "ScenePathfindingObstaclesManager.h"
+#include <algorithm>
 #include <iostream>
 #include "PathfindingObstacleRuntimeBehavior.h"
 
 std::map<RuntimeScene*, ScenePathfindingObstaclesManager>
     ScenePathfindingObstaclesManager::managers;
 
+const std::size_t ScenePathfindingObstaclesManager::maxCostGridsCount = 8;
+
+namespace {
+PathfindingObstacleBounds GetObstacleBounds(
+    const PathfindingObstacleRuntimeBehavior& obstacle) {
+  const RuntimeObject* object = obstacle.GetObject();
+  PathfindingObstacleBounds bounds;
+  bounds.x = object->GetDrawableX();
+  bounds.y = object->GetDrawableY();
+  bounds.width = object->GetWidth();
+  bounds.height = object->GetHeight();
+  bounds.impassable = obstacle.IsImpassable();
+  bounds.cost = obstacle.GetCost();
+  return bounds;
+}
+}  // namespace
+
 ScenePathfindingObstaclesManager::~ScenePathfindingObstaclesManager() {
   for (std::set<PathfindingObstacleRuntimeBehavior*>::iterator it =
            allObstacles.begin();
@@ -27,4 +45,69 @@ void ScenePathfindingObstaclesManager::AddObstacle(
 void ScenePathfindingObstaclesManager::RemoveObstacle(
     PathfindingObstacleRuntimeBehavior* obstacle) {
   allObstacles.erase(obstacle);
+
+  // The object of the obstacle may be being destroyed: use the bounds as
+  // they were rasterized.
+  auto it = rasterizedObstacles.find(obstacle);
+  if (it != rasterizedObstacles.end()) {
+    for (auto& costGrid : costGrids) costGrid->RemoveObstacle(it->second);
+    rasterizedObstacles.erase(it);
+  }
+}
+
+const PathfindingObstaclesCostGrid&
+ScenePathfindingObstaclesManager::GetCostGrid(float cellWidth,
+                                              float cellHeight,
+                                              float leftBorder,
+                                              float topBorder,
+                                              float rightBorder,
+                                              float bottomBorder) {
+  UpdateCostGrids();
+
+  for (std::size_t i = 0; i < costGrids.size(); ++i) {
+    if (costGrids[i]->Matches(cellWidth,
+                              cellHeight,
+                              leftBorder,
+                              topBorder,
+                              rightBorder,
+                              bottomBorder)) {
+      std::rotate(
+          costGrids.begin(), costGrids.begin() + i, costGrids.begin() + i + 1);
+      return *costGrids.front();
+    }
+  }
+
+  // Forget the least recently used grid, to avoid updating too many grids
+  // when obstacles are moving.
+  if (costGrids.size() >= maxCostGridsCount) costGrids.pop_back();
+
+  std::unique_ptr<PathfindingObstaclesCostGrid> costGrid(
+      new PathfindingObstaclesCostGrid(cellWidth,
+                                       cellHeight,
+                                       leftBorder,
+                                       topBorder,
+                                       rightBorder,
+                                       bottomBorder));
+  for (auto& rasterizedObstacle : rasterizedObstacles)
+    costGrid->AddObstacle(rasterizedObstacle.second);
+
+  costGrids.insert(costGrids.begin(), std::move(costGrid));
+  return *costGrids.front();
+}
+
+void ScenePathfindingObstaclesManager::UpdateCostGrids() {
+  for (PathfindingObstacleRuntimeBehavior* obstacle : allObstacles) {
+    PathfindingObstacleBounds bounds = GetObstacleBounds(*obstacle);
+    auto it = rasterizedObstacles.find(obstacle);
+    if (it == rasterizedObstacles.end()) {
+      for (auto& costGrid : costGrids) costGrid->AddObstacle(bounds);
+      rasterizedObstacles[obstacle] = bounds;
+    } else if (it->second != bounds) {
+      for (auto& costGrid : costGrids) {
+        costGrid->RemoveObstacle(it->second);
+        costGrid->AddObstacle(bounds);
+      }
+      it->second = bounds;
+    }
+  }
 }
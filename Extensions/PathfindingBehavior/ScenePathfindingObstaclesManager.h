@@ -7,15 +7,21 @@ This project is released under the MIT License.
 #ifndef SCENEPLATFORMOBJECTSMANAGER_H
 #define SCENEPLATFORMOBJECTSMANAGER_H
 #include <map>
+#include <memory>
 #include <set>
+#include <unordered_map>
+#include <vector>
 #include "GDCpp/Runtime/RuntimeScene.h"
+#include "PathfindingObstaclesCostGrid.h"
+#include "PathfindingSearchWorkspace.h"
 class PathfindingObstacleRuntimeBehavior;
 
 /**
  * \brief Contains lists of all obstacle related objects of a scene.
  *
- * \note Could be drastically improved by using spatial hashing (see JS
- * implementation).
+ * The obstacles are rasterized in cost grids, one for each cell size and size
+ * of objects moving on the scene, so that the cost of a cell can be read
+ * without iterating on the obstacles.
  */
 class ScenePathfindingObstaclesManager {
  public:
@@ -47,9 +53,45 @@ class ScenePathfindingObstaclesManager {
     return allObstacles;
   }
 
+  /**
+   * \brief Get the grid of the costs of the cells of the scene, for the
+   * specified cell size and borders of the moving object.
+   *
+   * The grids are updated with the obstacles that were added, moved or
+   * changed since the last call, and a grid is created if none exists for
+   * these parameters.
+   *
+   * \see PathfindingObstaclesCostGrid
+   */
+  const PathfindingObstaclesCostGrid& GetCostGrid(float cellWidth,
+                                                  float cellHeight,
+                                                  float leftBorder,
+                                                  float topBorder,
+                                                  float rightBorder,
+                                                  float bottomBorder);
+
+  /**
+   * \brief Get the structures used to search for paths on the scene.
+   */
+  PathfindingSearchWorkspace& GetSearchWorkspace() { return searchWorkspace; }
+
  private:
+  /**
+   * \brief Update the cost grids with the current position and properties of
+   * the obstacles.
+   */
+  void UpdateCostGrids();
+
   std::set<PathfindingObstacleRuntimeBehavior*>
       allObstacles;  ///< The list of all obstacles of the scene.
+  std::unordered_map<PathfindingObstacleRuntimeBehavior*,
+                     PathfindingObstacleBounds>
+      rasterizedObstacles;  ///< The obstacles, as rasterized in the cost grids.
+  std::vector<std::unique_ptr<PathfindingObstaclesCostGrid>>
+      costGrids;  ///< The cost grids, the most recently used first.
+  PathfindingSearchWorkspace searchWorkspace;
+
+  static const std::size_t maxCostGridsCount;
 };
 
 #endif
@@ -22,6 +22,8 @@ namespace gdjs {
     _gridOffsetX: float;
     _gridOffsetY: float;
     _extraBorder: float;
+    /** Only used by the native platform: paths are always computed with A*. */
+    _useJumpPointSearch: boolean;
 
     //Attributes used for traveling on the path:
     _pathFound: boolean = false;
@@ -59,6 +61,7 @@ namespace gdjs {
       this._gridOffsetX = behaviorData.gridOffsetX || 0;
       this._gridOffsetY = behaviorData.gridOffsetY || 0;
       this._extraBorder = behaviorData.extraBorder;
+      this._useJumpPointSearch = behaviorData.useJumpPointSearch || false;
       this._manager = gdjs.PathfindingObstaclesManager.getManager(runtimeScene);
       this._searchContext = new gdjs.PathfindingRuntimeBehavior.SearchContext(
         this._manager
@@ -99,6 +102,12 @@ namespace gdjs {
       if (oldBehaviorData.extraBorder !== newBehaviorData.extraBorder) {
         this.setExtraBorder(newBehaviorData.extraBorder);
       }
+      if (
+        oldBehaviorData.useJumpPointSearch !==
+        newBehaviorData.useJumpPointSearch
+      ) {
+        this.setUseJumpPointSearch(newBehaviorData.useJumpPointSearch);
+      }
       return true;
     }
 
@@ -211,6 +220,14 @@ namespace gdjs {
       return this._rotateObject;
     }
 
+    setUseJumpPointSearch(useJumpPointSearch: boolean): void {
+      this._useJumpPointSearch = useJumpPointSearch;
+    }
+
+    usesJumpPointSearch(): boolean {
+      return this._useJumpPointSearch;
+    }
+
     getNodeX(index: integer): float {
       if (index < this._path.length) {
         return this._path[index][0];
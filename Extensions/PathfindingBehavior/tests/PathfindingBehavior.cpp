@@ -8,10 +8,13 @@ This project is released under the MIT License.
  * @file Tests for the Pathfinding extension.
  */
 #define CATCH_CONFIG_MAIN
+#include <cmath>
 #include "../PathfindingBehavior.h"
 #include "../PathfindingObstacleBehavior.h"
 #include "../PathfindingObstacleRuntimeBehavior.h"
+#include "../PathfindingObstaclesCostGrid.h"
 #include "../PathfindingRuntimeBehavior.h"
+#include "../PathfindingSearchWorkspace.h"
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Object.h"
@@ -46,6 +49,17 @@ std::unique_ptr<TRuntimeBehavior> CreateNewRuntimeBehavior() {
   behavior.InitializeContent(behaviorContent);
   return std::move(gd::make_unique<TRuntimeBehavior>(behaviorContent));
 };
+
+float GetPathLength(const PathfindingRuntimeBehavior &behavior) {
+  float length = 0;
+  for (std::size_t i = 1; i < behavior.GetNodeCount(); ++i) {
+    float dx = behavior.GetNodeX(i) - behavior.GetNodeX(i - 1);
+    float dy = behavior.GetNodeY(i) - behavior.GetNodeY(i - 1);
+    length += sqrt(dx * dx + dy * dy);
+  }
+
+  return length;
+}
 }  // namespace
 
 TEST_CASE("PathfindingRuntimeBehavior", "[game-engine][pathfinding]") {
@@ -233,4 +247,237 @@ TEST_CASE("PathfindingRuntimeBehavior", "[game-engine][pathfinding]") {
     REQUIRE(runtimeBehavior->GetNodeX(4) == 20);
     REQUIRE(runtimeBehavior->GetNodeY(4) == 80);
   }
+  SECTION("Moving obstacles") {
+    RuntimeGame game;
+
+    gd::Object playerObj("player");
+    gd::Object obstacleObj("obstacle");
+
+    RuntimeScene scene(NULL, &game);
+    auto *player = scene.objectsInstances.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, playerObj)));
+    player->AddBehavior("Pathfinding",
+                        CreateNewRuntimeBehavior<PathfindingRuntimeBehavior,
+                                                 PathfindingBehavior>());
+    auto *obstacle =
+        scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(
+            new ResizableRuntimeObject(scene, obstacleObj)));
+    obstacle->AddBehavior(
+        "PathfindingObstacle",
+        CreateNewRuntimeBehavior<PathfindingObstacleRuntimeBehavior,
+                                 PathfindingObstacleBehavior>());
+    obstacle->SetX(1100);
+    obstacle->SetY(1200);
+    obstacle->SetWidth(200);
+    obstacle->SetHeight(200);
+    scene.RenderAndStep();
+
+    PathfindingRuntimeBehavior *runtimeBehavior =
+        static_cast<PathfindingRuntimeBehavior *>(
+            player->GetBehaviorRawPointer("Pathfinding"));
+    runtimeBehavior->MoveTo(scene, 1200, 1300);
+    REQUIRE(runtimeBehavior->PathFound() == false);
+
+    // Obstacles moved since the last path computation are taken into account,
+    // even before the next scene step.
+    obstacle->SetX(0);
+    runtimeBehavior->MoveTo(scene, 1200, 1300);
+    REQUIRE(runtimeBehavior->PathFound() == true);
+    REQUIRE(runtimeBehavior->GetNodeCount() == 66);
+
+    static_cast<PathfindingObstacleRuntimeBehavior *>(
+        obstacle->GetBehaviorRawPointer("PathfindingObstacle"))
+        ->SetImpassable(false);
+    runtimeBehavior->MoveTo(scene, 100, 100);
+    REQUIRE(runtimeBehavior->PathFound() == true);
+
+    // Removed obstacles are not taken into account anymore.
+    obstacle->SetX(1100);
+    obstacle->SetWidth(200);
+    static_cast<PathfindingObstacleRuntimeBehavior *>(
+        obstacle->GetBehaviorRawPointer("PathfindingObstacle"))
+        ->SetImpassable(true);
+    runtimeBehavior->MoveTo(scene, 1200, 1300);
+    REQUIRE(runtimeBehavior->PathFound() == false);
+
+    scene.objectsInstances.RemoveObject(obstacle);
+    runtimeBehavior->MoveTo(scene, 1200, 1300);
+    REQUIRE(runtimeBehavior->PathFound() == true);
+    REQUIRE(runtimeBehavior->GetNodeCount() == 66);
+  }
+  SECTION("Jump point search") {
+    RuntimeGame game;
+
+    gd::Object playerObj("player");
+    gd::Object obstacleObj("obstacle");
+
+    RuntimeScene scene(NULL, &game);
+    auto *player = scene.objectsInstances.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, playerObj)));
+    player->AddBehavior("Pathfinding",
+                        CreateNewRuntimeBehavior<PathfindingRuntimeBehavior,
+                                                 PathfindingBehavior>());
+    std::vector<PathfindingObstacleRuntimeBehavior *> obstacleBehaviors;
+    for (int i = 0; i < 6; ++i) {
+      auto *obstacle =
+          scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(
+              new ResizableRuntimeObject(scene, obstacleObj)));
+      obstacle->AddBehavior(
+          "PathfindingObstacle",
+          CreateNewRuntimeBehavior<PathfindingObstacleRuntimeBehavior,
+                                   PathfindingObstacleBehavior>());
+      obstacle->SetX(100 + i * 150);
+      obstacle->SetY(i % 2 ? -300 : 100);
+      obstacle->SetWidth(40);
+      obstacle->SetHeight(600);
+      obstacleBehaviors.push_back(
+          static_cast<PathfindingObstacleRuntimeBehavior *>(
+              obstacle->GetBehaviorRawPointer("PathfindingObstacle")));
+    }
+    scene.RenderAndStep();
+
+    PathfindingRuntimeBehavior *runtimeBehavior =
+        static_cast<PathfindingRuntimeBehavior *>(
+            player->GetBehaviorRawPointer("Pathfinding"));
+
+    REQUIRE(runtimeBehavior->UsesJumpPointSearch() == false);
+    runtimeBehavior->MoveTo(scene, 1000, 420);
+    REQUIRE(runtimeBehavior->PathFound() == true);
+    std::size_t nodeCount = runtimeBehavior->GetNodeCount();
+    float length = GetPathLength(*runtimeBehavior);
+
+    // Paths found by jump point search are as short, with only the nodes
+    // where the object turns.
+    runtimeBehavior->SetUseJumpPointSearch(true);
+    runtimeBehavior->MoveTo(scene, 1000, 420);
+    REQUIRE(runtimeBehavior->PathFound() == true);
+    REQUIRE(runtimeBehavior->GetNodeCount() < nodeCount / 2);
+    REQUIRE(GetPathLength(*runtimeBehavior) == Approx(length));
+    REQUIRE(runtimeBehavior->GetDestinationX() == 1000);
+    REQUIRE(runtimeBehavior->GetDestinationY() == 420);
+
+    // Impossible paths are still not found.
+    runtimeBehavior->MoveTo(scene, 110, 200);
+    REQUIRE(runtimeBehavior->PathFound() == false);
+
+    // Jump point search can be enabled in the behavior properties.
+    gd::SerializerElement behaviorContent;
+    PathfindingBehavior behavior;
+    behavior.InitializeContent(behaviorContent);
+    behaviorContent.SetAttribute("useJumpPointSearch", true);
+    PathfindingRuntimeBehavior jumpPointSearchBehavior(behaviorContent);
+    REQUIRE(jumpPointSearchBehavior.UsesJumpPointSearch() == true);
+
+    // Jump point search is not used when obstacles have a cost.
+    obstacleBehaviors[0]->SetImpassable(false);
+    runtimeBehavior->MoveTo(scene, 1000, 420);
+    REQUIRE(runtimeBehavior->PathFound() == true);
+    runtimeBehavior->SetUseJumpPointSearch(false);
+    std::size_t nodeCountWithCost = runtimeBehavior->GetNodeCount();
+    runtimeBehavior->MoveTo(scene, 1000, 420);
+    REQUIRE(runtimeBehavior->GetNodeCount() == nodeCountWithCost);
+  }
+}
+
+TEST_CASE("PathfindingSearchWorkspace", "[game-engine][pathfinding]") {
+  PathfindingSearchWorkspace workspace;
+  for (int search = 0; search < 3; ++search) {
+    workspace.Reset(0, 0, 3, 3);
+    REQUIRE(workspace.GetNodesCount() == 0);
+    REQUIRE(workspace.FindNode(1, 1) == PathfindingSearchWorkspace::noNode);
+
+    // Nodes can be created outside of the initial area.
+    const float costs[] = {5, 3, 8, 3, 1, 9, 3};
+    for (int i = 0; i < 7; ++i) {
+      std::uint32_t index = workspace.CreateNode(i * 7 - 20, i, 1);
+      workspace.GetNode(index).estimateCost = costs[i];
+      workspace.InsertOrUpdateOpenNode(index);
+    }
+    for (int i = 0; i < 7; ++i) {
+      std::uint32_t index = workspace.FindNode(i * 7 - 20, i);
+      REQUIRE(index == i);
+      REQUIRE(workspace.GetNode(index).x == i * 7 - 20);
+    }
+
+    // Changing the estimate cost of an open node.
+    workspace.GetNode(5).estimateCost = 2;
+    workspace.InsertOrUpdateOpenNode(5);
+    workspace.GetNode(2).estimateCost = 3;
+    workspace.InsertOrUpdateOpenNode(2);
+
+    // Nodes with the same estimate cost are returned in the order they were
+    // opened or updated.
+    const std::uint32_t expectedNodes[] = {4, 5, 1, 3, 6, 2, 0};
+    for (std::uint32_t expectedNode : expectedNodes) {
+      REQUIRE(workspace.IsOpenListEmpty() == false);
+      REQUIRE(workspace.PopOpenNode() == expectedNode);
+    }
+    REQUIRE(workspace.IsOpenListEmpty() == true);
+  }
+
+  SECTION("Nodes far from each other are found using a hash table") {
+    workspace.Reset(0, 0, 3, 3);
+    std::uint32_t first = workspace.CreateNode(0, 0, 1);
+    std::uint32_t second = workspace.CreateNode(100000, 100000, 1);
+    std::uint32_t third = workspace.CreateNode(-2000000000, 2000000000, 1);
+    REQUIRE(workspace.UsesHashedCells() == true);
+    REQUIRE(workspace.FindNode(0, 0) == first);
+    REQUIRE(workspace.FindNode(100000, 100000) == second);
+    REQUIRE(workspace.FindNode(-2000000000, 2000000000) == third);
+    REQUIRE(workspace.FindNode(1, 0) == PathfindingSearchWorkspace::noNode);
+
+    // The window is used again for the next search.
+    workspace.Reset(0, 0, 3, 3);
+    REQUIRE(workspace.UsesHashedCells() == false);
+    REQUIRE(workspace.FindNode(0, 0) == PathfindingSearchWorkspace::noNode);
+    REQUIRE(workspace.CreateNode(0, 0, 1) == 0);
+    REQUIRE(workspace.FindNode(0, 0) == 0);
+
+    // Nodes close to the limits of int.
+    workspace.Reset(2147483640, 0, 2147483647, 3);
+    REQUIRE(workspace.UsesHashedCells() == true);
+    REQUIRE(workspace.CreateNode(2147483647, 0, 1) == 0);
+    REQUIRE(workspace.CreateNode(2147483647, 5, 1) == 1);
+    REQUIRE(workspace.FindNode(2147483647, 5) == 1);
+  }
+}
+
+TEST_CASE("PathfindingObstaclesCostGrid", "[game-engine][pathfinding]") {
+  PathfindingObstaclesCostGrid grid(20, 20, 5, 5, 5, 5);
+
+  PathfindingObstacleBounds wall = {-100, 0, 200, 20, true, 0};
+  PathfindingObstacleBounds mud = {0, 100, 40, 40, false, 3};
+  PathfindingObstacleBounds water = {20, 100, 40, 40, false, 1.5};
+
+  REQUIRE(grid.GetCost(0, 0) == 1);
+
+  grid.AddObstacle(wall);
+  REQUIRE(grid.GetCost(-5, 0) == -1);
+  REQUIRE(grid.GetCost(-5, 1) == -1);
+  REQUIRE(grid.GetCost(-5, 2) == 1);
+  REQUIRE(grid.GetCost(-5, -1) == 1);
+  REQUIRE(grid.GetCost(5, 0) == -1);
+  REQUIRE(grid.GetCost(6, 0) == 1);
+  REQUIRE(grid.GetChunksCount() == 2);
+
+  grid.AddObstacle(mud);
+  grid.AddObstacle(water);
+  REQUIRE(grid.GetCost(0, 6) == 3);
+  REQUIRE(grid.GetCost(1, 6) == 4.5);
+  REQUIRE(grid.GetCost(2, 6) == 4.5);
+  REQUIRE(grid.GetCost(3, 6) == 1.5);
+  REQUIRE(grid.GetCost(4, 6) == 1);
+
+  grid.AddObstacle(wall);
+  grid.RemoveObstacle(wall);
+  REQUIRE(grid.GetCost(0, 0) == -1);
+  grid.RemoveObstacle(wall);
+  REQUIRE(grid.GetCost(0, 0) == 1);
+  REQUIRE(grid.GetCost(1, 6) == 4.5);
+  REQUIRE(grid.GetChunksCount() == 1);
+
+  grid.RemoveObstacle(mud);
+  grid.RemoveObstacle(water);
+  REQUIRE(grid.GetCost(1, 6) == 1);
+  REQUIRE(grid.GetChunksCount() == 0);
 }
@@ -0,0 +1,135 @@
+/**
+
+GDevelop - Pathfinding Behavior Extension
+Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+/**
+ * @file Benchmarks of the Pathfinding extension.
+ */
+#include <chrono>
+#include <functional>
+#include <numeric>
+#include "../PathfindingBehavior.h"
+#include "../PathfindingObstacleBehavior.h"
+#include "../PathfindingObstacleRuntimeBehavior.h"
+#include "../PathfindingRuntimeBehavior.h"
+#include "GDCore/CommonTools.h"
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+namespace {
+class SquareRuntimeObject : public RuntimeObject {
+ public:
+  SquareRuntimeObject(RuntimeScene &scene, const gd::Object &obj)
+      : RuntimeObject(scene, obj) {}
+
+  float GetWidth() const override { return 40; }
+  float GetHeight() const override { return 40; }
+};
+
+template <class TRuntimeBehavior, class TBehavior>
+std::unique_ptr<TRuntimeBehavior> CreateNewRuntimeBehavior() {
+  gd::SerializerElement behaviorContent;
+  TBehavior behavior;
+  behavior.InitializeContent(behaviorContent);
+  return gd::make_unique<TRuntimeBehavior>(behaviorContent);
+};
+}  // namespace
+
+TEST_CASE("Pathfinding - Benchmarks", "[game-engine][benchmarks]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  RuntimeGame game;
+  RuntimeScene scene(NULL, &game);
+  gd::Object agentObj("agent");
+  gd::Object obstacleObj("obstacle");
+
+  // 2025 obstacles, in staggered rows leaving corridors between them.
+  for (int i = 0; i < 45; ++i) {
+    for (int j = 0; j < 45; ++j) {
+      auto *obstacle =
+          scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(
+              new SquareRuntimeObject(scene, obstacleObj)));
+      obstacle->AddBehavior(
+          "PathfindingObstacle",
+          CreateNewRuntimeBehavior<PathfindingObstacleRuntimeBehavior,
+                                   PathfindingObstacleBehavior>());
+      obstacle->SetX(i * 100 + (j % 2) * 50 + 30);
+      obstacle->SetY(j * 100 + 30);
+    }
+  }
+
+  std::vector<RuntimeObject *> agents;
+  for (int i = 0; i < 30; ++i) {
+    auto *agent = scene.objectsInstances.AddObject(
+        std::unique_ptr<RuntimeObject>(new RuntimeObject(scene, agentObj)));
+    agent->AddBehavior("Pathfinding",
+                       CreateNewRuntimeBehavior<PathfindingRuntimeBehavior,
+                                                PathfindingBehavior>());
+    agent->SetX((i % 6) * 700);
+    agent->SetY((i / 6) * 800);
+    agents.push_back(agent);
+  }
+  scene.RenderAndStep();
+
+  SECTION("30 agents, 2025 obstacles") {
+    std::size_t pathsFoundCount = 0;
+    doBenchmark("MoveTo (30 agents, 2025 obstacles)", 5, [&]() {
+      pathsFoundCount = 0;
+      for (std::size_t i = 0; i < agents.size(); ++i) {
+        PathfindingRuntimeBehavior *behavior =
+            static_cast<PathfindingRuntimeBehavior *>(
+                agents[i]->GetBehaviorRawPointer("Pathfinding"));
+        behavior->MoveTo(scene,
+                         agents[i]->GetX() + 500 - (i % 3) * 300,
+                         agents[i]->GetY() + 400 + (i % 4) * 100);
+        if (behavior->PathFound()) pathsFoundCount++;
+      }
+    });
+    REQUIRE(pathsFoundCount == agents.size());
+  }
+
+  SECTION("30 agents, 2025 obstacles (jump point search)") {
+    std::size_t pathsFoundCount = 0;
+    doBenchmark(
+        "MoveTo (30 agents, 2025 obstacles, jump point search)", 5, [&]() {
+          pathsFoundCount = 0;
+          for (std::size_t i = 0; i < agents.size(); ++i) {
+            PathfindingRuntimeBehavior *behavior =
+                static_cast<PathfindingRuntimeBehavior *>(
+                    agents[i]->GetBehaviorRawPointer("Pathfinding"));
+            behavior->SetUseJumpPointSearch(true);
+            behavior->MoveTo(scene,
+                             agents[i]->GetX() + 500 - (i % 3) * 300,
+                             agents[i]->GetY() + 400 + (i % 4) * 100);
+            if (behavior->PathFound()) pathsFoundCount++;
+          }
+        });
+    REQUIRE(pathsFoundCount == agents.size());
+  }
+}
@@ -109,14 +109,26 @@ int32 b2DynamicTree::CreateProxy(const b2AABB& aabb, void* userData)
 	InsertLeaf(proxyId);
 
 	// Rebalance if necessary.
-	int32 iterationCount = m_nodeCount >> 4;
-	int32 tryCount = 0;
-	int32 height = ComputeHeight();
-	while (height > 64 && tryCount < 10)
+	// Modified for GDevelop: only the path to the new leaf can have grown, so
+	// the height of the whole tree (which is linear in the number of proxies)
+	// is only computed if this path is too long.
+	int32 depth = 1;
+	for (int32 node = proxyId; m_nodes[node].parent != b2_nullNode; node = m_nodes[node].parent)
 	{
-		Rebalance(iterationCount);
-		height = ComputeHeight();
-		++tryCount;
+		++depth;
+	}
+
+	if (depth > 64)
+	{
+		int32 iterationCount = m_nodeCount >> 4;
+		int32 tryCount = 0;
+		int32 height = ComputeHeight();
+		while (height > 64 && tryCount < 10)
+		{
+			Rebalance(iterationCount);
+			height = ComputeHeight();
+			++tryCount;
+		}
 	}
 
 	return proxyId;
@@ -15,8 +15,8 @@ This project is released under the MIT License.
 #include "GDCpp/Runtime/RuntimeObject.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
 #include "GDCpp/Runtime/Serialization/SerializerElement.h"
+#include "PhysicsShapeTemplate.h"
 #include "RuntimeScenePhysicsDatas.h"
-#include "Triangulation/triangulate.h"
 
 #undef GetObject
 
@@ -69,14 +69,17 @@ PhysicsRuntimeBehavior::PhysicsRuntimeBehavior(
   polygonWidth = behaviorContent.GetDoubleAttribute("polygonWidth");
   polygonHeight = behaviorContent.GetDoubleAttribute("polygonHeight");
 
-  gd::String coordsStr = behaviorContent.GetStringAttribute("coordsList");
-  SetPolygonCoords(
-      PhysicsRuntimeBehavior::GetCoordsVectorFromString(coordsStr, '/', ';'));
+  // The polygon is only parsed and triangulated for the first instance.
+  shapeTemplate = PhysicsShapeTemplate::Get(
+      behaviorContent.GetStringAttribute("coordsList"));
 }
 
 PhysicsRuntimeBehavior::~PhysicsRuntimeBehavior() {
-  if (runtimeScenesPhysicsDatas != NULL && body)
+  if (runtimeScenesPhysicsDatas != NULL && body) {
+    runtimeScenesPhysicsDatas->WaitForBackgroundSteps();
+    runtimeScenesPhysicsDatas->InvalidateBodyTransform(body);
     runtimeScenesPhysicsDatas->world->DestroyBody(body);
+  }
 }
 
 /**
@@ -89,23 +92,30 @@ void PhysicsRuntimeBehavior::DoStepPreEvents(RuntimeScene &scene) {
   if (!runtimeScenesPhysicsDatas
            ->stepped)  // Simulate the world, once at each frame
   {
-    runtimeScenesPhysicsDatas->StepWorld(
+    float elapsedTime =
         static_cast<double>(scene.GetTimeManager().GetElapsedTime()) /
-            1000000.0,
-        6,
-        10);
+        1000000.0;
+    if (runtimeScenesPhysicsDatas->IsSteppingInBackground())
+      runtimeScenesPhysicsDatas->BeginBackgroundSteps(elapsedTime, 6, 10);
+    else
+      runtimeScenesPhysicsDatas->StepWorld(elapsedTime, 6, 10);
     runtimeScenesPhysicsDatas->stepped = true;
   }
 
   // Update object position according to Box2D body
   b2Vec2 position = body->GetPosition();
+  float angle = body->GetAngle();
+  if (runtimeScenesPhysicsDatas->IsSteppingInBackground())
+    runtimeScenesPhysicsDatas->GetInterpolatedTransform(
+        body, position.x, position.y, angle);
+
   object->SetX(position.x * runtimeScenesPhysicsDatas->GetScaleX() -
                object->GetWidth() / 2 + object->GetX() -
                object->GetDrawableX());
   object->SetY(-position.y * runtimeScenesPhysicsDatas->GetScaleY() -
                object->GetHeight() / 2 + object->GetY() -
-               object->GetDrawableY());                  // Y axis is inverted
-  object->SetAngle(-body->GetAngle() * 180.0f / b2_pi);  // Angles are inverted
+               object->GetDrawableY());  // Y axis is inverted
+  object->SetAngle(-angle * 180.0f / b2_pi);  // Angles are inverted
 
   objectOldX = object->GetX();
   objectOldY = object->GetY();
@@ -118,6 +128,7 @@ void PhysicsRuntimeBehavior::DoStepPreEvents(RuntimeScene &scene) {
  */
 void PhysicsRuntimeBehavior::DoStepPostEvents(RuntimeScene &scene) {
   if (!body) CreateBody(scene);
+  runtimeScenesPhysicsDatas->WaitForBackgroundSteps();
 
   // Note: Strange bug here, using SpriteObject, the tests objectOldWidth !=
   // newWidth and objectOldHeight != newHeight keeps being true even if the two
@@ -131,6 +142,7 @@ void PhysicsRuntimeBehavior::DoStepPostEvents(RuntimeScene &scene) {
     double oldAngularVelocity = body->GetAngularVelocity();
     b2Vec2 oldVelocity = body->GetLinearVelocity();
 
+    runtimeScenesPhysicsDatas->InvalidateBodyTransform(body);
     runtimeScenesPhysicsDatas->world->DestroyBody(body);
     CreateBody(scene);
 
@@ -140,18 +152,22 @@ void PhysicsRuntimeBehavior::DoStepPostEvents(RuntimeScene &scene) {
 
   runtimeScenesPhysicsDatas->stepped = false;  // Prepare for a new simulation
 
-  if (objectOldX == object->GetX() && objectOldY == object->GetY() &&
-      objectOldAngle == object->GetAngle())
-    return;
-
-  b2Vec2 oldPos;
-  oldPos.x = (object->GetDrawableX() + object->GetWidth() / 2) *
-             runtimeScenesPhysicsDatas->GetInvScaleX();
-  oldPos.y = -(object->GetDrawableY() + object->GetHeight() / 2) *
-             runtimeScenesPhysicsDatas->GetInvScaleY();  // Y axis is inverted
-  body->SetTransform(
-      oldPos, -object->GetAngle() * b2_pi / 180.0f);  // Angles are inverted
-  body->SetAwake(true);
+  if (objectOldX != object->GetX() || objectOldY != object->GetY() ||
+      objectOldAngle != object->GetAngle()) {
+    b2Vec2 oldPos;
+    oldPos.x = (object->GetDrawableX() + object->GetWidth() / 2) *
+               runtimeScenesPhysicsDatas->GetInvScaleX();
+    oldPos.y = -(object->GetDrawableY() + object->GetHeight() / 2) *
+               runtimeScenesPhysicsDatas->GetInvScaleY();  // Y axis is inverted
+    body->SetTransform(
+        oldPos, -object->GetAngle() * b2_pi / 180.0f);  // Angles are inverted
+    body->SetAwake(true);
+
+    // Don't interpolate the position of a moved object.
+    runtimeScenesPhysicsDatas->InvalidateBodyTransform(body);
+  }
+
+  runtimeScenesPhysicsDatas->NotifyBodyUpdatedAfterEvents();
 }
 
 /**
@@ -161,6 +177,7 @@ void PhysicsRuntimeBehavior::CreateBody(const RuntimeScene &scene) {
   if (runtimeScenesPhysicsDatas == NULL)
     runtimeScenesPhysicsDatas = static_cast<RuntimeScenePhysicsDatas *>(
         scene.GetBehaviorSharedData(name).get());
+  runtimeScenesPhysicsDatas->WaitForBackgroundSteps();
 
   // Create body from object
   b2BodyDef bodyDef;
@@ -193,62 +210,24 @@ void PhysicsRuntimeBehavior::CreateBody(const RuntimeScene &scene) {
     fixtureDef.restitution = averageRestitution;
 
     body->CreateFixture(&fixtureDef);
-  } else if (shapeType == CustomPolygon && polygonCoords.size() > 2) {
-    // Make a polygon triangulation to make possible to use a concave polygon
-    // and more than 8 edged polygons
-    std::vector<sf::Vector2f> resultOfTriangulation;
-
-    Triangulate::Process(polygonCoords, resultOfTriangulation);
-
-    // Iterate over all triangles
-    for (std::size_t i = 0; i < resultOfTriangulation.size() / 3; i++) {
+  } else if (shapeType == CustomPolygon &&
+             shapeTemplate->GetPolygonCoords().size() > 2) {
+    // The polygon is already triangulated, and the shapes of the triangles
+    // are reused if the body has the same size as the last one created.
+    PhysicsShapeTemplate::ShapesParameters parameters;
+    parameters.onOrigin = polygonPositioning == OnOrigin;
+    parameters.scaleX = GetPolygonScaleX();
+    parameters.scaleY = GetPolygonScaleY();
+    parameters.width = object->GetWidth();
+    parameters.height = object->GetHeight();
+    parameters.offsetX = object->GetDrawableX() - object->GetX();
+    parameters.offsetY = object->GetDrawableY() - object->GetY();
+    parameters.invScaleX = runtimeScenesPhysicsDatas->GetInvScaleX();
+    parameters.invScaleY = runtimeScenesPhysicsDatas->GetInvScaleY();
+
+    for (const b2PolygonShape &shape : shapeTemplate->GetShapes(parameters)) {
       b2FixtureDef fixtureDef;
-      b2PolygonShape dynamicBox;
-
-      // Create vertices
-      b2Vec2 vertices[3];
-
-      std::size_t b = 0;
-      for (int a = 2; a >= 0; a--)  // Box2D use another direction for vertices
-      {
-        if (polygonPositioning == OnOrigin) {
-          vertices[b].Set(
-              (resultOfTriangulation.at(i * 3 + a).x * GetPolygonScaleX() -
-               object->GetWidth() / 2 -
-               (object->GetDrawableX() - object->GetX())) *
-                  runtimeScenesPhysicsDatas->GetInvScaleX(),
-              (((object->GetHeight() -
-                 (resultOfTriangulation.at(i * 3 + a).y * GetPolygonScaleY())) -
-                object->GetHeight() / 2 +
-                (object->GetDrawableY() - object->GetY())) *
-               runtimeScenesPhysicsDatas->GetInvScaleY()));
-        }
-        /*else if(polygonPositioning == OnTopLeftCorner)
-        {
-            vertices[b].Set((resultOfTriangulation.at(i*3 + a).x *
-        GetPolygonScaleX() - object->GetWidth()/2 ) *
-        runtimeScenesPhysicsDatas->GetInvScaleX(),
-                            (((object->GetHeight() -
-        (resultOfTriangulation.at(i*3 + a).y * GetPolygonScaleY())) -
-        object->GetHeight()/2)                   *
-        runtimeScenesPhysicsDatas->GetInvScaleY()));
-        }*/
-        else if (polygonPositioning == OnCenter) {
-          vertices[b].Set(
-              (resultOfTriangulation.at(i * 3 + a).x * GetPolygonScaleX()) *
-                  runtimeScenesPhysicsDatas->GetInvScaleX(),
-              (((object->GetHeight() -
-                 (resultOfTriangulation.at(i * 3 + a).y * GetPolygonScaleY())) -
-                object->GetHeight()) *
-               runtimeScenesPhysicsDatas->GetInvScaleY()));
-        }
-
-        b++;
-      }
-
-      dynamicBox.Set(vertices, 3);
-
-      fixtureDef.shape = &dynamicBox;
+      fixtureDef.shape = &shape;
       fixtureDef.density = massDensity;
       fixtureDef.friction = averageFriction;
       fixtureDef.restitution = averageRestitution;
@@ -277,6 +256,8 @@ void PhysicsRuntimeBehavior::CreateBody(const RuntimeScene &scene) {
 
 void PhysicsRuntimeBehavior::OnDeActivate() {
   if (runtimeScenesPhysicsDatas && body) {
+    runtimeScenesPhysicsDatas->WaitForBackgroundSteps();
+    runtimeScenesPhysicsDatas->InvalidateBodyTransform(body);
     runtimeScenesPhysicsDatas->world->DestroyBody(body);
     body = NULL;  // Of course: body can ( and will ) be reused: Make sure we
                   // nullify the pointer as the body was destroyed.
@@ -609,13 +590,13 @@ double PhysicsRuntimeBehavior::GetAngularDamping(const RuntimeScene &scene) {
  * Test if there is a contact with another object
  */
 bool PhysicsRuntimeBehavior::CollisionWith(
-    std::map<gd::String, std::vector<RuntimeObject *> *> otherObjectsLists,
+    const RuntimeObjectsLists &otherObjectsLists,
     RuntimeScene &scene) {
   if (!body) CreateBody(scene);
 
   // Getting a list of all objects which are tested
   std::vector<RuntimeObject *> objects;
-  for (std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
+  for (RuntimeObjectsLists::const_iterator it =
            otherObjectsLists.begin();
        it != otherObjectsLists.end();
        ++it) {
@@ -649,12 +630,12 @@ bool PhysicsRuntimeBehavior::IsDynamic() { return dynamic; }
 
 void PhysicsRuntimeBehavior::SetPolygonCoords(
     const std::vector<sf::Vector2f> &vec) {
-  polygonCoords = vec;
+  shapeTemplate = std::make_shared<PhysicsShapeTemplate>(vec);
 }
 
 const std::vector<sf::Vector2f> &PhysicsRuntimeBehavior::GetPolygonCoords()
     const {
-  return polygonCoords;
+  return shapeTemplate->GetPolygonCoords();
 }
 
 bool PhysicsRuntimeBehavior::HasAutomaticResizing() const {
@@ -8,6 +8,7 @@ This project is released under the MIT License.
 #ifndef PHYSICSRUNTIMEBEHAVIOR_H
 #define PHYSICSRUNTIMEBEHAVIOR_H
 #include <map>
+#include <memory>
 #include <set>
 #include <vector>
 #include "GDCpp/Runtime/RuntimeBehavior.h"
@@ -21,6 +22,7 @@ class SerializerElement;
 }
 class RuntimeScene;
 class b2Body;
+class PhysicsShapeTemplate;
 class RuntimeScenePhysicsDatas;
 
 namespace sf {
@@ -140,7 +142,7 @@ class GD_EXTENSION_API PhysicsRuntimeBehavior : public RuntimeBehavior {
       char32_t composantSep = U';');
 
   bool CollisionWith(
-      std::map<gd::String, std::vector<RuntimeObject *> *> otherObjectsLists,
+      const RuntimeObjectsLists &otherObjectsLists,
       RuntimeScene &scene);
 
  private:
@@ -154,8 +156,9 @@ class GD_EXTENSION_API PhysicsRuntimeBehavior : public RuntimeBehavior {
     CustomPolygon
   } shapeType;  ///< the kind of hitbox -> Box, Circle or CustomPolygon
   Positioning polygonPositioning;
-  std::vector<sf::Vector2f>
-      polygonCoords;  ///< The list of coordinates of the collision polygon
+  std::shared_ptr<PhysicsShapeTemplate>
+      shapeTemplate;  ///< The collision polygon and its triangles, shared
+                      ///< with the other instances of the object.
 
   bool automaticResizing;
   float polygonWidth;   ///< ONLY for automatic resizing, used to define a scale
@@ -0,0 +1,88 @@
+/**
+
+GDevelop - Physics Behavior Extension
+Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+
+#include "PhysicsShapeTemplate.h"
+#include "PhysicsRuntimeBehavior.h"
+#include "Triangulation/triangulate.h"
+
+std::unordered_map<gd::String, std::weak_ptr<PhysicsShapeTemplate> >
+    PhysicsShapeTemplate::sharedTemplates;
+
+PhysicsShapeTemplate::PhysicsShapeTemplate(
+    const std::vector<sf::Vector2f>& polygonCoords_)
+    : polygonCoords(polygonCoords_), shapesComputed(false) {
+  if (polygonCoords.size() <= 2) return;
+
+  // Make a polygon triangulation to make possible to use a concave polygon
+  // and more than 8 edged polygons
+  std::vector<sf::Vector2f> resultOfTriangulation;
+  Triangulate::Process(polygonCoords, resultOfTriangulation);
+
+  triangles.reserve(resultOfTriangulation.size() / 3 * 3);
+  for (std::size_t i = 0; i < resultOfTriangulation.size() / 3; i++) {
+    for (int a = 2; a >= 0; a--)  // Box2D use another direction for vertices
+      triangles.push_back(resultOfTriangulation[i * 3 + a]);
+  }
+}
+
+std::shared_ptr<PhysicsShapeTemplate> PhysicsShapeTemplate::Get(
+    const gd::String& coordsList) {
+  auto it = sharedTemplates.find(coordsList);
+  if (it != sharedTemplates.end()) {
+    std::shared_ptr<PhysicsShapeTemplate> shapeTemplate = it->second.lock();
+    if (shapeTemplate) return shapeTemplate;
+  }
+
+  std::shared_ptr<PhysicsShapeTemplate> shapeTemplate =
+      std::make_shared<PhysicsShapeTemplate>(
+          PhysicsRuntimeBehavior::GetCoordsVectorFromString(
+              coordsList, '/', ';'));
+  sharedTemplates[coordsList] = shapeTemplate;
+  return shapeTemplate;
+}
+
+std::size_t PhysicsShapeTemplate::GetSharedTemplatesCount() {
+  std::size_t count = 0;
+  for (auto& it : sharedTemplates)
+    if (!it.second.expired()) count++;
+
+  return count;
+}
+
+const std::vector<b2PolygonShape>& PhysicsShapeTemplate::GetShapes(
+    const ShapesParameters& parameters) {
+  if (shapesComputed && shapesParameters == parameters) return shapes;
+
+  shapes.resize(triangles.size() / 3);
+  for (std::size_t i = 0; i < shapes.size(); i++) {
+    b2Vec2 vertices[3];
+    for (std::size_t b = 0; b < 3; b++) {
+      const sf::Vector2f& vertex = triangles[i * 3 + b];
+      if (parameters.onOrigin) {
+        vertices[b].Set(
+            (vertex.x * parameters.scaleX - parameters.width / 2 -
+             parameters.offsetX) *
+                parameters.invScaleX,
+            (((parameters.height - (vertex.y * parameters.scaleY)) -
+              parameters.height / 2 + parameters.offsetY) *
+             parameters.invScaleY));
+      } else {
+        vertices[b].Set(
+            (vertex.x * parameters.scaleX) * parameters.invScaleX,
+            (((parameters.height - (vertex.y * parameters.scaleY)) -
+              parameters.height) *
+             parameters.invScaleY));
+      }
+    }
+
+    shapes[i].Set(vertices, 3);
+  }
+
+  shapesComputed = true;
+  shapesParameters = parameters;
+  return shapes;
+}
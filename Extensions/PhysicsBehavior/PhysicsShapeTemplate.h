@@ -0,0 +1,107 @@
+/**
+
+GDevelop - Physics Behavior Extension
+Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+
+#ifndef PHYSICSSHAPETEMPLATE_H
+#define PHYSICSSHAPETEMPLATE_H
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "Box2D/Collision/Shapes/b2PolygonShape.h"
+#include "GDCore/String.h"
+#include "SFML/System/Vector2.hpp"
+
+/**
+ * \brief The custom collision polygon of PhysicsRuntimeBehavior, parsed and
+ * decomposed in triangles only once and shared by all the behaviors using the
+ * same polygon (usually, the instances of an object).
+ *
+ * The Box2D shapes of the triangles are also kept, so that they are not
+ * computed again when bodies of the same size are created.
+ */
+class GD_EXTENSION_API PhysicsShapeTemplate {
+ public:
+  /**
+   * \brief How the triangles are scaled and positioned in the body of an
+   * object.
+   */
+  struct ShapesParameters {
+    bool onOrigin;  ///< True if the polygon is positioned on the origin of the
+                    ///< object, false if it is positioned on its center.
+    float scaleX;
+    float scaleY;
+    float width;    ///< The width of the object.
+    float height;   ///< The height of the object.
+    float offsetX;  ///< The drawable X position of the object minus its X.
+    float offsetY;  ///< The drawable Y position of the object minus its Y.
+    float invScaleX;
+    float invScaleY;
+
+    bool operator==(const ShapesParameters& other) const {
+      return onOrigin == other.onOrigin && scaleX == other.scaleX &&
+             scaleY == other.scaleY && width == other.width &&
+             height == other.height && offsetX == other.offsetX &&
+             offsetY == other.offsetY && invScaleX == other.invScaleX &&
+             invScaleY == other.invScaleY;
+    }
+    bool operator!=(const ShapesParameters& other) const {
+      return !(*this == other);
+    }
+  };
+
+  /**
+   * \brief Create a template for the polygon, and triangulate it.
+   */
+  PhysicsShapeTemplate(const std::vector<sf::Vector2f>& polygonCoords);
+
+  /**
+   * \brief Return the template of a polygon stored as a string (see
+   * PhysicsRuntimeBehavior::GetCoordsVectorFromString), shared with the other
+   * behaviors using the same string if any.
+   */
+  static std::shared_ptr<PhysicsShapeTemplate> Get(
+      const gd::String& coordsList);
+
+  /**
+   * \brief Return the coordinates of the polygon.
+   */
+  const std::vector<sf::Vector2f>& GetPolygonCoords() const {
+    return polygonCoords;
+  }
+
+  /**
+   * \brief Return the vertices of the triangles of the polygon, three by
+   * triangle, in the order expected by Box2D.
+   */
+  const std::vector<sf::Vector2f>& GetTriangles() const { return triangles; }
+
+  /**
+   * \brief Return the Box2D shapes of the triangles, for a body.
+   *
+   * The shapes are only computed again if the parameters are not the same as
+   * the last time.
+   */
+  const std::vector<b2PolygonShape>& GetShapes(
+      const ShapesParameters& parameters);
+
+  /**
+   * \brief Return the number of polygons shared in the cache.
+   */
+  static std::size_t GetSharedTemplatesCount();
+
+ private:
+  std::vector<sf::Vector2f> polygonCoords;
+  std::vector<sf::Vector2f> triangles;
+
+  bool shapesComputed;
+  ShapesParameters shapesParameters;  ///< The parameters used for shapes.
+  std::vector<b2PolygonShape> shapes;
+
+  static std::unordered_map<gd::String, std::weak_ptr<PhysicsShapeTemplate> >
+      sharedTemplates;  ///< The templates, by string of coordinates.
+};
+
+#endif  // PHYSICSSHAPETEMPLATE_H
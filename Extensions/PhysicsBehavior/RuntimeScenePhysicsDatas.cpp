@@ -6,12 +6,32 @@ This project is released under the MIT License.
 */
 
 #include "RuntimeScenePhysicsDatas.h"
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #include "Box2D/Box2D.h"
 #include "ContactListener.h"
 #include "GDCpp/Runtime/Serialization/SerializerElement.h"
 #include "ScenePhysicsDatas.h"
 
+/**
+ * \brief The thread doing the steps of the world in the background, and what
+ * is used to synchronize it with the main thread.
+ */
+struct RuntimeScenePhysicsDatas::BackgroundStepper {
+  BackgroundStepper() : stepsRequested(false), stopRequested(false) {}
+
+  std::thread thread;
+  std::mutex mutex;
+  std::condition_variable condition;
+  bool stepsRequested;  ///< Set by the main thread to launch the steps, and
+                        ///< reset by the background thread when they are done.
+  bool stopRequested;
+};
+
 RuntimeScenePhysicsDatas::RuntimeScenePhysicsDatas(
     const gd::SerializerElement& behaviorSharedDataContent)
     : BehaviorsRuntimeSharedData(behaviorSharedDataContent),
@@ -28,7 +48,17 @@ RuntimeScenePhysicsDatas::RuntimeScenePhysicsDatas(
       invScaleY(1 / scaleY),
       fixedTimeStep(1.f / 60.f),
       maxSteps(5),
-      totalTime(0) {
+      totalTime(0),
+      stepInBackground(behaviorSharedDataContent.HasAttribute(
+                           "stepInBackground") &&
+                       behaviorSharedDataContent.GetBoolAttribute(
+                           "stepInBackground")),
+      stepsInProgress(false),
+      pendingSteps(0),
+      updatedBodiesCount(0),
+      velocityIterations(6),
+      positionIterations(10),
+      interpolationFactor(0) {
   world->SetContactListener(contactListener);
   world->SetAutoClearForces(false);
 
@@ -52,7 +82,161 @@ void RuntimeScenePhysicsDatas::StepWorld(float dt, int v, int p) {
   }
 }
 
+void RuntimeScenePhysicsDatas::SetStepInBackground(bool enable) {
+  if (stepInBackground == enable) return;
+
+  WaitForBackgroundSteps();
+  if (pendingSteps > 0) {
+    DoPendingSteps();
+    pendingSteps = 0;
+  }
+
+  stepInBackground = enable;
+  frontTransforms.clear();
+}
+
+void RuntimeScenePhysicsDatas::BeginBackgroundSteps(float dt, int v, int p) {
+  WaitForBackgroundSteps();
+  if (pendingSteps > 0) {
+    // The steps of the previous frame were not launched, as some bodies were
+    // not updated after the events (objects removed from the scene...).
+    DoPendingSteps();
+    frontTransforms.swap(backTransforms);
+  }
+
+  velocityIterations = v;
+  positionIterations = p;
+  updatedBodiesCount = 0;
+  pendingSteps = 0;
+
+  totalTime += dt;
+  if (totalTime > fixedTimeStep) {
+    std::size_t numberOfSteps(std::floor(totalTime / fixedTimeStep));
+    totalTime -= numberOfSteps * fixedTimeStep;
+
+    pendingSteps = std::min(numberOfSteps, maxSteps);
+  }
+
+  interpolationFactor = std::min(totalTime / fixedTimeStep, 1.0f);
+}
+
+void RuntimeScenePhysicsDatas::NotifyBodyUpdatedAfterEvents() {
+  if (!stepInBackground || stepsInProgress || pendingSteps == 0) return;
+
+  // Launch the steps once all the bodies (except staticBody) were updated.
+  updatedBodiesCount++;
+  if (updatedBodiesCount < static_cast<std::size_t>(world->GetBodyCount() - 1))
+    return;
+
+  if (!backgroundStepper) {
+    backgroundStepper = std::make_shared<BackgroundStepper>();
+    BackgroundStepper* stepper = backgroundStepper.get();
+    stepper->thread = std::thread([this, stepper]() {
+      std::unique_lock<std::mutex> lock(stepper->mutex);
+      while (true) {
+        stepper->condition.wait(lock, [stepper]() {
+          return stepper->stepsRequested || stepper->stopRequested;
+        });
+        if (stepper->stopRequested) return;
+
+        lock.unlock();
+        DoPendingSteps();
+        lock.lock();
+
+        stepper->stepsRequested = false;
+        stepper->condition.notify_all();
+      }
+    });
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(backgroundStepper->mutex);
+    backgroundStepper->stepsRequested = true;
+  }
+  backgroundStepper->condition.notify_all();
+  stepsInProgress = true;
+}
+
+void RuntimeScenePhysicsDatas::WaitForBackgroundSteps() {
+  if (!stepsInProgress) return;
+
+  {
+    std::unique_lock<std::mutex> lock(backgroundStepper->mutex);
+    backgroundStepper->condition.wait(
+        lock, [this]() { return !backgroundStepper->stepsRequested; });
+  }
+  stepsInProgress = false;
+  pendingSteps = 0;
+  frontTransforms.swap(backTransforms);
+}
+
+void RuntimeScenePhysicsDatas::DoPendingSteps() {
+  backTransforms.clear();
+  for (std::size_t a = 0; a < pendingSteps; a++) {
+    if (a == pendingSteps - 1) {
+      // Remember the positions before the last step, for interpolation.
+      for (const b2Body* body = world->GetBodyList(); body;
+           body = body->GetNext()) {
+        if (!body->GetUserData()) continue;
+
+        BodyTransform transform;
+        transform.body = body;
+        transform.previousX = body->GetPosition().x;
+        transform.previousY = body->GetPosition().y;
+        transform.previousAngle = body->GetAngle();
+        backTransforms.push_back(transform);
+      }
+    }
+
+    world->Step(fixedTimeStep, velocityIterations, positionIterations);
+    world->ClearForces();
+  }
+
+  for (BodyTransform& transform : backTransforms) {
+    transform.x = transform.body->GetPosition().x;
+    transform.y = transform.body->GetPosition().y;
+    transform.angle = transform.body->GetAngle();
+  }
+  std::sort(backTransforms.begin(), backTransforms.end());
+}
+
+bool RuntimeScenePhysicsDatas::GetInterpolatedTransform(const b2Body* body,
+                                                        float& x,
+                                                        float& y,
+                                                        float& angle) const {
+  BodyTransform searched;
+  searched.body = body;
+  auto it = std::lower_bound(
+      frontTransforms.begin(), frontTransforms.end(), searched);
+  if (it == frontTransforms.end() || it->body != body) return false;
+
+  x = it->previousX + (it->x - it->previousX) * interpolationFactor;
+  y = it->previousY + (it->y - it->previousY) * interpolationFactor;
+  angle = it->previousAngle +
+          (it->angle - it->previousAngle) * interpolationFactor;
+  return true;
+}
+
+void RuntimeScenePhysicsDatas::InvalidateBodyTransform(const b2Body* body) {
+  BodyTransform searched;
+  searched.body = body;
+  auto it = std::lower_bound(
+      frontTransforms.begin(), frontTransforms.end(), searched);
+  if (it != frontTransforms.end() && it->body == body)
+    frontTransforms.erase(it);
+}
+
 RuntimeScenePhysicsDatas::~RuntimeScenePhysicsDatas() {
+  WaitForBackgroundSteps();
+  if (backgroundStepper) {
+    {
+      std::lock_guard<std::mutex> lock(backgroundStepper->mutex);
+      backgroundStepper->stopRequested = true;
+    }
+    backgroundStepper->condition.notify_all();
+    backgroundStepper->thread.join();
+  }
+
   delete world;
   delete contactListener;
 }
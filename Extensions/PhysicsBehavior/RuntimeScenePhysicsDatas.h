@@ -7,6 +7,8 @@ This project is released under the MIT License.
 
 #ifndef RUNTIMESCENEPHYSICSDATAS_H
 #define RUNTIMESCENEPHYSICSDATAS_H
+#include <memory>
+#include <vector>
 namespace gd {
 class SerializerElement;
 }
@@ -25,8 +27,10 @@ class RuntimeScenePhysicsDatas : public BehaviorsRuntimeSharedData {
       const gd::SerializerElement& behaviorSharedDataContent);
   virtual ~RuntimeScenePhysicsDatas();
   virtual std::shared_ptr<BehaviorsRuntimeSharedData> Clone() const {
-    return std::shared_ptr<BehaviorsRuntimeSharedData>(
-        new RuntimeScenePhysicsDatas(*this));
+    RuntimeScenePhysicsDatas* clone = new RuntimeScenePhysicsDatas(*this);
+    clone->backgroundStepper.reset();  // The thread is not shared.
+    clone->stepsInProgress = false;
+    return std::shared_ptr<BehaviorsRuntimeSharedData>(clone);
   }
 
   b2World* world;
@@ -62,7 +66,90 @@ class RuntimeScenePhysicsDatas : public BehaviorsRuntimeSharedData {
    */
   void StepWorld(float dt, int v, int p);
 
+  /**
+   * \brief Return true if the world is simulated in a background thread.
+   * \see BeginBackgroundSteps
+   */
+  bool IsSteppingInBackground() const { return stepInBackground; }
+
+  /**
+   * \brief Enable or disable the simulation of the world in a background
+   * thread.
+   */
+  void SetStepInBackground(bool enable);
+
+  /**
+   * \brief Replace StepWorld when the world is simulated in a background
+   * thread.
+   *
+   * The steps done in the background during the previous frame are published
+   * and the steps for this frame are computed, but they are only launched
+   * once all the bodies were updated by PhysicsRuntimeBehavior after the
+   * events (see NotifyBodyUpdatedAfterEvents). Objects are so one frame late
+   * on the simulation, and are interpolated between the two last steps.
+   *
+   * \warning The world must not be accessed when steps are in progress: use
+   * WaitForBackgroundSteps before accessing it outside of the events.
+   */
+  void BeginBackgroundSteps(float dt, int v, int p);
+
+  /**
+   * \brief To be called by each PhysicsRuntimeBehavior after updating its body
+   * after the events. Launch the steps of the frame when all the bodies were
+   * updated.
+   */
+  void NotifyBodyUpdatedAfterEvents();
+
+  /**
+   * \brief Wait for the end of the steps done in the background, if any, and
+   * publish their results.
+   */
+  void WaitForBackgroundSteps();
+
+  /**
+   * \brief Get the position and angle of a body, interpolated between the two
+   * last steps done in the background.
+   * \return false if the body was not simulated in the background since its
+   * creation or its last change of position.
+   */
+  bool GetInterpolatedTransform(const b2Body* body,
+                                float& x,
+                                float& y,
+                                float& angle) const;
+
+  /**
+   * \brief Forget the interpolated position of a body, after it was moved or
+   * before it is destroyed.
+   */
+  void InvalidateBodyTransform(const b2Body* body);
+
  private:
+  /**
+   * \brief The position of a body after the steps done in the background, and
+   * before the last of these steps.
+   */
+  struct BodyTransform {
+    const b2Body* body;
+    float previousX;
+    float previousY;
+    float previousAngle;
+    float x;
+    float y;
+    float angle;
+
+    bool operator<(const BodyTransform& other) const {
+      return body < other.body;
+    }
+  };
+
+  struct BackgroundStepper;
+
+  /**
+   * \brief Do the pending steps, and store the positions of the bodies in
+   * backTransforms.
+   */
+  void DoPendingSteps();
+
   float scaleX;
   float scaleY;
   float invScaleX;
@@ -77,6 +164,21 @@ class RuntimeScenePhysicsDatas : public BehaviorsRuntimeSharedData {
                  ///< force it to make even more steps...)
 
   float totalTime;
+
+  bool stepInBackground;
+  std::shared_ptr<BackgroundStepper> backgroundStepper;
+  bool stepsInProgress;  ///< True if the pending steps were launched in the
+                         ///< background thread and are not finished.
+  std::size_t pendingSteps;  ///< The steps to be done for this frame.
+  std::size_t updatedBodiesCount;  ///< The number of bodies updated after
+                                   ///< the events since BeginBackgroundSteps.
+  int velocityIterations;
+  int positionIterations;
+  float interpolationFactor;
+  std::vector<BodyTransform>
+      frontTransforms;  ///< The published positions of the bodies, sorted.
+  std::vector<BodyTransform>
+      backTransforms;  ///< The positions written by the background thread.
 };
 
 #endif  // RUNTIMESCENEPHYSICSDATAS_H
@@ -22,6 +22,7 @@ void ScenePhysicsDatas::InitializeContent(
   behaviorSharedDataContent.SetAttribute("gravityY", 9);
   behaviorSharedDataContent.SetAttribute("scaleX", 100);
   behaviorSharedDataContent.SetAttribute("scaleY", 100);
+  behaviorSharedDataContent.SetAttribute("stepInBackground", false);
 };
 
 #if defined(GD_IDE_ONLY)
@@ -36,6 +37,13 @@ std::map<gd::String, gd::PropertyDescriptor> ScenePhysicsDatas::GetProperties(
       gd::String::From(behaviorSharedDataContent.GetDoubleAttribute("scaleX")));
   properties[_("Y Scale: number of pixels for 1 meter")].SetValue(
       gd::String::From(behaviorSharedDataContent.GetDoubleAttribute("scaleY")));
+  properties[_("Simulate in a background thread (native games)")]
+      .SetValue(behaviorSharedDataContent.HasAttribute("stepInBackground") &&
+                        behaviorSharedDataContent.GetBoolAttribute(
+                            "stepInBackground")
+                    ? "true"
+                    : "false")
+      .SetType("Boolean");
 
   return properties;
 }
@@ -56,6 +64,9 @@ bool ScenePhysicsDatas::UpdateProperty(
   if (name == _("Y scale: number of pixels for 1 meter")) {
     behaviorSharedDataContent.SetAttribute("scaleY", value.To<float>());
   }
+  if (name == _("Simulate in a background thread (native games)")) {
+    behaviorSharedDataContent.SetAttribute("stepInBackground", (value != "0"));
+  }
 
   return true;
 }
@@ -0,0 +1,185 @@
+/**
+
+GDevelop - Physics Behavior Extension
+Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+/**
+ * @file Benchmarks of the simulation of the physics world.
+ */
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include "../PhysicsBehavior.h"
+#include "../PhysicsRuntimeBehavior.h"
+#include "../RuntimeScenePhysicsDatas.h"
+#include "../ScenePhysicsDatas.h"
+#include "Box2D/Box2D.h"
+#include "GDCore/CommonTools.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCpp/Extensions/CppPlatform.h"
+#include "GDCpp/Extensions/ExtensionBase.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+extern "C" ExtensionBase *GD_EXTENSION_API CreateGDExtension();
+
+namespace {
+class BenchmarkRuntimeObject : public RuntimeObject {
+ public:
+  BenchmarkRuntimeObject(RuntimeScene &scene, const gd::Object &obj)
+      : RuntimeObject(scene, obj) {}
+
+  float GetWidth() const override { return 64; }
+  float GetHeight() const override { return 64; }
+};
+}  // namespace
+
+TEST_CASE("PhysicsBehavior - Benchmarks", "[game-engine][benchmarks]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  // A pile of boxes falling on a ground, with the events and the rendering of
+  // each frame simulated by a busy loop of 2 milliseconds.
+  auto doFrames = [&](const gd::String &benchmarkName, bool stepInBackground) {
+    gd::SerializerElement sharedDataContent;
+    ScenePhysicsDatas sharedData;
+    sharedData.InitializeContent(sharedDataContent);
+    sharedDataContent.SetAttribute("stepInBackground", stepInBackground);
+    RuntimeScenePhysicsDatas datas(sharedDataContent);
+
+    gd::SerializerElement behaviorContent;
+    PhysicsBehavior behavior;
+    behavior.InitializeContent(behaviorContent);
+    std::vector<std::unique_ptr<PhysicsRuntimeBehavior>> behaviors;
+
+    b2BodyDef groundDef;
+    b2Body *ground = datas.world->CreateBody(&groundDef);
+    b2PolygonShape groundShape;
+    groundShape.SetAsBox(100, 1);
+    ground->CreateFixture(&groundShape, 0);
+    behaviors.push_back(
+        gd::make_unique<PhysicsRuntimeBehavior>(behaviorContent));
+    ground->SetUserData(behaviors.back().get());
+    for (std::size_t i = 0; i < 600; ++i) {
+      b2BodyDef boxDef;
+      boxDef.type = b2_dynamicBody;
+      boxDef.position.Set(-30 + (i % 30) * 2, 3 + (i / 30) * 1.5);
+      b2Body *box = datas.world->CreateBody(&boxDef);
+      b2PolygonShape boxShape;
+      boxShape.SetAsBox(0.5, 0.5);
+      box->CreateFixture(&boxShape, 1);
+      behaviors.push_back(
+          gd::make_unique<PhysicsRuntimeBehavior>(behaviorContent));
+      box->SetUserData(behaviors.back().get());
+    }
+
+    doBenchmark(benchmarkName, 120, [&]() {
+      if (stepInBackground) {
+        datas.BeginBackgroundSteps(1.0 / 60.0 + 0.0001, 6, 10);
+        for (std::size_t i = 0; i < behaviors.size() - 1; ++i)
+          datas.NotifyBodyUpdatedAfterEvents();
+      } else {
+        datas.StepWorld(1.0 / 60.0 + 0.0001, 6, 10);
+      }
+
+      auto start = std::chrono::steady_clock::now();
+      while (std::chrono::steady_clock::now() - start <
+             std::chrono::milliseconds(2)) {
+      }
+    });
+    datas.WaitForBackgroundSteps();
+  };
+
+  SECTION("Frames with 600 boxes") {
+    doFrames("Frame with 600 boxes", false);
+    doFrames("Frame with 600 boxes (steps in background)", true);
+  }
+
+  SECTION("Spawn objects with a custom polygon") {
+    CppPlatform::Get().AddExtension(
+        std::shared_ptr<gd::PlatformExtension>(CreateGDExtension()));
+
+    // A concave star, with 16 vertices.
+    std::vector<sf::Vector2f> star;
+    for (int i = 0; i < 16; ++i) {
+      float radius = i % 2 == 0 ? 32 : 12;
+      star.push_back(sf::Vector2f(32 + radius * cos(i * b2_pi / 8),
+                                  32 + radius * sin(i * b2_pi / 8)));
+    }
+
+    RuntimeGame game;
+    gd::Object object("MyObject");
+    gd::BehaviorContent &behaviorContent = object.AddBehavior(
+        gd::BehaviorContent("Physics", "PhysicsBehavior::PhysicsBehavior"));
+    PhysicsBehavior behavior;
+    behavior.InitializeContent(behaviorContent.GetContent());
+    behaviorContent.GetContent().SetAttribute("shapeType", "CustomPolygon");
+    behaviorContent.GetContent().SetAttribute(
+        "coordsList",
+        PhysicsRuntimeBehavior::GetStringFromCoordsVector(star, '/', ';'));
+
+    gd::SerializerElement layoutElement;
+    gd::SerializerElement &sharedDataElements =
+        layoutElement.AddChild("behaviorsSharedData");
+    sharedDataElements.ConsiderAsArrayOf("behaviorSharedData");
+    gd::SerializerElement &sharedDataElement =
+        sharedDataElements.AddChild("behaviorSharedData");
+    ScenePhysicsDatas sharedData;
+    sharedData.InitializeContent(sharedDataElement);
+    sharedDataElement.SetAttribute("type", "PhysicsBehavior::PhysicsBehavior");
+    sharedDataElement.SetAttribute("name", "Physics");
+    gd::Layout layout;
+    layout.UnserializeFrom(game, layoutElement);
+
+    RuntimeScene scene(NULL, &game);
+    scene.LoadFromScene(layout);
+
+    std::vector<std::unique_ptr<BenchmarkRuntimeObject>> objects;
+    doBenchmark("Spawn 500 objects with a custom polygon", 10, [&]() {
+      for (std::size_t i = 0; i < 500; ++i) {
+        objects.push_back(
+            gd::make_unique<BenchmarkRuntimeObject>(scene, object));
+        objects.back()->SetX((i % 50) * 70);
+        objects.back()->SetY((i / 50) * 70);
+
+        RuntimeBehavior *behavior =
+            objects.back()->GetBehaviorRawPointer("Physics");
+        behavior->SetName("Physics");
+        static_cast<PhysicsRuntimeBehavior *>(behavior)->GetBox2DBody(scene);
+      }
+    });
+
+    // Remove the objects after a step, like in a game, as Box2D is slow to
+    // destroy bodies that were not stepped.
+    std::static_pointer_cast<RuntimeScenePhysicsDatas>(
+        scene.GetBehaviorSharedData("Physics"))
+        ->StepWorld(1.0 / 60.0, 6, 10);
+    objects.clear();
+  }
+}
@@ -0,0 +1,251 @@
+/**
+
+GDevelop - Physics Behavior Extension
+Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+/**
+ * @file Tests for the shapes of the bodies of the Physics extension.
+ */
+#include "../PhysicsRuntimeBehavior.h"
+#include <memory>
+#include <vector>
+#include "../PhysicsBehavior.h"
+#include "../PhysicsShapeTemplate.h"
+#include "../ScenePhysicsDatas.h"
+#include "Box2D/Box2D.h"
+#include "GDCore/CommonTools.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCpp/Extensions/CppPlatform.h"
+#include "GDCpp/Extensions/ExtensionBase.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "Triangulation/triangulate.h"
+#include "catch.hpp"
+
+extern "C" ExtensionBase *GD_EXTENSION_API CreateGDExtension();
+
+namespace {
+// Mock objects that can have a specific size
+class ResizableRuntimeObject : public RuntimeObject {
+ public:
+  ResizableRuntimeObject(RuntimeScene &scene, const gd::Object &obj)
+      : RuntimeObject(scene, obj), width(0), height(0) {}
+
+  float GetWidth() const override { return width; }
+  float GetHeight() const override { return height; }
+  void SetWidth(float newWidth) override { width = newWidth; }
+  void SetHeight(float newHeight) override { height = newHeight; }
+
+ private:
+  float width;
+  float height;
+};
+
+const gd::String concavePolygon = "0;0/100;0/100;100/50;100/50;50/0;50";
+
+/**
+ * Compute the vertices of the triangles of a polygon positioned on the origin
+ * of an object, as done before the triangles were shared.
+ */
+std::vector<b2Vec2> GetTrianglesVerticesWithoutTemplate(
+    const std::vector<sf::Vector2f> &polygonCoords,
+    const PhysicsShapeTemplate::ShapesParameters &parameters) {
+  std::vector<sf::Vector2f> resultOfTriangulation;
+  Triangulate::Process(polygonCoords, resultOfTriangulation);
+
+  std::vector<b2Vec2> vertices;
+  for (std::size_t i = 0; i < resultOfTriangulation.size() / 3; i++) {
+    for (int a = 2; a >= 0; a--) {
+      b2Vec2 vertex;
+      vertex.Set(
+          (resultOfTriangulation.at(i * 3 + a).x * parameters.scaleX -
+           parameters.width / 2 - parameters.offsetX) *
+              parameters.invScaleX,
+          (((parameters.height -
+             (resultOfTriangulation.at(i * 3 + a).y * parameters.scaleY)) -
+            parameters.height / 2 + parameters.offsetY) *
+           parameters.invScaleY));
+      vertices.push_back(vertex);
+    }
+  }
+
+  return vertices;
+}
+}  // namespace
+
+TEST_CASE("PhysicsShapeTemplate", "[game-engine][physics]") {
+  SECTION("Templates are shared by the behaviors using the same polygon") {
+    std::size_t sharedTemplatesCount =
+        PhysicsShapeTemplate::GetSharedTemplatesCount();
+    std::shared_ptr<PhysicsShapeTemplate> shapeTemplate =
+        PhysicsShapeTemplate::Get(concavePolygon);
+    REQUIRE(PhysicsShapeTemplate::Get(concavePolygon) == shapeTemplate);
+    REQUIRE(PhysicsShapeTemplate::Get("0;0/10;0/10;10") != shapeTemplate);
+    REQUIRE(PhysicsShapeTemplate::GetSharedTemplatesCount() ==
+            sharedTemplatesCount + 1);
+
+    shapeTemplate.reset();
+    REQUIRE(PhysicsShapeTemplate::GetSharedTemplatesCount() ==
+            sharedTemplatesCount);
+  }
+
+  SECTION("Polygons are triangulated") {
+    std::shared_ptr<PhysicsShapeTemplate> shapeTemplate =
+        PhysicsShapeTemplate::Get(concavePolygon);
+    REQUIRE(shapeTemplate->GetPolygonCoords().size() == 6);
+    REQUIRE(shapeTemplate->GetTriangles().size() == 4 * 3);
+
+    REQUIRE(PhysicsShapeTemplate::Get("0;0/10;0")->GetTriangles().empty());
+    REQUIRE(PhysicsShapeTemplate::Get("")->GetPolygonCoords().empty());
+  }
+
+  SECTION("Shapes are computed only for new parameters") {
+    std::shared_ptr<PhysicsShapeTemplate> shapeTemplate =
+        PhysicsShapeTemplate::Get(concavePolygon);
+
+    PhysicsShapeTemplate::ShapesParameters parameters;
+    parameters.onOrigin = true;
+    parameters.scaleX = 1.5;
+    parameters.scaleY = 0.7;
+    parameters.width = 150;
+    parameters.height = 70;
+    parameters.offsetX = -10;
+    parameters.offsetY = 5;
+    parameters.invScaleX = 1.f / 100.f;
+    parameters.invScaleY = 1.f / 100.f;
+
+    auto requireSameVertices = [&]() {
+      const std::vector<b2PolygonShape> &shapes =
+          shapeTemplate->GetShapes(parameters);
+      std::vector<b2Vec2> expectedVertices =
+          GetTrianglesVerticesWithoutTemplate(
+              shapeTemplate->GetPolygonCoords(), parameters);
+
+      REQUIRE(expectedVertices.size() == shapes.size() * 3);
+      for (std::size_t i = 0; i < shapes.size(); ++i) {
+        b2PolygonShape expectedShape;
+        expectedShape.Set(&expectedVertices[i * 3], 3);
+
+        REQUIRE(shapes[i].m_vertexCount == expectedShape.m_vertexCount);
+        for (int v = 0; v < shapes[i].m_vertexCount; ++v) {
+          REQUIRE(shapes[i].m_vertices[v].x == expectedShape.m_vertices[v].x);
+          REQUIRE(shapes[i].m_vertices[v].y == expectedShape.m_vertices[v].y);
+        }
+      }
+    };
+
+    requireSameVertices();
+    const b2PolygonShape *firstShape = &shapeTemplate->GetShapes(parameters)[0];
+    b2Vec2 firstVertex = firstShape->m_vertices[0];
+
+    parameters.width = 300;
+    requireSameVertices();
+    REQUIRE(shapeTemplate->GetShapes(parameters)[0].m_vertices[0].x !=
+            firstVertex.x);
+
+    parameters.width = 150;
+    requireSameVertices();
+    REQUIRE(shapeTemplate->GetShapes(parameters)[0].m_vertices[0].x ==
+            firstVertex.x);
+    REQUIRE(&shapeTemplate->GetShapes(parameters)[0] == firstShape);
+  }
+}
+
+TEST_CASE("PhysicsRuntimeBehavior", "[game-engine][physics]") {
+  CppPlatform::Get().AddExtension(
+      std::shared_ptr<gd::PlatformExtension>(CreateGDExtension()));
+
+  RuntimeGame game;
+  gd::Object object("MyObject");
+  gd::BehaviorContent &behaviorContent = object.AddBehavior(
+      gd::BehaviorContent("Physics", "PhysicsBehavior::PhysicsBehavior"));
+  PhysicsBehavior behavior;
+  behavior.InitializeContent(behaviorContent.GetContent());
+  behaviorContent.GetContent().SetAttribute("shapeType", "CustomPolygon");
+  behaviorContent.GetContent().SetAttribute("positioning", "OnOrigin");
+  behaviorContent.GetContent().SetAttribute("coordsList", concavePolygon);
+
+  // Load a scene with the shared data of the behavior.
+  gd::SerializerElement layoutElement;
+  gd::SerializerElement &sharedDataElements =
+      layoutElement.AddChild("behaviorsSharedData");
+  sharedDataElements.ConsiderAsArrayOf("behaviorSharedData");
+  gd::SerializerElement &sharedDataElement =
+      sharedDataElements.AddChild("behaviorSharedData");
+  ScenePhysicsDatas sharedData;
+  sharedData.InitializeContent(sharedDataElement);
+  sharedDataElement.SetAttribute("type", "PhysicsBehavior::PhysicsBehavior");
+  sharedDataElement.SetAttribute("name", "Physics");
+  gd::Layout layout;
+  layout.UnserializeFrom(game, layoutElement);
+
+  RuntimeScene scene(NULL, &game);
+  REQUIRE(scene.LoadFromScene(layout) == true);
+
+  std::vector<std::unique_ptr<ResizableRuntimeObject>> objects;
+  for (std::size_t i = 0; i < 3; ++i) {
+    objects.push_back(gd::make_unique<ResizableRuntimeObject>(scene, object));
+    objects.back()->SetWidth(100);
+    objects.back()->SetHeight(100);
+    objects.back()->SetX(i * 200);
+    objects.back()->GetBehaviorRawPointer("Physics")->SetName("Physics");
+  }
+  auto getBehavior = [&](std::size_t i) {
+    return static_cast<PhysicsRuntimeBehavior *>(
+        objects[i]->GetBehaviorRawPointer("Physics"));
+  };
+  auto getFixturesCount = [&](std::size_t i) {
+    std::size_t count = 0;
+    b2Body *body = getBehavior(i)->GetBox2DBody(scene);
+    for (b2Fixture *fixture = body->GetFixtureList(); fixture;
+         fixture = fixture->GetNext())
+      count++;
+
+    return count;
+  };
+
+  SECTION("Bodies are created from the triangles of the polygon") {
+    for (std::size_t i = 0; i < objects.size(); ++i) {
+      REQUIRE(getBehavior(i)->GetPolygonCoords().size() == 6);
+      REQUIRE(getFixturesCount(i) == 4);
+    }
+
+    b2Fixture *fixture =
+        getBehavior(0)->GetBox2DBody(scene)->GetFixtureList();
+    b2Fixture *otherFixture =
+        getBehavior(2)->GetBox2DBody(scene)->GetFixtureList();
+    for (; fixture && otherFixture;
+         fixture = fixture->GetNext(), otherFixture = otherFixture->GetNext()) {
+      const b2PolygonShape *shape =
+          static_cast<const b2PolygonShape *>(fixture->GetShape());
+      const b2PolygonShape *otherShape =
+          static_cast<const b2PolygonShape *>(otherFixture->GetShape());
+      REQUIRE(shape->m_vertexCount == otherShape->m_vertexCount);
+      for (int v = 0; v < shape->m_vertexCount; ++v) {
+        REQUIRE(shape->m_vertices[v].x == otherShape->m_vertices[v].x);
+        REQUIRE(shape->m_vertices[v].y == otherShape->m_vertices[v].y);
+      }
+    }
+  }
+
+  SECTION("Changing the polygon of a behavior does not change the others") {
+    std::vector<sf::Vector2f> triangle;
+    triangle.push_back(sf::Vector2f(0, 0));
+    triangle.push_back(sf::Vector2f(50, 0));
+    triangle.push_back(sf::Vector2f(50, 50));
+    REQUIRE(getFixturesCount(0) == 4);
+    getBehavior(0)->SetPolygonCoords(triangle);
+    getBehavior(0)->SetPolygonScaleX(2, scene);
+
+    REQUIRE(getBehavior(0)->GetPolygonCoords().size() == 3);
+    REQUIRE(getFixturesCount(0) == 1);
+    REQUIRE(getBehavior(1)->GetPolygonCoords().size() == 6);
+    REQUIRE(getFixturesCount(1) == 4);
+  }
+
+  objects.clear();
+}
@@ -0,0 +1,168 @@
+/**
+
+GDevelop - Physics Behavior Extension
+Copyright (c) 2010-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+/**
+ * @file Tests for the Physics extension.
+ */
+#define CATCH_CONFIG_MAIN
+#include "../RuntimeScenePhysicsDatas.h"
+#include <memory>
+#include <vector>
+#include "../PhysicsBehavior.h"
+#include "../PhysicsRuntimeBehavior.h"
+#include "../ScenePhysicsDatas.h"
+#include "Box2D/Box2D.h"
+#include "GDCore/CommonTools.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+std::unique_ptr<RuntimeScenePhysicsDatas> CreateRuntimeScenePhysicsDatas(
+    bool stepInBackground) {
+  gd::SerializerElement sharedDataContent;
+  ScenePhysicsDatas sharedData;
+  sharedData.InitializeContent(sharedDataContent);
+  sharedDataContent.SetAttribute("stepInBackground", stepInBackground);
+  return gd::make_unique<RuntimeScenePhysicsDatas>(sharedDataContent);
+}
+
+/**
+ * Create a ground and boxes falling on it, in a world. Behaviors are only used
+ * as the user data of the bodies, as expected by the contact listener.
+ */
+void CreateBodies(
+    RuntimeScenePhysicsDatas &datas,
+    std::size_t boxesCount,
+    std::vector<std::unique_ptr<PhysicsRuntimeBehavior>> &behaviors,
+    std::vector<b2Body *> &boxes) {
+  gd::SerializerElement behaviorContent;
+  PhysicsBehavior behavior;
+  behavior.InitializeContent(behaviorContent);
+
+  b2BodyDef groundDef;
+  b2Body *ground = datas.world->CreateBody(&groundDef);
+  b2PolygonShape groundShape;
+  groundShape.SetAsBox(100, 1);
+  ground->CreateFixture(&groundShape, 0);
+  behaviors.push_back(
+      gd::make_unique<PhysicsRuntimeBehavior>(behaviorContent));
+  ground->SetUserData(behaviors.back().get());
+
+  for (std::size_t i = 0; i < boxesCount; ++i) {
+    b2BodyDef boxDef;
+    boxDef.type = b2_dynamicBody;
+    boxDef.position.Set(-50 + (i % 50) * 2, 3 + (i / 50) * 2);
+    boxDef.angle = i * 0.1;
+    b2Body *box = datas.world->CreateBody(&boxDef);
+    b2PolygonShape boxShape;
+    boxShape.SetAsBox(0.5, 0.5);
+    box->CreateFixture(&boxShape, 1);
+    behaviors.push_back(
+        gd::make_unique<PhysicsRuntimeBehavior>(behaviorContent));
+    box->SetUserData(behaviors.back().get());
+    boxes.push_back(box);
+  }
+}
+
+/**
+ * Do what PhysicsRuntimeBehavior does during a frame, when the world is
+ * simulated in the background.
+ */
+void DoBackgroundFrame(RuntimeScenePhysicsDatas &datas, float elapsedTime) {
+  datas.BeginBackgroundSteps(elapsedTime, 6, 10);
+  for (int i = 0; i < datas.world->GetBodyCount() - 1; ++i)
+    datas.NotifyBodyUpdatedAfterEvents();
+}
+}  // namespace
+
+TEST_CASE("RuntimeScenePhysicsDatas", "[game-engine][physics]") {
+  std::vector<std::unique_ptr<PhysicsRuntimeBehavior>> behaviors;
+  std::unique_ptr<RuntimeScenePhysicsDatas> datas =
+      CreateRuntimeScenePhysicsDatas(false);
+  std::vector<b2Body *> boxes;
+  CreateBodies(*datas, 100, behaviors, boxes);
+
+  std::unique_ptr<RuntimeScenePhysicsDatas> backgroundDatas =
+      CreateRuntimeScenePhysicsDatas(true);
+  std::vector<b2Body *> backgroundBoxes;
+  CreateBodies(*backgroundDatas, 100, behaviors, backgroundBoxes);
+
+  REQUIRE(datas->IsSteppingInBackground() == false);
+  REQUIRE(backgroundDatas->IsSteppingInBackground() == true);
+
+  auto requireSamePositions = [&]() {
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+      REQUIRE(boxes[i]->GetPosition().x ==
+              backgroundBoxes[i]->GetPosition().x);
+      REQUIRE(boxes[i]->GetPosition().y ==
+              backgroundBoxes[i]->GetPosition().y);
+      REQUIRE(boxes[i]->GetAngle() == backgroundBoxes[i]->GetAngle());
+    }
+  };
+
+  SECTION("Steps done in the background give the same results") {
+    for (std::size_t frame = 0; frame < 200; ++frame) {
+      float elapsedTime = (frame % 3 == 0) ? 0.035 : 0.012;
+      datas->StepWorld(elapsedTime, 6, 10);
+      DoBackgroundFrame(*backgroundDatas, elapsedTime);
+
+      backgroundDatas->WaitForBackgroundSteps();
+      requireSamePositions();
+    }
+
+    // The boxes are on the ground, and touching it.
+    REQUIRE(boxes[0]->GetPosition().y < 2);
+    REQUIRE(behaviors[0]->currentContacts.empty() == false);
+  }
+
+  SECTION("Steps are not launched until all bodies are updated") {
+    backgroundDatas->BeginBackgroundSteps(0.1, 6, 10);
+    backgroundDatas->NotifyBodyUpdatedAfterEvents();
+    backgroundDatas->WaitForBackgroundSteps();
+    REQUIRE(backgroundBoxes[0]->GetPosition().y == 3);
+
+    // The steps are done at the beginning of the next frame instead.
+    datas->StepWorld(0.1, 6, 10);
+    backgroundDatas->BeginBackgroundSteps(0, 6, 10);
+    requireSamePositions();
+  }
+
+  SECTION("Positions are interpolated between the two last steps") {
+    float x, y, angle;
+    REQUIRE(backgroundDatas->GetInterpolatedTransform(
+                backgroundBoxes[0], x, y, angle) == false);
+
+    for (std::size_t frame = 0; frame < 10; ++frame)
+      DoBackgroundFrame(*backgroundDatas, 1.0 / 60.0 + 0.001);
+
+    // Publish the last steps, without doing new ones.
+    backgroundDatas->BeginBackgroundSteps(0, 6, 10);
+    float lastY = backgroundBoxes[0]->GetPosition().y;
+    REQUIRE(backgroundDatas->GetInterpolatedTransform(
+                backgroundBoxes[0], x, y, angle) == true);
+    REQUIRE(y > lastY);  // The box is falling.
+    REQUIRE(y < 3);
+
+    // Moved bodies are not interpolated.
+    backgroundDatas->InvalidateBodyTransform(backgroundBoxes[0]);
+    REQUIRE(backgroundDatas->GetInterpolatedTransform(
+                backgroundBoxes[0], x, y, angle) == false);
+    REQUIRE(backgroundDatas->GetInterpolatedTransform(
+                backgroundBoxes[1], x, y, angle) == true);
+  }
+
+  SECTION("Background steps can be disabled") {
+    DoBackgroundFrame(*backgroundDatas, 0.1);
+    backgroundDatas->SetStepInBackground(false);
+    REQUIRE(backgroundDatas->IsSteppingInBackground() == false);
+
+    for (std::size_t frame = 0; frame < 10; ++frame) {
+      datas->StepWorld(0.1, 6, 10);
+      if (frame > 0) backgroundDatas->StepWorld(0.1, 6, 10);
+      requireSamePositions();
+    }
+  }
+}
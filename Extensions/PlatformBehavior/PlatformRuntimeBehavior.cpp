@@ -58,10 +58,16 @@ void PlatformRuntimeBehavior::DoStepPreEvents(RuntimeScene& scene) {
       sceneManager->AddPlatform(this);
       registeredInManager = true;
     }
+  } else if (registeredInManager) {
+    sceneManager->UpdatePlatform(this);
   }
 }
 
-void PlatformRuntimeBehavior::DoStepPostEvents(RuntimeScene& scene) {}
+void PlatformRuntimeBehavior::DoStepPostEvents(RuntimeScene& scene) {
+  // Update the platform position in the manager after it was moved by
+  // events, before platformer objects are moved.
+  if (sceneManager && registeredInManager) sceneManager->UpdatePlatform(this);
+}
 
 void PlatformRuntimeBehavior::ChangePlatformType(
     const gd::String& platformType_) {
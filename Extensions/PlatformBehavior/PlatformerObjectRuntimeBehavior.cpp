@@ -139,21 +139,22 @@ void PlatformerObjectRuntimeBehavior::DoStepPreEvents(RuntimeScene& scene) {
   requestedDeltaX += currentSpeed * timeDelta;
 
   // Compute the list of the objects that will be used
-  std::set<PlatformRuntimeBehavior*> potentialObjects =
-      GetPotentialCollidingObjects(std::max(requestedDeltaX, maxFallingSpeed));
-  std::set<PlatformRuntimeBehavior*> overlappedJumpThru =
-      GetJumpthruCollidingWith(potentialObjects);
+  GetPotentialCollidingObjects(std::max(requestedDeltaX, maxFallingSpeed),
+                               potentialObjects);
+  GetJumpthruCollidingWith(potentialObjects, overlappedJumpThru);
 
   // Check that the floor object still exists and is near the object.
-  if (isOnFloor &&
-      potentialObjects.find(floorPlatform) == potentialObjects.end()) {
+  if (isOnFloor && !std::binary_search(potentialObjects.begin(),
+                                       potentialObjects.end(),
+                                       floorPlatform)) {
     isOnFloor = false;
     floorPlatform = NULL;
   }
 
   // Check that the grabbed platform object still exists and is near the object.
-  if (isGrabbingPlatform &&
-      potentialObjects.find(grabbedPlatform) == potentialObjects.end()) {
+  if (isGrabbingPlatform && !std::binary_search(potentialObjects.begin(),
+                                                potentialObjects.end(),
+                                                grabbedPlatform)) {
     ReleaseGrabbedPlatform();
   }
 
@@ -271,8 +272,8 @@ void PlatformerObjectRuntimeBehavior::DoStepPreEvents(RuntimeScene& scene) {
 
     object->SetX(object->GetX() +
                  (requestedDeltaX > 0 ? xGrabTolerance : -xGrabTolerance));
-    auto collidingObjects =
-        GetPlatformsCollidingWith(potentialObjects, overlappedJumpThru);
+    GetPlatformsCollidingWith(
+        potentialObjects, overlappedJumpThru, collidingObjects);
     if (!collidingObjects.empty() &&
         CanGrab(*collidingObjects.begin(), requestedDeltaY)) {
       tryGrabbingPlatform = true;
@@ -433,7 +434,7 @@ void PlatformerObjectRuntimeBehavior::DoStepPreEvents(RuntimeScene& scene) {
   }
 
   // 3) Update the current floor data for the next tick:
-  overlappedJumpThru = GetJumpthruCollidingWith(potentialObjects);
+  GetJumpthruCollidingWith(potentialObjects, overlappedJumpThru);
   if (!isOnLadder) {
     // Check if the object is on a floor:
     // In priority, check if the last floor platform is still the floor.
@@ -452,8 +453,8 @@ void PlatformerObjectRuntimeBehavior::DoStepPreEvents(RuntimeScene& scene) {
       bool canLand = requestedDeltaY >= 0;
 
       // Check if landing on a new floor: (Exclude already overlapped jump thru)
-      std::set<PlatformRuntimeBehavior*> collidingObjects =
-          GetPlatformsCollidingWith(potentialObjects, overlappedJumpThru);
+      GetPlatformsCollidingWith(
+          potentialObjects, overlappedJumpThru, collidingObjects);
       if (canLand && !collidingObjects.empty()) {  // Just landed on floor
         isOnFloor = true;
         canJump = true;
@@ -509,57 +510,54 @@ void PlatformerObjectRuntimeBehavior::ReleaseGrabbedPlatform() {
 }
 
 bool PlatformerObjectRuntimeBehavior::SeparateFromPlatforms(
-    const std::set<PlatformRuntimeBehavior*>& candidates,
+    const std::vector<PlatformRuntimeBehavior*>& candidates,
     bool excludeJumpThrus) {
-  std::vector<RuntimeObject*> objects;
-  for (std::set<PlatformRuntimeBehavior*>::iterator it = candidates.begin();
-       it != candidates.end();
-       ++it) {
-    if ((*it)->GetPlatformType() == PlatformRuntimeBehavior::Ladder) continue;
+  separatedObjects.clear();
+  for (PlatformRuntimeBehavior* platform : candidates) {
+    if (platform->GetPlatformType() == PlatformRuntimeBehavior::Ladder)
+      continue;
     if (excludeJumpThrus &&
-        (*it)->GetPlatformType() == PlatformRuntimeBehavior::Jumpthru)
+        platform->GetPlatformType() == PlatformRuntimeBehavior::Jumpthru)
       continue;
 
-    objects.push_back((*it)->GetObject());
+    separatedObjects.push_back(platform->GetObject());
   }
 
-  return object->SeparateFromObjects(objects, ignoreTouchingEdges);
+  return object->SeparateFromObjects(separatedObjects, ignoreTouchingEdges);
 }
 
-std::set<PlatformRuntimeBehavior*>
-PlatformerObjectRuntimeBehavior::GetPlatformsCollidingWith(
-    const std::set<PlatformRuntimeBehavior*>& candidates,
-    const std::set<PlatformRuntimeBehavior*>& exceptTheseOnes) {
+void PlatformerObjectRuntimeBehavior::GetPlatformsCollidingWith(
+    const std::vector<PlatformRuntimeBehavior*>& candidates,
+    const std::vector<PlatformRuntimeBehavior*>& exceptTheseOnes,
+    std::vector<PlatformRuntimeBehavior*>& result) {
   // TODO: This function could be refactored to return only the first colliding
   // platform.
-  std::set<PlatformRuntimeBehavior*> result;
-  for (std::set<PlatformRuntimeBehavior*>::iterator it = candidates.begin();
-       it != candidates.end();
-       ++it) {
-    if (exceptTheseOnes.find(*it) != exceptTheseOnes.end()) continue;
-    if ((*it)->GetPlatformType() == PlatformRuntimeBehavior::Ladder) continue;
-
-    if (object->IsCollidingWith((*it)->GetObject(), ignoreTouchingEdges))
-      result.insert(*it);
-  }
+  result.clear();
+  for (PlatformRuntimeBehavior* platform : candidates) {
+    if (std::binary_search(
+            exceptTheseOnes.begin(), exceptTheseOnes.end(), platform))
+      continue;
+    if (platform->GetPlatformType() == PlatformRuntimeBehavior::Ladder)
+      continue;
 
-  return result;
+    if (object->IsCollidingWith(platform->GetObject(), ignoreTouchingEdges))
+      result.push_back(platform);
+  }
 }
 
 bool PlatformerObjectRuntimeBehavior::IsCollidingWith(
-    const std::set<PlatformRuntimeBehavior*>& candidates,
+    const std::vector<PlatformRuntimeBehavior*>& candidates,
     PlatformRuntimeBehavior* exceptThisOne,
     bool excludeJumpThrus) {
-  for (std::set<PlatformRuntimeBehavior*>::iterator it = candidates.begin();
-       it != candidates.end();
-       ++it) {
-    if (*it == exceptThisOne) continue;
-    if ((*it)->GetPlatformType() == PlatformRuntimeBehavior::Ladder) continue;
+  for (PlatformRuntimeBehavior* platform : candidates) {
+    if (platform == exceptThisOne) continue;
+    if (platform->GetPlatformType() == PlatformRuntimeBehavior::Ladder)
+      continue;
     if (excludeJumpThrus &&
-        (*it)->GetPlatformType() == PlatformRuntimeBehavior::Jumpthru)
+        platform->GetPlatformType() == PlatformRuntimeBehavior::Jumpthru)
       continue;
 
-    if (object->IsCollidingWith((*it)->GetObject(), ignoreTouchingEdges))
+    if (object->IsCollidingWith(platform->GetObject(), ignoreTouchingEdges))
       return true;
   }
 
@@ -567,82 +565,50 @@ bool PlatformerObjectRuntimeBehavior::IsCollidingWith(
 }
 
 bool PlatformerObjectRuntimeBehavior::IsCollidingWith(
-    const std::set<PlatformRuntimeBehavior*>& candidates,
-    const std::set<PlatformRuntimeBehavior*>& exceptTheseOnes) {
-  for (std::set<PlatformRuntimeBehavior*>::iterator it = candidates.begin();
-       it != candidates.end();
-       ++it) {
-    if (exceptTheseOnes.find(*it) != exceptTheseOnes.end()) continue;
-    if ((*it)->GetPlatformType() == PlatformRuntimeBehavior::Ladder) continue;
-
-    if (object->IsCollidingWith((*it)->GetObject(), ignoreTouchingEdges))
+    const std::vector<PlatformRuntimeBehavior*>& candidates,
+    const std::vector<PlatformRuntimeBehavior*>& exceptTheseOnes) {
+  for (PlatformRuntimeBehavior* platform : candidates) {
+    if (std::binary_search(
+            exceptTheseOnes.begin(), exceptTheseOnes.end(), platform))
+      continue;
+    if (platform->GetPlatformType() == PlatformRuntimeBehavior::Ladder)
+      continue;
+
+    if (object->IsCollidingWith(platform->GetObject(), ignoreTouchingEdges))
       return true;
   }
 
   return false;
 }
 
-std::set<PlatformRuntimeBehavior*>
-PlatformerObjectRuntimeBehavior::GetJumpthruCollidingWith(
-    const std::set<PlatformRuntimeBehavior*>& candidates) {
-  std::set<PlatformRuntimeBehavior*> result;
-  for (std::set<PlatformRuntimeBehavior*>::iterator it = candidates.begin();
-       it != candidates.end();
-       ++it) {
-    if ((*it)->GetPlatformType() != PlatformRuntimeBehavior::Jumpthru) continue;
-
-    if (object->IsCollidingWith((*it)->GetObject(), ignoreTouchingEdges))
-      result.insert(*it);
-  }
+void PlatformerObjectRuntimeBehavior::GetJumpthruCollidingWith(
+    const std::vector<PlatformRuntimeBehavior*>& candidates,
+    std::vector<PlatformRuntimeBehavior*>& result) {
+  result.clear();
+  for (PlatformRuntimeBehavior* platform : candidates) {
+    if (platform->GetPlatformType() != PlatformRuntimeBehavior::Jumpthru)
+      continue;
 
-  return result;
+    if (object->IsCollidingWith(platform->GetObject(), ignoreTouchingEdges))
+      result.push_back(platform);
+  }
 }
 
 bool PlatformerObjectRuntimeBehavior::IsOverlappingLadder(
-    const std::set<PlatformRuntimeBehavior*>& candidates) {
-  for (std::set<PlatformRuntimeBehavior*>::iterator it = candidates.begin();
-       it != candidates.end();
-       ++it) {
-    if ((*it)->GetPlatformType() != PlatformRuntimeBehavior::Ladder) continue;
-    if (object->IsCollidingWith((*it)->GetObject(), ignoreTouchingEdges))
+    const std::vector<PlatformRuntimeBehavior*>& candidates) {
+  for (PlatformRuntimeBehavior* platform : candidates) {
+    if (platform->GetPlatformType() != PlatformRuntimeBehavior::Ladder)
+      continue;
+    if (object->IsCollidingWith(platform->GetObject(), ignoreTouchingEdges))
       return true;
   }
 
   return false;
 }
 
-std::set<PlatformRuntimeBehavior*>
-PlatformerObjectRuntimeBehavior::GetPotentialCollidingObjects(
-    double maxMovementLength) {
-  // Compute the "bounding circle" radius of the object.
-  float o1w = object->GetWidth();
-  float o1h = object->GetHeight();
-  float obj1BoundingRadius =
-      sqrt(o1w * o1w + o1h * o1h) / 2.0 +
-      maxMovementLength / 2.0;  // Add to it the maximum magnitude of movement.
-
-  std::set<PlatformRuntimeBehavior*> potentialObjects;
-  for (std::set<PlatformRuntimeBehavior*>::iterator it =
-           sceneManager->GetAllPlatforms().begin();
-       it != sceneManager->GetAllPlatforms().end();
-       ++it) {
-    // First check if bounding circle are too far.
-    RuntimeObject* obj2 = (*it)->GetObject();
-    float o2w = obj2->GetWidth();
-    float o2h = obj2->GetHeight();
-
-    float x = object->GetDrawableX() + object->GetCenterX() -
-              (obj2->GetDrawableX() + obj2->GetCenterX());
-    float y = object->GetDrawableY() + object->GetCenterY() -
-              (obj2->GetDrawableY() + obj2->GetCenterY());
-    float obj2BoundingRadius = sqrt(o2w * o2w + o2h * o2h) / 2.0;
-
-    if (sqrt(x * x + y * y) <= obj1BoundingRadius + obj2BoundingRadius) {
-      potentialObjects.insert(*it);
-    }
-  }
-
-  return potentialObjects;
+void PlatformerObjectRuntimeBehavior::GetPotentialCollidingObjects(
+    double maxMovementLength, std::vector<PlatformRuntimeBehavior*>& result) {
+  sceneManager->GetPlatformsAround(*object, maxMovementLength, result);
 }
 
 void PlatformerObjectRuntimeBehavior::DoStepPostEvents(RuntimeScene& scene) {
@@ -9,7 +9,7 @@ This project is released under the MIT License.
 #define PLATFORMEROBJECTRUNTIMEBEHAVIOR_H
 #include <SFML/System/Vector2.hpp>
 #include <map>
-#include <set>
+#include <vector>
 #include "GDCpp/Runtime/RuntimeBehavior.h"
 #include "GDCpp/Runtime/RuntimeObject.h"
 namespace gd {
@@ -90,13 +90,13 @@ class GD_EXTENSION_API PlatformerObjectRuntimeBehavior
   virtual void DoStepPostEvents(RuntimeScene& scene);
 
   /**
-   * \brief Return a list of all the platforms that could be colliding with the
-   * object if it is moved. \param maxMovementLength The maximum length of any
-   * movement that could be done by the object, in pixels. \warning sceneManager
-   * must be valid and not NULL.
+   * \brief Fill \a result with all the platforms that could be colliding with
+   * the object if it is moved, sorted by address. \param maxMovementLength The
+   * maximum length of any movement that could be done by the object, in
+   * pixels. \warning sceneManager must be valid and not NULL.
    */
-  std::set<PlatformRuntimeBehavior*> GetPotentialCollidingObjects(
-      double maxMovementLength);
+  void GetPotentialCollidingObjects(
+      double maxMovementLength, std::vector<PlatformRuntimeBehavior*>& result);
 
   /**
    * \brief Separate the object from all platforms passed as parameter, except
@@ -104,18 +104,20 @@ class GD_EXTENSION_API PlatformerObjectRuntimeBehavior
    * excludeJumpThrus If set to true, the jump thru platform will be excluded.
    */
   bool SeparateFromPlatforms(
-      const std::set<PlatformRuntimeBehavior*>& candidates,
+      const std::vector<PlatformRuntimeBehavior*>& candidates,
       bool excludeJumpThrus);
 
   /**
-   * \brief Among the platforms passed in parameter, return a list of the
+   * \brief Among the platforms passed in parameter, fill \a result with the
    * platforms colliding with the object. \note Ladders are *always* excluded
-   * from the test. \param candidates The platform to be tested for collision
-   * \param exceptTheseOnes The platforms to be excluded from the test
+   * from the test. \param candidates The platform to be tested for collision,
+   * sorted by address \param exceptTheseOnes The platforms to be excluded from
+   * the test, sorted by address
    */
-  std::set<PlatformRuntimeBehavior*> GetPlatformsCollidingWith(
-      const std::set<PlatformRuntimeBehavior*>& candidates,
-      const std::set<PlatformRuntimeBehavior*>& exceptTheseOnes);
+  void GetPlatformsCollidingWith(
+      const std::vector<PlatformRuntimeBehavior*>& candidates,
+      const std::vector<PlatformRuntimeBehavior*>& exceptTheseOnes,
+      std::vector<PlatformRuntimeBehavior*>& result);
 
   /**
    * \brief Among the platforms passed in parameter, return true if there is a
@@ -125,19 +127,21 @@ class GD_EXTENSION_API PlatformerObjectRuntimeBehavior
    * collision. \param excludeJumpThrus If set to true, the jump thru platform
    * will be excluded.
    */
-  bool IsCollidingWith(const std::set<PlatformRuntimeBehavior*>& candidates,
-                       PlatformRuntimeBehavior* exceptThisOne = NULL,
-                       bool excludeJumpThrus = false);
+  bool IsCollidingWith(
+      const std::vector<PlatformRuntimeBehavior*>& candidates,
+      PlatformRuntimeBehavior* exceptThisOne = NULL,
+      bool excludeJumpThrus = false);
 
   /**
    * \brief Among the platforms passed in parameter, return true if there is a
    * platform colliding with the object. \note Ladders are *always* excluded
    * from the test. \param candidates The platforms to be tested for collision
-   * \param exceptTheseOnes The platforms to be excluded from the test
+   * \param exceptTheseOnes The platforms to be excluded from the test, sorted
+   * by address
    */
   bool IsCollidingWith(
-      const std::set<PlatformRuntimeBehavior*>& candidates,
-      const std::set<PlatformRuntimeBehavior*>& exceptTheseOnes);
+      const std::vector<PlatformRuntimeBehavior*>& candidates,
+      const std::vector<PlatformRuntimeBehavior*>& exceptTheseOnes);
 
   /**
    * \brief Among the platforms passed in parameter, return true if the object
@@ -145,15 +149,16 @@ class GD_EXTENSION_API PlatformerObjectRuntimeBehavior
    * collision
    */
   bool IsOverlappingLadder(
-      const std::set<PlatformRuntimeBehavior*>& candidates);
+      const std::vector<PlatformRuntimeBehavior*>& candidates);
 
   /**
-   * \brief Among the platforms passed in parameter, return a list of the jump
-   * thru platforms colliding with the object. \param candidates The platform to
-   * be tested for collision
+   * \brief Among the platforms passed in parameter, fill \a result with the
+   * jump thru platforms colliding with the object. \param candidates The
+   * platform to be tested for collision, sorted by address
    */
-  std::set<PlatformRuntimeBehavior*> GetJumpthruCollidingWith(
-      const std::set<PlatformRuntimeBehavior*>& candidates);
+  void GetJumpthruCollidingWith(
+      const std::vector<PlatformRuntimeBehavior*>& candidates,
+      std::vector<PlatformRuntimeBehavior*>& result);
 
   /**
    * \brief Return true if the object owning the behavior can grab the specified
@@ -243,5 +248,16 @@ class GD_EXTENSION_API PlatformerObjectRuntimeBehavior
   bool downKey;
   bool jumpKey;
   bool releaseKey;
+
+  // Lists reused at each step, to avoid allocations:
+  std::vector<PlatformRuntimeBehavior*>
+      potentialObjects;  ///< The platforms near the object.
+  std::vector<PlatformRuntimeBehavior*>
+      overlappedJumpThru;  ///< The jump thru platforms overlapped by the
+                           ///< object.
+  std::vector<PlatformRuntimeBehavior*>
+      collidingObjects;  ///< See GetPlatformsCollidingWith.
+  std::vector<RuntimeObject*>
+      separatedObjects;  ///< See SeparateFromPlatforms.
 };
 #endif  // PLATFORMEROBJECTRUNTIMEBEHAVIOR_H
@@ -1,9 +1,36 @@
 #include "ScenePlatformObjectsManager.h"
+#include <algorithm>
+#include <cmath>
+#include "GDCpp/Runtime/RuntimeObject.h"
 #include "PlatformRuntimeBehavior.h"
 
 std::map<RuntimeScene*, ScenePlatformObjectsManager>
     ScenePlatformObjectsManager::managers;
 
+const float ScenePlatformObjectsManager::cellSize = 128;
+const int ScenePlatformObjectsManager::maxCellsPerPlatform = 64;
+
+namespace {
+/**
+ * \brief Compute the square containing the bounding circle of an object.
+ */
+void GetBoundingCircleSquare(const RuntimeObject& object,
+                             float& minX,
+                             float& minY,
+                             float& maxX,
+                             float& maxY) {
+  float width = object.GetWidth();
+  float height = object.GetHeight();
+  float radius = sqrt(width * width + height * height) / 2.0;
+  float centerX = object.GetDrawableX() + object.GetCenterX();
+  float centerY = object.GetDrawableY() + object.GetCenterY();
+  minX = centerX - radius;
+  minY = centerY - radius;
+  maxX = centerX + radius;
+  maxY = centerY + radius;
+}
+}  // namespace
+
 ScenePlatformObjectsManager::~ScenePlatformObjectsManager() {
   for (std::set<PlatformRuntimeBehavior*>::iterator it = allPlatforms.begin();
        it != allPlatforms.end();) {
@@ -13,7 +40,150 @@ ScenePlatformObjectsManager::~ScenePlatformObjectsManager() {
 
 void ScenePlatformObjectsManager::AddPlatform(PlatformRuntimeBehavior* platform) {
   allPlatforms.insert(platform);
+  if (entries.find(platform) != entries.end()) return;
+
+  PlatformEntry& entry = entries[platform];
+  entry.platform = platform;
+  entry.lastQuery = 0;
+  InsertInCells(entry);
 }
+
 void ScenePlatformObjectsManager::RemovePlatform(PlatformRuntimeBehavior* platform) {
   allPlatforms.erase(platform);
+
+  auto it = entries.find(platform);
+  if (it == entries.end()) return;
+
+  RemoveFromCells(it->second);
+  entries.erase(it);
+}
+
+void ScenePlatformObjectsManager::UpdatePlatform(
+    PlatformRuntimeBehavior* platform) {
+  auto it = entries.find(platform);
+  if (it == entries.end()) return;
+
+  PlatformEntry& entry = it->second;
+  float minX, minY, maxX, maxY;
+  GetBoundingCircleSquare(*platform->GetObject(), minX, minY, maxX, maxY);
+  if (entry.minX == minX && entry.minY == minY && entry.maxX == maxX &&
+      entry.maxY == maxY)
+    return;
+
+  RemoveFromCells(entry);
+  InsertInCells(entry);
+}
+
+void ScenePlatformObjectsManager::InsertInCells(PlatformEntry& entry) {
+  GetBoundingCircleSquare(*entry.platform->GetObject(),
+                          entry.minX,
+                          entry.minY,
+                          entry.maxX,
+                          entry.maxY);
+
+  // Platforms that are too large (or with a position that is not finite)
+  // are tested by every query.
+  float cellsCountX = std::floor(entry.maxX / cellSize) -
+                      std::floor(entry.minX / cellSize) + 1;
+  float cellsCountY = std::floor(entry.maxY / cellSize) -
+                      std::floor(entry.minY / cellSize) + 1;
+  entry.large = !(cellsCountX * cellsCountY <= maxCellsPerPlatform);
+  if (entry.large) {
+    largePlatforms.push_back(&entry);
+    return;
+  }
+
+  entry.firstCellX = std::floor(entry.minX / cellSize);
+  entry.firstCellY = std::floor(entry.minY / cellSize);
+  entry.lastCellX = std::floor(entry.maxX / cellSize);
+  entry.lastCellY = std::floor(entry.maxY / cellSize);
+  for (int y = entry.firstCellY; y <= entry.lastCellY; ++y)
+    for (int x = entry.firstCellX; x <= entry.lastCellX; ++x)
+      cells[GetCellKey(x, y)].push_back(&entry);
+}
+
+void ScenePlatformObjectsManager::RemoveFromCells(PlatformEntry& entry) {
+  if (entry.large) {
+    largePlatforms.erase(
+        std::find(largePlatforms.begin(), largePlatforms.end(), &entry));
+    return;
+  }
+
+  for (int y = entry.firstCellY; y <= entry.lastCellY; ++y) {
+    for (int x = entry.firstCellX; x <= entry.lastCellX; ++x) {
+      auto it = cells.find(GetCellKey(x, y));
+      if (it == cells.end()) continue;
+
+      std::vector<PlatformEntry*>& cell = it->second;
+      auto entryIt = std::find(cell.begin(), cell.end(), &entry);
+      if (entryIt != cell.end()) {
+        *entryIt = cell.back();
+        cell.pop_back();
+      }
+      if (cell.empty()) cells.erase(it);
+    }
+  }
+}
+
+void ScenePlatformObjectsManager::GetPlatformsAround(
+    const RuntimeObject& object,
+    double maxMovementLength,
+    std::vector<PlatformRuntimeBehavior*>& result) {
+  result.clear();
+
+  // Compute the "bounding circle" radius of the object.
+  float o1w = object.GetWidth();
+  float o1h = object.GetHeight();
+  float obj1BoundingRadius =
+      sqrt(o1w * o1w + o1h * o1h) / 2.0 +
+      maxMovementLength / 2.0;  // Add to it the maximum magnitude of movement.
+  float obj1CenterX = object.GetDrawableX() + object.GetCenterX();
+  float obj1CenterY = object.GetDrawableY() + object.GetCenterY();
+
+  currentQuery++;
+  auto testPlatform = [&](PlatformEntry* entry) {
+    if (entry->lastQuery == currentQuery) return;
+    entry->lastQuery = currentQuery;
+
+    // Check if bounding circles are too far.
+    RuntimeObject* obj2 = entry->platform->GetObject();
+    float o2w = obj2->GetWidth();
+    float o2h = obj2->GetHeight();
+
+    float x = obj1CenterX - (obj2->GetDrawableX() + obj2->GetCenterX());
+    float y = obj1CenterY - (obj2->GetDrawableY() + obj2->GetCenterY());
+    float obj2BoundingRadius = sqrt(o2w * o2w + o2h * o2h) / 2.0;
+
+    if (sqrt(x * x + y * y) <= obj1BoundingRadius + obj2BoundingRadius)
+      result.push_back(entry->platform);
+  };
+
+  for (PlatformEntry* entry : largePlatforms) testPlatform(entry);
+
+  // The searched area is enlarged a bit to be sure to find the platforms
+  // which are just touching the object, despite rounding errors.
+  float firstCellX =
+      std::floor((obj1CenterX - obj1BoundingRadius - 1) / cellSize);
+  float firstCellY =
+      std::floor((obj1CenterY - obj1BoundingRadius - 1) / cellSize);
+  float lastCellX =
+      std::floor((obj1CenterX + obj1BoundingRadius + 1) / cellSize);
+  float lastCellY =
+      std::floor((obj1CenterY + obj1BoundingRadius + 1) / cellSize);
+  if (!((lastCellX - firstCellX + 1) * (lastCellY - firstCellY + 1) <=
+        cells.size())) {
+    // Checking all the platforms is faster than looking in all the cells.
+    for (auto& it : entries) testPlatform(&it.second);
+  } else {
+    for (int y = firstCellY; y <= lastCellY; ++y) {
+      for (int x = firstCellX; x <= lastCellX; ++x) {
+        auto it = cells.find(GetCellKey(x, y));
+        if (it == cells.end()) continue;
+
+        for (PlatformEntry* entry : it->second) testPlatform(entry);
+      }
+    }
+  }
+
+  std::sort(result.begin(), result.end());
 }
@@ -6,18 +6,23 @@ This project is released under the MIT License.
 */
 #ifndef SCENEPLATFORMOBJECTSMANAGER_H
 #define SCENEPLATFORMOBJECTSMANAGER_H
+#include <cstdint>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <vector>
 #include "GDCpp/Runtime/RuntimeScene.h"
 class PlatformRuntimeBehavior;
+class RuntimeObject;
 
 /**
  * \brief Contains lists of all platform related objects of a scene.
  *
- * \note Could be drastically improved by using spatial hashing (see JS
- * implementation).
+ * Platforms are stored in a spatial hash, according to their bounding circle,
+ * so that the platforms near an object can be found without iterating on all
+ * the platforms.
  */
-class ScenePlatformObjectsManager {
+class GD_EXTENSION_API ScenePlatformObjectsManager {
  public:
   /**
    * \brief Map containing, for each RuntimeScene, its associated
@@ -25,7 +30,7 @@ class ScenePlatformObjectsManager {
    */
   static std::map<RuntimeScene*, ScenePlatformObjectsManager> managers;
 
-  ScenePlatformObjectsManager(){};
+  ScenePlatformObjectsManager() : currentQuery(0){};
   virtual ~ScenePlatformObjectsManager();
 
   /**
@@ -40,6 +45,12 @@ class ScenePlatformObjectsManager {
    */
   void RemovePlatform(PlatformRuntimeBehavior* platform);
 
+  /**
+   * \brief Notify the manager that a platform may have been moved or resized,
+   * to update its position in the spatial hash.
+   */
+  void UpdatePlatform(PlatformRuntimeBehavior* platform);
+
   /**
    * \brief Get a read only access to the list of all platforms
    */
@@ -47,9 +58,50 @@ class ScenePlatformObjectsManager {
     return allPlatforms;
   }
 
+  /**
+   * \brief Fill \a result with the platforms whose bounding circle is
+   * intersecting the bounding circle of the object, enlarged by the maximum
+   * movement of the object.
+   *
+   * The platforms are sorted by address, as in GetAllPlatforms.
+   */
+  void GetPlatformsAround(const RuntimeObject& object,
+                          double maxMovementLength,
+                          std::vector<PlatformRuntimeBehavior*>& result);
+
  private:
+  /**
+   * \brief The bounds of the bounding circle of a platform, as stored in the
+   * spatial hash.
+   */
+  struct PlatformEntry {
+    PlatformRuntimeBehavior* platform;
+    float minX, minY, maxX, maxY;
+    int firstCellX, firstCellY, lastCellX, lastCellY;
+    bool large;  ///< True if the platform is stored in largePlatforms instead
+                 ///< of the cells.
+    std::size_t lastQuery;  ///< Used to return a platform only once by query.
+  };
+
+  void InsertInCells(PlatformEntry& entry);
+  void RemoveFromCells(PlatformEntry& entry);
+
+  static std::uint64_t GetCellKey(int cellX, int cellY) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cellX))
+            << 32) |
+           static_cast<std::uint32_t>(cellY);
+  }
+
   std::set<PlatformRuntimeBehavior*>
       allPlatforms;  ///< The list of all platforms of the scene.
+  std::unordered_map<PlatformRuntimeBehavior*, PlatformEntry> entries;
+  std::unordered_map<std::uint64_t, std::vector<PlatformEntry*>> cells;
+  std::vector<PlatformEntry*> largePlatforms;  ///< Platforms covering too many
+                                               ///< cells to be stored in them.
+  std::size_t currentQuery;
+
+  static const float cellSize;
+  static const int maxCellsPerPlatform;
 };
 
 #endif
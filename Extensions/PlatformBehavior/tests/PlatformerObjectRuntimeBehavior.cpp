@@ -0,0 +1,242 @@
+/**
+
+GDevelop - Platform Behavior Extension
+Copyright (c) 2013-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+/**
+ * @file Tests for the Platform extension.
+ */
+#define CATCH_CONFIG_MAIN
+#include <cmath>
+#include "../PlatformBehavior.h"
+#include "../PlatformRuntimeBehavior.h"
+#include "../PlatformerObjectBehavior.h"
+#include "../PlatformerObjectRuntimeBehavior.h"
+#include "../ScenePlatformObjectsManager.h"
+#include "GDCore/CommonTools.h"
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+// Mock objects that can have a specific size
+class ResizableRuntimeObject : public RuntimeObject {
+ public:
+  ResizableRuntimeObject(RuntimeScene &scene, const gd::Object &obj)
+      : RuntimeObject(scene, obj), width(0), height(0) {}
+
+  float GetWidth() const override { return width; }
+  float GetHeight() const override { return height; }
+  void SetWidth(float newWidth) override { width = newWidth; }
+  void SetHeight(float newHeight) override { height = newHeight; }
+
+ private:
+  float width;
+  float height;
+};
+
+namespace {
+template <class TRuntimeBehavior, class TBehavior>
+std::unique_ptr<TRuntimeBehavior> CreateNewRuntimeBehavior() {
+  gd::SerializerElement behaviorContent;
+  TBehavior behavior;
+  behavior.InitializeContent(behaviorContent);
+  return std::move(gd::make_unique<TRuntimeBehavior>(behaviorContent));
+};
+
+std::unique_ptr<ResizableRuntimeObject> CreatePlatform(
+    RuntimeScene &scene,
+    const gd::Object &platformObject,
+    float x,
+    float y,
+    float width,
+    float height) {
+  std::unique_ptr<ResizableRuntimeObject> platform(
+      new ResizableRuntimeObject(scene, platformObject));
+  platform->SetWidth(width);
+  platform->SetHeight(height);
+  platform->SetX(x);
+  platform->SetY(y);
+  platform->AddBehavior(
+      "Platform",
+      CreateNewRuntimeBehavior<PlatformRuntimeBehavior, PlatformBehavior>());
+
+  // Register the platform in the manager of the scene.
+  platform->GetBehaviorRawPointer("Platform")->StepPreEvents(scene);
+  return platform;
+}
+
+/**
+ * Find the platforms near an object by testing all the platforms, as done
+ * before the platforms were stored in a spatial hash.
+ *
+ * \note ::sqrt is used to compute with doubles, like the extension does.
+ */
+std::vector<PlatformRuntimeBehavior *> GetPlatformsAroundWithoutSpatialHash(
+    ScenePlatformObjectsManager &manager,
+    const RuntimeObject &object,
+    double maxMovementLength) {
+  std::vector<PlatformRuntimeBehavior *> result;
+
+  float o1w = object.GetWidth();
+  float o1h = object.GetHeight();
+  float obj1BoundingRadius =
+      ::sqrt(o1w * o1w + o1h * o1h) / 2.0 + maxMovementLength / 2.0;
+  for (PlatformRuntimeBehavior *platform : manager.GetAllPlatforms()) {
+    RuntimeObject *obj2 = platform->GetObject();
+    float o2w = obj2->GetWidth();
+    float o2h = obj2->GetHeight();
+
+    float x = object.GetDrawableX() + object.GetCenterX() -
+              (obj2->GetDrawableX() + obj2->GetCenterX());
+    float y = object.GetDrawableY() + object.GetCenterY() -
+              (obj2->GetDrawableY() + obj2->GetCenterY());
+    float obj2BoundingRadius = ::sqrt(o2w * o2w + o2h * o2h) / 2.0;
+
+    if (::sqrt(x * x + y * y) <= obj1BoundingRadius + obj2BoundingRadius)
+      result.push_back(platform);
+  }
+
+  return result;
+}
+}  // namespace
+
+TEST_CASE("ScenePlatformObjectsManager", "[game-engine][platformer]") {
+  RuntimeGame game;
+  RuntimeScene scene(NULL, &game);
+  gd::Object platformObject("platform");
+  gd::Object playerObject("player");
+  ScenePlatformObjectsManager &manager =
+      ScenePlatformObjectsManager::managers[&scene];
+
+  // Platforms of various sizes, including one too large to be stored in
+  // the cells of the spatial hash.
+  std::vector<std::unique_ptr<ResizableRuntimeObject>> platforms;
+  for (int i = 0; i < 20; ++i) {
+    for (int j = 0; j < 10; ++j) {
+      platforms.push_back(CreatePlatform(scene,
+                                         platformObject,
+                                         i * 70 - 300,
+                                         j * 90 - 200,
+                                         20 + (i * 7 + j * 13) % 150,
+                                         20 + (i * 11 + j * 3) % 90));
+    }
+  }
+  platforms.push_back(
+      CreatePlatform(scene, platformObject, -2000, 300, 4000, 40));
+  REQUIRE(manager.GetAllPlatforms().size() == 201);
+
+  ResizableRuntimeObject player(scene, playerObject);
+  player.SetWidth(32);
+  player.SetHeight(64);
+
+  auto checkPlatformsAround = [&]() {
+    std::vector<PlatformRuntimeBehavior *> result;
+    std::size_t foundPlatformsCount = 0;
+    for (float x = -500; x < 1500; x += 37) {
+      for (float y = -400; y < 800; y += 43) {
+        player.SetX(x);
+        player.SetY(y);
+        for (double maxMovementLength : {0.0, 20.0, 300.0}) {
+          manager.GetPlatformsAround(player, maxMovementLength, result);
+          REQUIRE(result == GetPlatformsAroundWithoutSpatialHash(
+                                manager, player, maxMovementLength));
+          foundPlatformsCount += result.size();
+        }
+      }
+    }
+
+    return foundPlatformsCount;
+  };
+
+  SECTION("Platforms around an object are found") {
+    REQUIRE(checkPlatformsAround() > 0);
+  }
+
+  SECTION("Platforms can be moved, resized and removed") {
+    for (std::size_t i = 0; i < platforms.size(); i += 3) {
+      platforms[i]->SetX(platforms[i]->GetX() + 250);
+      platforms[i]->SetY(platforms[i]->GetY() - 130);
+      platforms[i]->GetBehaviorRawPointer("Platform")->StepPostEvents(scene);
+    }
+    for (std::size_t i = 1; i < platforms.size(); i += 5) {
+      platforms[i]->SetWidth(platforms[i]->GetWidth() * 3);
+      platforms[i]->GetBehaviorRawPointer("Platform")->StepPreEvents(scene);
+    }
+    platforms.erase(platforms.begin() + 50, platforms.begin() + 80);
+    REQUIRE(manager.GetAllPlatforms().size() == 171);
+    REQUIRE(checkPlatformsAround() > 0);
+
+    // Deactivated platforms are removed from the manager.
+    platforms[0]->GetBehaviorRawPointer("Platform")->Activate(false);
+    REQUIRE(manager.GetAllPlatforms().size() == 170);
+    REQUIRE(checkPlatformsAround() > 0);
+  }
+
+  platforms.clear();
+  ScenePlatformObjectsManager::managers.erase(&scene);
+}
+
+TEST_CASE("PlatformerObjectRuntimeBehavior", "[game-engine][platformer]") {
+  RuntimeGame game;
+  RuntimeScene scene(NULL, &game);
+  gd::Object platformObject("platform");
+  gd::Object playerObject("player");
+
+  std::unique_ptr<ResizableRuntimeObject> platform =
+      CreatePlatform(scene, platformObject, 0, -10, 60, 32);
+
+  ResizableRuntimeObject player(scene, playerObject);
+  player.SetWidth(10);
+  player.SetHeight(20);
+  player.SetX(0);
+  player.SetY(-100);
+  player.AddBehavior("auto1",
+                     CreateNewRuntimeBehavior<PlatformerObjectRuntimeBehavior,
+                                              PlatformerObjectBehavior>());
+  PlatformerObjectRuntimeBehavior *behavior =
+      static_cast<PlatformerObjectRuntimeBehavior *>(
+          player.GetBehaviorRawPointer("auto1"));
+  behavior->IgnoreDefaultControls(true);
+
+  auto step = [&]() {
+    scene.GetTimeManager().Update(1000000 / 60, 0);
+    platform->GetBehaviorRawPointer("Platform")->StepPreEvents(scene);
+    behavior->StepPreEvents(scene);
+    platform->GetBehaviorRawPointer("Platform")->StepPostEvents(scene);
+    behavior->StepPostEvents(scene);
+  };
+
+  SECTION("Falls and lands on a platform") {
+    for (int i = 0; i < 10; ++i) {
+      step();
+      REQUIRE(behavior->IsFalling() == true);
+      REQUIRE(behavior->IsOnFloor() == false);
+    }
+    for (int i = 0; i < 50; ++i) step();
+
+    REQUIRE(behavior->IsFalling() == false);
+    REQUIRE(behavior->IsOnFloor() == true);
+    REQUIRE(player.GetY() == -30);
+  }
+
+  SECTION("Follows a moving platform") {
+    for (int i = 0; i < 60; ++i) step();
+    REQUIRE(behavior->IsOnFloor() == true);
+
+    // Move the platform far from its previous cells.
+    for (int i = 0; i < 10; ++i) {
+      platform->SetX(platform->GetX() + 50);
+      platform->SetY(platform->GetY() + 30);
+      step();
+    }
+    REQUIRE(behavior->IsOnFloor() == true);
+    REQUIRE(player.GetX() == 500);
+    REQUIRE(player.GetY() == 270);
+  }
+
+  platform.reset();
+  ScenePlatformObjectsManager::managers.erase(&scene);
+}
@@ -0,0 +1,148 @@
+/**
+
+GDevelop - Platform Behavior Extension
+Copyright (c) 2013-2016 Florian Rival (Florian.Rival@gmail.com)
+This project is released under the MIT License.
+*/
+/**
+ * @file Benchmarks of the platformer objects, similar to
+ * benchmarks/platformerobjectruntimebehavior.benchmark.js.
+ */
+#include <chrono>
+#include <functional>
+#include <numeric>
+#include "../PlatformBehavior.h"
+#include "../PlatformRuntimeBehavior.h"
+#include "../PlatformerObjectBehavior.h"
+#include "../PlatformerObjectRuntimeBehavior.h"
+#include "../ScenePlatformObjectsManager.h"
+#include "GDCore/CommonTools.h"
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+namespace {
+class BenchmarkRuntimeObject : public RuntimeObject {
+ public:
+  BenchmarkRuntimeObject(RuntimeScene &scene,
+                         const gd::Object &obj,
+                         float width_,
+                         float height_)
+      : RuntimeObject(scene, obj), width(width_), height(height_) {}
+
+  float GetWidth() const override { return width; }
+  float GetHeight() const override { return height; }
+
+ private:
+  float width;
+  float height;
+};
+
+template <class TRuntimeBehavior, class TBehavior>
+std::unique_ptr<TRuntimeBehavior> CreateNewRuntimeBehavior() {
+  gd::SerializerElement behaviorContent;
+  TBehavior behavior;
+  behavior.InitializeContent(behaviorContent);
+  return std::move(gd::make_unique<TRuntimeBehavior>(behaviorContent));
+};
+}  // namespace
+
+TEST_CASE("PlatformBehavior - Benchmarks", "[game-engine][benchmarks]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  const int duplicateCount = 60;
+  const int stepCount = 600;
+
+  RuntimeGame game;
+  RuntimeScene scene(NULL, &game);
+  gd::Object playerObject("player");
+  gd::Object platformObject("platform");
+
+  std::vector<std::unique_ptr<BenchmarkRuntimeObject>> platforms;
+  auto addPlatform = [&](float x, float y) {
+    platforms.push_back(gd::make_unique<BenchmarkRuntimeObject>(
+        scene, platformObject, 60, 32));
+    platforms.back()->SetX(x);
+    platforms.back()->SetY(y);
+    platforms.back()->AddBehavior(
+        "Platform",
+        CreateNewRuntimeBehavior<PlatformRuntimeBehavior, PlatformBehavior>());
+  };
+
+  // Put platformer objects on platforms.
+  std::vector<std::unique_ptr<BenchmarkRuntimeObject>> objects;
+  std::vector<PlatformerObjectRuntimeBehavior *> behaviors;
+  for (int i = 0; i < duplicateCount; ++i) {
+    objects.push_back(
+        gd::make_unique<BenchmarkRuntimeObject>(scene, playerObject, 10, 20));
+    objects.back()->SetX(100 * i + 60 * 5);
+    objects.back()->SetY(400 * i - 32);
+    objects.back()->AddBehavior(
+        "auto1",
+        CreateNewRuntimeBehavior<PlatformerObjectRuntimeBehavior,
+                                 PlatformerObjectBehavior>());
+    behaviors.push_back(static_cast<PlatformerObjectRuntimeBehavior *>(
+        objects.back()->GetBehaviorRawPointer("auto1")));
+    behaviors.back()->IgnoreDefaultControls(true);
+
+    for (int p = 0; p < 10; ++p)
+      addPlatform(100 * i + p * 60, 400 * i - 10);
+  }
+
+  auto jumpInLoop = [&]() {
+    for (int t = 0; t < stepCount; ++t) {
+      for (int i = 0; i < duplicateCount; ++i) {
+        if (t % 60 == i % 60) behaviors[i]->SimulateJumpKey();
+        if (t + (i % 61) < 31) behaviors[i]->SimulateRightKey();
+        if (t + (i % 61) >= 31) behaviors[i]->SimulateLeftKey();
+      }
+
+      scene.GetTimeManager().Update(1000000 / 60, 0);
+      for (auto &platform : platforms)
+        platform->GetBehaviorRawPointer("Platform")->StepPreEvents(scene);
+      for (auto behavior : behaviors) behavior->StepPreEvents(scene);
+      for (auto &platform : platforms)
+        platform->GetBehaviorRawPointer("Platform")->StepPostEvents(scene);
+      for (auto behavior : behaviors) behavior->StepPostEvents(scene);
+    }
+  };
+
+  SECTION("Jump in loop") {
+    doBenchmark("Jump in loop (600 platforms)", 3, jumpInLoop);
+  }
+
+  SECTION("Jump in loop, in a level made of tiles") {
+    // Add a level made of small platforms, far from the objects.
+    for (int x = 0; x < 100; ++x)
+      for (int y = 0; y < 50; ++y) addPlatform(x * 64, 30000 + y * 64);
+
+    doBenchmark("Jump in loop (5600 platforms)", 3, jumpInLoop);
+  }
+
+  objects.clear();
+  platforms.clear();
+  ScenePlatformObjectsManager::managers.erase(&scene);
+}
@@ -141,6 +141,9 @@ class GD_EXTENSION_API RuntimeShapePainterObject
   }
 
   virtual bool Draw(sf::RenderTarget& renderTarget);
+  virtual bool IsDrawnInsideAABB() const {
+    return false;
+  };  ///< Shapes can be drawn anywhere.
 
   virtual float GetWidth() const { return 32; };
   virtual float GetHeight() const { return 32; };
@@ -141,20 +141,25 @@ gd::String EventsCodeGenerator::GenerateObjectCondition(
   if (conditionInverted) predicat = GenerateNegatedPredicat(predicat);
 
   // Generate whole condition code
-  conditionCode +=
-      "for(std::size_t i = 0;i < " + ManObjListName(objectName) + ".size();)\n";
+  // Picked objects are moved to the beginning of the list, keeping their
+  // order, and the list is then shrunk (rather than erasing each object not
+  // picked, which would be quadratic).
+  conditionCode += "{\n";
+  conditionCode += "std::size_t pickedCount = 0;\n";
+  conditionCode += "for(std::size_t i = 0;i < " + ManObjListName(objectName) +
+                   ".size();++i)\n";
   conditionCode += "{\n";
   conditionCode += "    if ( " + predicat + " )\n";
   conditionCode += "    {\n";
   conditionCode += "        " + returnBoolean + " = true;\n";
-  conditionCode += "        ++i;\n";
-  conditionCode += "    }\n";
-  conditionCode += "    else\n";
-  conditionCode += "    {\n";
-  conditionCode += "        " + ManObjListName(objectName) + ".erase(" +
-                   ManObjListName(objectName) + ".begin()+i);\n";
+  conditionCode += "        " + ManObjListName(objectName) +
+                   "[pickedCount++] = " + ManObjListName(objectName) +
+                   "[i];\n";
   conditionCode += "    }\n";
   conditionCode += "}\n";
+  conditionCode +=
+      ManObjListName(objectName) + ".resize(pickedCount);\n";
+  conditionCode += "}\n";
 
   return conditionCode;
 }
@@ -171,15 +176,17 @@ gd::String EventsCodeGenerator::GenerateBehaviorCondition(
   gd::String conditionCode;
 
   // Prepare call
+  // The behavior is accessed using its slot, found once for all the objects
+  // (see RuntimeObject::GetBehaviorSlot).
   // Add a static_cast if necessary
   gd::String objectFunctionCallNamePart =
       (!instrInfos.parameters[1].supplementaryInformation.empty())
           ? "static_cast<" + autoInfo.className + "*>(" +
-                ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(" +
-                GenerateGetBehaviorNameCode(behaviorName) + "))->" +
+                ManObjListName(objectName) +
+                "[i]->GetBehaviorRawPointerAtSlot(behaviorSlot))->" +
                 instrInfos.codeExtraInformation.functionCallName
-          : ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(" +
-                GenerateGetBehaviorNameCode(behaviorName) + ")->" +
+          : ManObjListName(objectName) +
+                "[i]->GetBehaviorRawPointerAtSlot(behaviorSlot)->" +
                 instrInfos.codeExtraInformation.functionCallName;
 
   // Create call
@@ -203,19 +210,25 @@ gd::String EventsCodeGenerator::GenerateBehaviorCondition(
          << "\" requested for object \'" << objectName
          << "\" (condition: " << instrInfos.GetFullName() << ")." << endl;
   } else {
+    conditionCode += "{\n";
+    conditionCode += "std::size_t behaviorSlot = " +
+                     ManObjListName(objectName) + ".empty() ? 0 : " +
+                     ManObjListName(objectName) + "[0]->GetBehaviorSlot(" +
+                     GenerateGetBehaviorNameCode(behaviorName) + ");\n";
+    conditionCode += "std::size_t pickedCount = 0;\n";
     conditionCode += "for(std::size_t i = 0;i < " + ManObjListName(objectName) +
-                     ".size();)\n";
+                     ".size();++i)\n";
     conditionCode += "{\n";
     conditionCode += "    if ( " + predicat + " )\n";
     conditionCode += "    {\n";
     conditionCode += "        " + returnBoolean + " = true;\n";
-    conditionCode += "        ++i;\n";
-    conditionCode += "    }\n";
-    conditionCode += "    else\n";
-    conditionCode += "    {\n";
-    conditionCode += "        " + ManObjListName(objectName) + ".erase(" +
-                     ManObjListName(objectName) + ".begin()+i);\n";
+    conditionCode += "        " + ManObjListName(objectName) +
+                     "[pickedCount++] = " + ManObjListName(objectName) +
+                     "[i];\n";
     conditionCode += "    }\n";
+    conditionCode += "}\n";
+    conditionCode +=
+        ManObjListName(objectName) + ".resize(pickedCount);\n";
     conditionCode += "}";
   }
 
@@ -288,14 +301,16 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(
   gd::String actionCode;
 
   // Prepare call
+  // The behavior is accessed using its slot, found once for all the objects
+  // (see RuntimeObject::GetBehaviorSlot).
   // Add a static_cast if necessary
   gd::String objectPart =
       (!instrInfos.parameters[1].supplementaryInformation.empty())
           ? "static_cast<" + autoInfo.className + "*>(" +
-                ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(" +
-                GenerateGetBehaviorNameCode(behaviorName) + "))->"
-          : ManObjListName(objectName) + "[i]->GetBehaviorRawPointer(" +
-                GenerateGetBehaviorNameCode(behaviorName) + ")->";
+                ManObjListName(objectName) +
+                "[i]->GetBehaviorRawPointerAtSlot(behaviorSlot))->"
+          : ManObjListName(objectName) +
+                "[i]->GetBehaviorRawPointerAtSlot(behaviorSlot)->";
 
   // Create call
   gd::String call;
@@ -337,11 +352,17 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(
          << "\" requested for object \'" << objectName
          << "\" (action: " << instrInfos.GetFullName() << ")." << endl;
   } else {
+    actionCode += "{\n";
+    actionCode += "std::size_t behaviorSlot = " + ManObjListName(objectName) +
+                  ".empty() ? 0 : " + ManObjListName(objectName) +
+                  "[0]->GetBehaviorSlot(" +
+                  GenerateGetBehaviorNameCode(behaviorName) + ");\n";
     actionCode += "for(std::size_t i = 0;i < " + ManObjListName(objectName) +
                   ".size();++i)\n";
     actionCode += "{\n";
     actionCode += "    " + call + ";\n";
     actionCode += "}\n";
+    actionCode += "}\n";
   }
 
   return actionCode;
@@ -391,7 +412,8 @@ gd::String EventsCodeGenerator::GenerateObject(
     std::vector<gd::String> realObjects =
         ExpandObjectsName(objectName, context);
 
-    output += "runtimeContext->ClearObjectListsMap()";
+    output += "runtimeContext->ClearObjectListsMap(" +
+              gd::String::From(objectListsMapsCount++) + ")";
     for (std::size_t i = 0; i < realObjects.size(); ++i) {
       context.ObjectsListNeeded(realObjects[i]);
       output += ".AddObjectListToMap(\"" + ConvertToString(realObjects[i]) +
@@ -402,7 +424,8 @@ gd::String EventsCodeGenerator::GenerateObject(
     std::vector<gd::String> realObjects =
         ExpandObjectsName(objectName, context);
 
-    output += "runtimeContext->ClearObjectListsMap()";
+    output += "runtimeContext->ClearObjectListsMap(" +
+              gd::String::From(objectListsMapsCount++) + ")";
     for (std::size_t i = 0; i < realObjects.size(); ++i) {
       context.ObjectsListWithoutPickingNeeded(realObjects[i]);
       output += ".AddObjectListToMap(\"" + ConvertToString(realObjects[i]) +
@@ -618,7 +641,8 @@ gd::String EventsCodeGenerator::GenerateExternalEventsCompleteCode(
 
 EventsCodeGenerator::EventsCodeGenerator(gd::Project& project,
                                          const gd::Layout& layout)
-    : gd::EventsCodeGenerator(project, layout, CppPlatform::Get()) {}
+    : gd::EventsCodeGenerator(project, layout, CppPlatform::Get()),
+      objectListsMapsCount(0) {}
 
 EventsCodeGenerator::~EventsCodeGenerator() {}
 
@@ -161,6 +161,11 @@ class GD_API EventsCodeGenerator : public gd::EventsCodeGenerator {
    */
   EventsCodeGenerator(gd::Project& project, const gd::Layout& layout);
   virtual ~EventsCodeGenerator();
+
+ private:
+  std::size_t objectListsMapsCount;  ///< The number of maps of objects lists
+                                     ///< used by the generated code (see
+                                     ///< RuntimeContext::ClearObjectListsMap).
 };
 
 #endif  // EventsCodeGenerator_H
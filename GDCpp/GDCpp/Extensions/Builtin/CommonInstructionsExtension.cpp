@@ -218,8 +218,15 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
              gd::EventsCodeGenerationContext& parentContext) {
             size_t uniqueId = codeGenerator.GenerateSingleUsageUniqueIdFor(
                 instruction.GetOriginalInstruction().lock().get());
-            return "conditionTrue = runtimeContext->TriggerOnce(" +
-                   gd::String::From(uniqueId) + ");\n";
+
+            // Unique ids are not contiguous: get a slot for the condition
+            // once, so that its state is stored in an array.
+            return "{\nstatic const std::size_t triggerOnceSlot = "
+                   "RuntimeContext::GetTriggerOnceSlot(" +
+                   gd::String::From(uniqueId) +
+                   ");\n"
+                   "conditionTrue = runtimeContext->TriggerOnce("
+                   "triggerOnceSlot);\n}\n";
           });
 
   GetAllEvents()["BuiltinCommonInstructions::Standard"].SetCodeGenerator(
@@ -14,10 +14,25 @@
 
 using namespace std;
 
+namespace {
+/**
+ * Return the bounds of a circle centered on the object center, enlarged
+ * by a pixel so that rounding errors can't exclude objects that are
+ * touching.
+ */
+sf::FloatRect GetCenteredBounds(RuntimeObject *obj, float radius) {
+  radius += 1;
+  return sf::FloatRect(obj->GetDrawableX() + obj->GetCenterX() - radius,
+                       obj->GetDrawableY() + obj->GetCenterY() - radius,
+                       2 * radius,
+                       2 * radius);
+}
+}  // namespace
+
 double GD_API PickedObjectsCount(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists) {
+    const RuntimeObjectsLists &objectsLists) {
   std::size_t size = 0;
-  std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
+  RuntimeObjectsLists::const_iterator it =
       objectsLists.begin();
   for (; it != objectsLists.end(); ++it) {
     if (it->second == NULL) continue;
@@ -29,8 +44,8 @@ double GD_API PickedObjectsCount(
 }
 
 bool GD_API HitBoxesCollision(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    const RuntimeObjectsLists &objectsLists1,
+    const RuntimeObjectsLists &objectsLists2,
     bool conditionInverted,
     RuntimeScene & /*scene*/,
     bool ignoreTouchingEdges) {
@@ -38,14 +53,22 @@ bool GD_API HitBoxesCollision(
       objectsLists1,
       objectsLists2,
       conditionInverted,
+      [](RuntimeObject *obj) {
+        // Objects can't be colliding if their bounding circles are not
+        // (see RuntimeObject::IsCollidingWith).
+        float width = obj->GetWidth();
+        float height = obj->GetHeight();
+        return GetCenteredBounds(obj,
+                                 sqrt(width * width + height * height) / 2.0);
+      },
       [ignoreTouchingEdges](RuntimeObject *obj1, RuntimeObject *obj2) {
         return obj1->IsCollidingWith(obj2, ignoreTouchingEdges);
       });
 }
 
 bool GD_API ObjectsTurnedToward(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    const RuntimeObjectsLists &objectsLists1,
+    const RuntimeObjectsLists &objectsLists2,
     float tolerance,
     bool conditionInverted) {
   return TwoObjectListsTest(
@@ -66,15 +89,17 @@ bool GD_API ObjectsTurnedToward(
 }
 
 float GD_API DistanceBetweenObjects(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    const RuntimeObjectsLists &objectsLists1,
+    const RuntimeObjectsLists &objectsLists2,
     float length,
     bool conditionInverted) {
+  float radius = length / 2;
   length *= length;
   return TwoObjectListsTest(
       objectsLists1,
       objectsLists2,
       conditionInverted,
+      [radius](RuntimeObject *obj) { return GetCenteredBounds(obj, radius); },
       [length](RuntimeObject *obj1, RuntimeObject *obj2) {
         float X = obj1->GetDrawableX() + obj1->GetCenterX() -
                   (obj2->GetDrawableX() + obj2->GetCenterX());
@@ -86,8 +111,8 @@ float GD_API DistanceBetweenObjects(
 }
 
 bool GD_API
-MovesToward(std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-            std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+MovesToward(const RuntimeObjectsLists &objectsLists1,
+            const RuntimeObjectsLists &objectsLists2,
             float tolerance,
             bool conditionInverted) {
   return TwoObjectListsTest(
@@ -110,7 +135,7 @@ MovesToward(std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
 }
 
 bool GD_API CursorOnObject(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists,
+    const RuntimeObjectsLists &objectsLists,
     RuntimeScene &scene,
     bool precise,
     bool conditionInverted) {
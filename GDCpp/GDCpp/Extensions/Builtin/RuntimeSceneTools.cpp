@@ -96,7 +96,7 @@ namespace {
 void DoCreateObjectOnScene(
     RuntimeScene &scene,
     gd::String objectName,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     float positionX,
     float positionY,
     const gd::String &layer) {
@@ -130,15 +130,18 @@ void DoCreateObjectOnScene(
   newObject->SetLayer(layer);
 
   // Add object to scene and let it be concerned by futures actions
-  pickedObjectLists[objectName]->push_back(
-      scene.objectsInstances.AddObject(std::move(newObject)));
+  RuntimeObject *addedObject =
+      scene.objectsInstances.AddObject(std::move(newObject));
+  auto list = pickedObjectLists.find(objectName);
+  if (list != pickedObjectLists.end() && list->second != nullptr)
+    list->second->push_back(addedObject);
 }
 
 }  // namespace
 
 void GD_API CreateObjectOnScene(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     float positionX,
     float positionY,
     const gd::String &layer) {
@@ -154,12 +157,13 @@ void GD_API CreateObjectOnScene(
 
 void GD_API CreateObjectFromGroupOnScene(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     const gd::String &objectWanted,
     float positionX,
     float positionY,
     const gd::String &layer) {
-  if (pickedObjectLists[objectWanted] == nullptr)
+  auto list = pickedObjectLists.find(objectWanted);
+  if (list == pickedObjectLists.end() || list->second == nullptr)
     return;  // Bail out if the object is not present in the specified group
 
   ::DoCreateObjectOnScene(
@@ -168,7 +172,7 @@ void GD_API CreateObjectFromGroupOnScene(
 
 bool GD_API PickAllObjects(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    const RuntimeObjectsLists &pickedObjectLists) {
   for (auto it = pickedObjectLists.begin(); it != pickedObjectLists.end();
        ++it) {
     if (it->second != nullptr) {
@@ -188,7 +192,7 @@ bool GD_API PickAllObjects(
 
 bool GD_API PickRandomObject(
     RuntimeScene &,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    const RuntimeObjectsLists &pickedObjectLists) {
   // Create a list with all objects
   std::vector<RuntimeObject *> allObjects;
   for (auto it = pickedObjectLists.begin(); it != pickedObjectLists.end();
@@ -207,7 +211,7 @@ bool GD_API PickRandomObject(
 }
 
 bool GD_API PickNearestObject(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     double x,
     double y,
     bool inverted) {
@@ -237,7 +241,7 @@ bool GD_API PickNearestObject(
 }
 
 bool GD_API RaycastObject(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     float x,
     float y,
     float angle,
@@ -256,7 +260,7 @@ bool GD_API RaycastObject(
 }
 
 bool GD_API RaycastObjectToPosition(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     float x,
     float y,
     float endX,
@@ -19,12 +19,17 @@ using namespace std;
  * Test a collision between two sprites objects
  */
 bool GD_API SpriteCollision(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    const RuntimeObjectsLists &objectsLists1,
+    const RuntimeObjectsLists &objectsLists2,
     bool conditionInverted) {
   return TwoObjectListsTest(objectsLists1,
                             objectsLists2,
                             conditionInverted,
+                            [](RuntimeObject *obj) {
+                              return static_cast<RuntimeSpriteObject *>(obj)
+                                  ->GetCurrentSFMLSprite()
+                                  .getGlobalBounds();
+                            },
                             [](RuntimeObject *obj1, RuntimeObject *obj2) {
                               return CheckCollision(
                                   static_cast<RuntimeSpriteObject *>(obj1),
@@ -5,14 +5,15 @@
 #include <string>
 #include <vector>
 
+#include "GDCpp/Runtime/RuntimeContext.h"
 #include "GDCpp/Runtime/String.h"
 
 class RuntimeScene;
 class RuntimeObject;
 
 bool GD_API SpriteCollision(
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists1,
-    std::map<gd::String, std::vector<RuntimeObject *> *> objectsLists2,
+    const RuntimeObjectsLists &objectsLists1,
+    const RuntimeObjectsLists &objectsLists2,
     bool conditionInverted);
 
 #endif  // SPRITETOOLS_H
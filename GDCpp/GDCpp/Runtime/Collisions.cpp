@@ -5,63 +5,129 @@
  */
 #include "GDCpp/Runtime/Collisions.h"
 #include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
 #include "GDCore/Extensions/Builtin/SpriteExtension/Sprite.h"
 #include "GDCore/Project/ImageManager.h"
 #include "GDCpp/Runtime/RuntimeSpriteObject.h"
 
-bool PixelPerfectTest(const sf::Sprite& object1,
-                      const sf::Sprite& object2,
-                      sf::Uint8 AlphaLimit,
-                      const sf::Image& object1CollisionMask,
-                      const sf::Image& object2CollisionMask) {
+namespace {
+/**
+ * Return true if the transform is only translating points horizontally, and
+ * translating or scaling them vertically: consecutive pixels of a row are then
+ * transformed into consecutive pixels of a row.
+ */
+bool IsTranslatingRows(const float* matrix) {
+  return matrix[0] == 1 && matrix[1] == 0 && matrix[4] == 0;
+}
+
+/**
+ * Return the range of the pixels of the row, in the mask, that can be tested
+ * for a transform translating rows by \a translation (see IsTranslatingRows):
+ * pixels are tested when their transformed coordinate is strictly positive.
+ */
+void GetTestedPixelsRange(const AlphaMask& mask,
+                          float translation,
+                          int& offset,
+                          int& firstPixel,
+                          int& lastPixel) {
+  float flooredTranslation = std::floor(translation);
+  offset = flooredTranslation;
+  firstPixel = flooredTranslation == translation ? 1 : 0;
+  lastPixel = (int)mask.GetWidth() - 1;
+}
+}  // namespace
+
+bool GD_API PixelPerfectTest(const sf::Sprite& object1,
+                             const sf::Sprite& object2,
+                             const AlphaMask& object1CollisionMask,
+                             const AlphaMask& object2CollisionMask) {
   sf::FloatRect intersection;
-  if (object1.getGlobalBounds().intersects(object2.getGlobalBounds(),
-                                           intersection)) {
-    // We've got an intersection we need to process the pixels
-    // in that Rect.
+  if (!object1.getGlobalBounds().intersects(object2.getGlobalBounds(),
+                                            intersection))
+    return false;
 
-    // Bail out now if AlphaLimit = 0
-    if (AlphaLimit == 0) return true;
+  // We've got an intersection we need to process the pixels in that Rect:
+  // each pixel is transformed to a point in both images, and the pixels of
+  // the images at these points are tested. The points must be strictly
+  // inside the images.
+  const sf::Transform inverseTransform1 = object1.getInverseTransform();
+  const sf::Transform inverseTransform2 = object2.getInverseTransform();
+  const float* m1 = inverseTransform1.getMatrix();
+  const float* m2 = inverseTransform2.getMatrix();
+  float width1 = object1CollisionMask.GetWidth();
+  float height1 = object1CollisionMask.GetHeight();
+  float width2 = object2CollisionMask.GetWidth();
+  float height2 = object2CollisionMask.GetHeight();
 
-    // There are a few hacks here, sometimes the TransformToLocal returns
-    // negative points Or Points outside the image.  We need to check for these
-    // as they print to the error console which is slow, and then return black
-    // which registers as a hit.
+  int left = intersection.left;
+  int top = intersection.top;
+  float right = intersection.left + intersection.width;
+  float bottom = intersection.top + intersection.height;
+  int end = std::ceil(right);  // First column after the intersection.
 
-    sf::Vector2f o1v;
-    sf::Vector2f o2v;
-    // Loop through our pixels
-    for (int i = intersection.left; i < intersection.left + intersection.width;
-         i++)  // 4ian : Rect now uses width/height.
-    {
-      for (int j = intersection.top; j < intersection.top + intersection.height;
-           j++)  // 4ian : Rect now uses width/height.
-      {
-        o1v = object1.getInverseTransform().transformPoint(
-            i, j);  // Creating objects each loop :(
-        o2v = object2.getInverseTransform().transformPoint(i, j);
+  if (IsTranslatingRows(m1) && IsTranslatingRows(m2)) {
+    // Rows of pixels of the images can be compared 64 pixels at once.
+    int offset1, firstPixel1, lastPixel1;
+    int offset2, firstPixel2, lastPixel2;
+    GetTestedPixelsRange(
+        object1CollisionMask, m1[12], offset1, firstPixel1, lastPixel1);
+    GetTestedPixelsRange(
+        object2CollisionMask, m2[12], offset2, firstPixel2, lastPixel2);
+    int first = std::max(
+        left, std::max(firstPixel1 - offset1, firstPixel2 - offset2));
+    int last = std::min(end - 1,
+                        std::min(lastPixel1 - offset1, lastPixel2 - offset2));
+    if (first > last) return false;
 
-        // Hack to make sure pixels fall within the Sprite's Image
-        if (o1v.x > 0 && o1v.y > 0 && o2v.x > 0 && o2v.y > 0 &&
-            o1v.x < object1CollisionMask.getSize().x &&
-            o1v.y < object1CollisionMask.getSize().y &&
-            o2v.x < object2CollisionMask.getSize().x &&
-            o2v.y < object2CollisionMask.getSize().y) {
-          // If both sprites have opaque pixels at the same point we've got a
-          // hit
-          if ((object1CollisionMask
-                   .getPixel(static_cast<int>(o1v.x), static_cast<int>(o1v.y))
-                   .a > AlphaLimit) &&
-              (object2CollisionMask
-                   .getPixel(static_cast<int>(o2v.x), static_cast<int>(o2v.y))
-                   .a > AlphaLimit)) {
-            return true;
-          }
-        }
+    for (int j = top; j < bottom; j++) {
+      float y1 = m1[5] * j + m1[13];
+      float y2 = m2[5] * j + m2[13];
+      if (!(y1 > 0 && y2 > 0 && y1 < height1 && y2 < height2)) continue;
+
+      for (int i = first; i <= last; i += 64) {
+        std::uint64_t bits1 =
+            object1CollisionMask.GetBits(i + offset1, static_cast<int>(y1));
+        std::uint64_t bits2 =
+            object2CollisionMask.GetBits(i + offset2, static_cast<int>(y2));
+        std::uint64_t bits = bits1 & bits2;
+        if (last - i < 63) bits &= ((std::uint64_t)1 << (last - i + 1)) - 1;
+
+        if (bits) return true;
       }
     }
+
     return false;
   }
+
+  // Walk through the pixels, row by row, transforming them to the images
+  // coordinates (as sf::Transform::transformPoint does).
+  for (int j = top; j < bottom; j++) {
+    float rowX1 = m1[4] * j;
+    float rowY1 = m1[5] * j;
+    float rowX2 = m2[4] * j;
+    float rowY2 = m2[5] * j;
+
+    for (int i = left; i < right; i++) {
+      float x1 = m1[0] * i + rowX1 + m1[12];
+      float y1 = m1[1] * i + rowY1 + m1[13];
+      float x2 = m2[0] * i + rowX2 + m2[12];
+      float y2 = m2[1] * i + rowY2 + m2[13];
+
+      if (x1 > 0 && y1 > 0 && x2 > 0 && y2 > 0 && x1 < width1 &&
+          y1 < height1 && x2 < width2 && y2 < height2) {
+        // If both sprites have opaque pixels at the same point we've got a
+        // hit
+        if (object1CollisionMask.IsOpaque(static_cast<int>(x1),
+                                          static_cast<int>(y1)) &&
+            object2CollisionMask.IsOpaque(static_cast<int>(x2),
+                                          static_cast<int>(y2))) {
+          return true;
+        }
+      }
+    }
+  }
+
   return false;
 }
 
@@ -70,9 +136,9 @@ bool PixelPerfectTest(const sf::Sprite& object1,
  */
 bool GD_API CheckCollision(const RuntimeSpriteObject* const objet1,
                            const RuntimeSpriteObject* const objet2) {
-  return PixelPerfectTest(objet1->GetCurrentSFMLSprite(),
-                          objet2->GetCurrentSFMLSprite(),
-                          1,
-                          objet1->GetCurrentSprite().GetSFMLTexture()->image,
-                          objet2->GetCurrentSprite().GetSFMLTexture()->image);
+  return PixelPerfectTest(
+      objet1->GetCurrentSFMLSprite(),
+      objet2->GetCurrentSFMLSprite(),
+      objet1->GetCurrentSprite().GetSFMLTexture()->GetAlphaMask(1),
+      objet2->GetCurrentSprite().GetSFMLTexture()->GetAlphaMask(1));
 }
@@ -6,6 +6,28 @@
 #ifndef COLLISIONS_H_INCLUDED
 #define COLLISIONS_H_INCLUDED
 #include "GDCpp/Runtime/RuntimeSpriteObject.h"
+class AlphaMask;
+namespace sf {
+class Sprite;
+}
+
+/**
+ * \brief Pixel perfect collision test between two sprites, using the masks of
+ * the opaque pixels of their images.
+ *
+ * Rows of pixels are compared 64 pixels at once when the sprites are neither
+ * rotated nor scaled horizontally. Otherwise, each pixel of the intersection of
+ * the sprites is tested.
+ *
+ * \return true if opaque pixels of the sprites are overlapping
+ *
+ * \see SFMLTextureWrapper::GetAlphaMask
+ * \ingroup GameEngine
+ */
+bool GD_API PixelPerfectTest(const sf::Sprite& object1,
+                             const sf::Sprite& object2,
+                             const AlphaMask& object1CollisionMask,
+                             const AlphaMask& object2CollisionMask);
 
 /**
  * \brief Pixel perfect collision test between two sprite objects
@@ -6,11 +6,92 @@
 #include <fstream>
 #include <iostream>
 #include "GDCpp/Runtime/Tools/FileStream.h"
+#if defined(WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
-DatFile::DatFile(void) { m_buffer = NULL; }
+namespace {
+/**
+ * Map a file in memory, with pages being copied only if they are written.
+ * Return NULL if the file can't be mapped.
+ */
+char* MapFile(const gd::String& filename, std::size_t& size) {
+#if defined(WINDOWS)
+  HANDLE file = CreateFileW(filename.ToWide().c_str(),
+                            GENERIC_READ,
+                            FILE_SHARE_READ,
+                            NULL,
+                            OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL,
+                            NULL);
+  if (file == INVALID_HANDLE_VALUE) return NULL;
+
+  LARGE_INTEGER fileSize;
+  char* data = NULL;
+  if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+    HANDLE mapping =
+        CreateFileMappingW(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    if (mapping != NULL) {
+      data = static_cast<char*>(MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+      size = fileSize.QuadPart;
+      CloseHandle(mapping);  // The view keeps the mapping alive.
+    }
+  }
+  CloseHandle(file);
+  return data;
+#else
+  int file = open(filename.ToLocale().c_str(), O_RDONLY);
+  if (file == -1) return NULL;
+
+  struct stat fileStat;
+  char* data = NULL;
+  if (fstat(file, &fileStat) == 0 && fileStat.st_size > 0) {
+    void* mapping = mmap(NULL,
+                         fileStat.st_size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE,
+                         file,
+                         0);
+    if (mapping != MAP_FAILED) {
+      data = static_cast<char*>(mapping);
+      size = fileStat.st_size;
+    }
+  }
+  close(file);  // The mapping stays valid.
+  return data;
+#endif
+}
+
+void UnmapFile(char* data, std::size_t size) {
+#if defined(WINDOWS)
+  UnmapViewOfFile(data);
+#else
+  munmap(data, size);
+#endif
+}
+}  // namespace
 
-DatFile::~DatFile(void) {
-  if (m_buffer != NULL) delete[] m_buffer;
+DatFile::DatFile(void) : m_data(NULL), m_dataSize(0), m_mapped(false) {
+  memset(&m_header, 0, sizeof(m_header));
+}
+
+DatFile::~DatFile(void) { Close(); }
+
+void DatFile::Close() {
+  if (m_mapped) UnmapFile(m_data, m_dataSize);
+  m_data = NULL;
+  m_dataSize = 0;
+  m_mapped = false;
+  m_content.clear();
+  m_content.shrink_to_fit();
+  m_entries.clear();
+  m_entriesIndex.clear();
+  memset(&m_header, 0, sizeof(m_header));
 }
 bool DatFile::Create(std::vector<gd::String> files,
                      gd::String directory,
@@ -100,103 +181,89 @@ bool DatFile::Create(std::vector<gd::String> files,
  * Load the DatFile from a file. Return true on success
  */
 bool DatFile::Read(gd::String source) {
-  bool success = false;
+  Close();
 
-  // The input file stream from which we want informations
-  gd::FileStream datfile;
-  // A file entry in order to push it in the object's std::vector
-  sFileEntry entry;
+  // Map the DAT file in memory, or load it if it can't be mapped.
+  m_data = MapFile(source, m_dataSize);
+  m_mapped = m_data != NULL;
+  if (!m_mapped) {
+    gd::FileStream datfile;
+    datfile.open(source, std::ios_base::in | std::ios_base::binary);
+    if (!datfile.is_open()) return false;
 
-  // Filling the header with 0
-  memset(&m_header, 0, sizeof(m_header));
-  // We open the DAT file to read it
-  datfile.open(source, std::ios_base::in | std::ios_base::binary);
-  if (datfile.is_open()) {
-    // Getting to the Header position
+    datfile.seekg(0, std::ios::end);
+    m_content.resize(datfile.tellg());
     datfile.seekg(0, std::ios::beg);
-    // Reading the DAT Header
-    datfile.read((char*)&m_header, sizeof(sDATHeader));
-    // Next we are reading each file entry
-    for (std::size_t i = 0; i < m_header.nb_files; i++) {
-      // Reading a File Entry
-      datfile.read((char*)&entry, sizeof(sFileEntry));
-      // Pushing it in our std::vector
-      m_entries.push_back(entry);
+    datfile.read(m_content.data(), m_content.size());
+    datfile.close();
+    m_data = m_content.data();
+    m_dataSize = m_content.size();
+  }
+
+  // Reading the DAT Header
+  std::size_t entriesEnd = sizeof(sDATHeader);
+  if (m_dataSize >= entriesEnd) memcpy(&m_header, m_data, sizeof(sDATHeader));
+  entriesEnd += (std::size_t)m_header.nb_files * sizeof(sFileEntry);
+  if (m_dataSize < entriesEnd) {
+    cout << "Invalid DAT file " << source << endl;
+    Close();
+    return false;
+  }
+
+  // Next we are reading each file entry, indexing them by name. If files have
+  // the same name, the first one is used.
+  for (std::size_t i = 0; i < m_header.nb_files; i++) {
+    sFileEntry entry;
+    memcpy(&entry,
+           m_data + sizeof(sDATHeader) + i * sizeof(sFileEntry),
+           sizeof(sFileEntry));
+    entry.name[sizeof(entry.name) - 1] = 0;
+    m_entries.push_back(entry);
+
+    if (entry.offset < 0 || entry.size < 0 ||
+        (std::size_t)entry.offset > m_dataSize ||
+        (std::size_t)entry.size > m_dataSize - entry.offset) {
+      cout << "Invalid entry " << entry.name << " in DAT file " << source
+           << endl;
+      continue;
     }
-    // Since all seems ok, we keep the DAT file name
-    m_datfile = source;
-    success = true;
+    m_entriesIndex.insert(std::make_pair(gd::String(entry.name), i));
   }
-  // Closing the DAT file
-  datfile.close();
-  return success;
+
+  // Since all seems ok, we keep the DAT file name
+  m_datfile = source;
+  return true;
 }
 
 ////////////////////////////////////////////////////////////
 /// Check if the DatFile contains a file
 ////////////////////////////////////////////////////////////
-bool DatFile::ContainsFile(const gd::String& filename) {
-  if (m_header.nb_files != m_entries.size()) return false;
+bool DatFile::ContainsFile(const gd::String& filename) const {
+  return m_entriesIndex.find(filename) != m_entriesIndex.end();
+}
 
-  for (std::size_t i = 0; i < m_header.nb_files; i++) {
-    if (gd::String(m_entries[i].name) == filename) return true;
-  }
+bool DatFile::GetFileView(const gd::String& filename,
+                          const char*& data,
+                          std::size_t& size) const {
+  auto it = m_entriesIndex.find(filename);
+  if (it == m_entriesIndex.end()) return false;
 
-  return false;
+  const sFileEntry& entry = m_entries[it->second];
+  data = m_data + entry.offset;
+  size = entry.size;
+  return true;
 }
 
-char* DatFile::GetFile(gd::String filename) {
-  // The input file stream from which we want information
-  gd::FileStream datfile;
-
-  // Cleaning properly an ancient file loaded
-  if (m_buffer != NULL) {
-    delete[] m_buffer;
-    m_buffer = NULL;
-  }
+char* DatFile::GetFile(const gd::String& filename) const {
+  auto it = m_entriesIndex.find(filename);
+  if (it == m_entriesIndex.end()) return NULL;
 
-  // First, we have to find the file needed
-  for (std::size_t i = 0; i < m_header.nb_files; i++) {
-    // If we found it
-    if (gd::String(m_entries[i].name) == filename) {
-      // We are allocating memory to the buffer
-      m_buffer = new char[(m_entries[i].size)];
-      // Simple error catch
-      if (m_buffer == NULL) {
-        cout << "Unable to allocate a buffer of length " << (m_entries[i].size)
-             << " when loading " << filename << endl;
-        return (NULL);
-      }
-
-      // Opening the DAT file ot read the file datas needed
-      datfile.open(m_datfile, std::ios_base::in | std::ios_base::binary);
-      if (datfile.is_open()) {
-        // Going to the right position
-        datfile.seekg(m_entries[i].offset, std::ios::beg);
-        // Reading
-        datfile.read(m_buffer, m_entries[i].size);
-        // We can close the DAT file
-        datfile.close();
-        // Returning the buffer
-        cout << "Successfully loaded " << filename << endl;
-        return (m_buffer);
-      }
-      cout << "Unable to open file " << m_datfile << " when loading "
-           << filename << endl;
-    }
-  }
-  // Finally, there is no such file in our DAT file
-  return (NULL);
+  return m_data + m_entries[it->second].offset;
 }
 
-long int DatFile::GetFileSize(gd::String filename) {
-  // First, we have to find the file needed
-  for (std::size_t i = 0; i < m_header.nb_files; i++) {
-    // If we found it
-    if (gd::String(m_entries[i].name) == filename) {
-      // Returning the size of the file found
-      return (m_entries[i].size);
-    }
-  }
-  return (0);
+long int DatFile::GetFileSize(const gd::String& filename) const {
+  auto it = m_entriesIndex.find(filename);
+  if (it == m_entriesIndex.end()) return 0;
+
+  return m_entries[it->second].size;
 }
@@ -8,7 +8,9 @@
 #ifndef DATFILE_H
 #define DATFILE_H
 
+#include <cstddef>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "GDCpp/Runtime/String.h"
 
@@ -40,6 +42,12 @@ struct sFileEntry {
 /**
  * \brief Internal class used to create and access "DAT files".
  *
+ * When read, the DAT file is mapped in memory once (or loaded in memory if it
+ * can't be mapped) and an index of the entries is built, so that getting a
+ * file does not require any copy: GetFileView returns a pointer to the data of
+ * the file inside the DAT file, valid until the DatFile is destroyed or reads
+ * another DAT file. Getting files is thread safe.
+ *
  * \ingroup ResourcesManagement
  */
 class GD_API DatFile {
@@ -47,17 +55,40 @@ class GD_API DatFile {
   gd::String m_datfile;               /// name of the DAT file
   sDATHeader m_header;                /// file header
   std::vector<sFileEntry> m_entries;  /// vector of files entries
-  char* m_buffer;                     /// Buffer pointing on a file in memory
+  std::unordered_map<gd::String, std::size_t>
+      m_entriesIndex;  /// Index in m_entries of each file
+  char* m_data;        /// The content of the DAT file, in memory
+  std::size_t m_dataSize;       /// The size of the DAT file
+  bool m_mapped;                /// true if m_data is a mapping of the file
+  std::vector<char> m_content;  /// The content of the DAT file when it can't
+                                /// be mapped in memory
+
+  void Close();
+
  public:
   DatFile(void);
   ~DatFile(void);
   bool Create(std::vector<gd::String> files,
               gd::String directory,
               gd::String destination);
-  bool ContainsFile(const gd::String& filename);
+  bool ContainsFile(const gd::String& filename) const;
   bool Read(gd::String source);
-  char* GetFile(gd::String filename);
-  long int GetFileSize(gd::String filename);
+
+  /**
+   * \brief Get the data and the size of a file contained in the DAT file.
+   * \return false if the file is not in the DAT file.
+   */
+  bool GetFileView(const gd::String& filename,
+                   const char*& data,
+                   std::size_t& size) const;
+
+  /**
+   * \brief Return a pointer to the data of a file, or NULL if the file is not
+   * in the DAT file.
+   * \note The data belongs to the DatFile and must not be deleted.
+   */
+  char* GetFile(const gd::String& filename) const;
+  long int GetFileSize(const gd::String& filename) const;
 };
 
 #endif  // DATFILE_H
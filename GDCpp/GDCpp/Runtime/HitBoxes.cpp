@@ -0,0 +1,69 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/HitBoxes.h"
+#include <algorithm>
+#include <cmath>
+#include "GDCpp/Runtime/Polygon2d.h"
+
+void HitBoxes::Set(const std::vector<Polygon2d>& polygons) {
+  verticesX.clear();
+  verticesY.clear();
+  axesX.clear();
+  axesY.clear();
+  centersX.clear();
+  centersY.clear();
+  minX.clear();
+  minY.clear();
+  maxX.clear();
+  maxY.clear();
+  polygonsStart.clear();
+
+  for (const Polygon2d& polygon : polygons) {
+    const std::vector<sf::Vector2f>& vertices = polygon.vertices;
+    polygonsStart.push_back(verticesX.size());
+
+    float centerX = 0;
+    float centerY = 0;
+    float polygonMinX = vertices.empty() ? 0 : vertices[0].x;
+    float polygonMinY = vertices.empty() ? 0 : vertices[0].y;
+    float polygonMaxX = polygonMinX;
+    float polygonMaxY = polygonMinY;
+    for (std::size_t i = 0; i < vertices.size(); ++i) {
+      const sf::Vector2f& vertex = vertices[i];
+      const sf::Vector2f& nextVertex =
+          vertices[i + 1 < vertices.size() ? i + 1 : 0];
+      verticesX.push_back(vertex.x);
+      verticesY.push_back(vertex.y);
+
+      // The axis is orthogonal to the edge (same computation as
+      // PolygonCollisionTest for Polygon2d).
+      float axisX = -(nextVertex.y - vertex.y);
+      float axisY = nextVertex.x - vertex.x;
+      float length = sqrt(axisX * axisX + axisY * axisY);
+      if (length != 0.0f) {
+        axisX /= length;
+        axisY /= length;
+      }
+      axesX.push_back(axisX);
+      axesY.push_back(axisY);
+
+      centerX += vertex.x;
+      centerY += vertex.y;
+      polygonMinX = std::min(polygonMinX, vertex.x);
+      polygonMinY = std::min(polygonMinY, vertex.y);
+      polygonMaxX = std::max(polygonMaxX, vertex.x);
+      polygonMaxY = std::max(polygonMaxY, vertex.y);
+    }
+
+    centersX.push_back(centerX / vertices.size());
+    centersY.push_back(centerY / vertices.size());
+    minX.push_back(polygonMinX);
+    minY.push_back(polygonMinY);
+    maxX.push_back(polygonMaxX);
+    maxY.push_back(polygonMaxY);
+  }
+  polygonsStart.push_back(verticesX.size());
+}
@@ -0,0 +1,75 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef HITBOXES_H
+#define HITBOXES_H
+#include <cstddef>
+#include <vector>
+class Polygon2d;
+
+/**
+ * \brief The hitboxes of an object, in world coordinates, stored in a way
+ * suited for collision tests.
+ *
+ * Vertices of all the polygons are stored in contiguous arrays of coordinates
+ * (a "structure of arrays"), along with the normalized axes used by the
+ * Separating Axis Theorem (one per edge), the center and the bounding box of
+ * each polygon. This is computed once from the polygons and can then be used
+ * for any number of tests without allocations.
+ *
+ * \see RuntimeObject::GetCachedHitBoxes
+ * \see PolygonCollisionTest
+ * \ingroup GameEngine
+ */
+class GD_API HitBoxes {
+ public:
+  HitBoxes(){};
+  virtual ~HitBoxes(){};
+
+  /**
+   * \brief Replace the hitboxes by the specified polygons.
+   */
+  void Set(const std::vector<Polygon2d>& polygons);
+
+  /**
+   * \brief Return the number of polygons.
+   */
+  std::size_t GetPolygonsCount() const { return centersX.size(); }
+
+  /**
+   * \brief Return the index, in the vertices and axes arrays, of the first
+   * vertex of a polygon.
+   */
+  std::size_t GetFirstVertex(std::size_t polygon) const {
+    return polygonsStart[polygon];
+  }
+
+  /**
+   * \brief Return the number of vertices (and of axes) of a polygon.
+   */
+  std::size_t GetVerticesCount(std::size_t polygon) const {
+    return polygonsStart[polygon + 1] - polygonsStart[polygon];
+  }
+
+  std::vector<float> verticesX;  ///< X coordinates of the vertices.
+  std::vector<float> verticesY;  ///< Y coordinates of the vertices.
+  std::vector<float> axesX;  ///< X coordinates of the normalized axes, the
+                             ///< i-th axis being orthogonal to the edge going
+                             ///< from the i-th vertex to the next one.
+  std::vector<float> axesY;  ///< Y coordinates of the normalized axes.
+  std::vector<float> centersX;  ///< X coordinate of the polygons centers.
+  std::vector<float> centersY;  ///< Y coordinate of the polygons centers.
+  std::vector<float> minX;      ///< Bounding boxes of the polygons.
+  std::vector<float> minY;      ///< Bounding boxes of the polygons.
+  std::vector<float> maxX;      ///< Bounding boxes of the polygons.
+  std::vector<float> maxY;      ///< Bounding boxes of the polygons.
+
+ private:
+  std::vector<std::size_t> polygonsStart;  ///< Index of the first vertex of
+                                           ///< each polygon, followed by the
+                                           ///< total number of vertices.
+};
+
+#endif  // HITBOXES_H
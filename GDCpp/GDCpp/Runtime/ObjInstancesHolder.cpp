@@ -7,56 +7,76 @@
 #include "GDCpp/Runtime/RuntimeObject.h"
 #include "GDCpp/Runtime/profile.h"
 
+std::size_t ObjInstancesHolder::GetNameId(const gd::String& name) {
+  static std::unordered_map<gd::String, std::size_t> namesIds;
+
+  auto it = namesIds.find(name);
+  if (it != namesIds.end()) return it->second;
+
+  std::size_t nameId = namesIds.size();
+  namesIds[name] = nameId;
+  return nameId;
+}
+
+void ObjInstancesHolder::UpdateGeneration() {
+  static std::size_t lastGeneration = 0;
+  generation = ++lastGeneration;
+}
+
 RuntimeObject* ObjInstancesHolder::AddObject(RuntimeObjSPtr&& object) {
-  auto it = objectsInstances[object->GetName()].insert(
-      objectsInstances[object->GetName()].end(), std::move(object));
-  objectsInstancesRefs[(*it)->GetName()].push_back(it->get());
+  std::size_t nameId = GetNameId(object->GetName());
+  ReserveNameId(nameId);
+
+  RuntimeObject* objectPtr = object.get();
+  objectPtr->instancesNameId = nameId;
+  objectPtr->instancesIndex = objectsInstances[nameId].size();
+  objectsInstances[nameId].push_back(std::move(object));
+  objectsInstancesRefs[nameId].push_back(objectPtr);
+  UpdateGeneration();
 
-  return it->get();
+  return objectPtr;
 }
 
-RuntimeObjNonOwningPtrList ObjInstancesHolder::GetObjectsRawPointers(
-    const gd::String& name) {
-  return objectsInstancesRefs[name];
+RuntimeObjSPtr ObjInstancesHolder::TakeObject(const RuntimeObject* object) {
+  // The object knows where it is stored (if it's in this container).
+  std::size_t nameId = object->instancesNameId;
+  std::size_t index = object->instancesIndex;
+  if (nameId >= objectsInstances.size() ||
+      index >= objectsInstances[nameId].size() ||
+      objectsInstancesRefs[nameId][index] != object)
+    return nullptr;
+
+  // Remove the object while keeping the order of the other objects (used
+  // to render objects having the same Z order and to pick objects), and
+  // update the position of the objects after it.
+  RuntimeObjList& list = objectsInstances[nameId];
+  RuntimeObjNonOwningPtrList& refsList = objectsInstancesRefs[nameId];
+  RuntimeObjSPtr theObject = std::move(list[index]);
+  list.erase(list.begin() + index);
+  refsList.erase(refsList.begin() + index);
+  for (std::size_t i = index; i < refsList.size(); ++i)
+    refsList[i]->instancesIndex = i;
+
+  theObject->instancesNameId = gd::String::npos;
+  theObject->instancesIndex = gd::String::npos;
+  UpdateGeneration();
+  return theObject;
 }
 
 void ObjInstancesHolder::ObjectNameHasChanged(const RuntimeObject* object) {
-  std::unique_ptr<RuntimeObject> theObject;  // We need the object to keep
-                                             // alive.
-
-  // Find and erase the object from the object lists.
-  for (auto it = objectsInstances.begin(); it != objectsInstances.end(); ++it) {
-    RuntimeObjList& list = it->second;
-    for (std::size_t i = 0; i < list.size(); ++i) {
-      if (list[i].get() == object) {
-        theObject = std::move(list[i]);
-        list.erase(list.begin() + i);
-        break;
-      }
-    }
-  }
-  // Find and erase the object from the object raw pointers lists.
-  for (auto it = objectsInstancesRefs.begin(); it != objectsInstancesRefs.end();
-       ++it) {
-    RuntimeObjNonOwningPtrList& associatedList = it->second;
-    associatedList.erase(
-        std::remove(associatedList.begin(), associatedList.end(), object),
-        associatedList.end());
-  }
-
-  AddObject(std::move(theObject));
+  RuntimeObjSPtr theObject = TakeObject(object);
+  if (theObject) AddObject(std::move(theObject));
 }
 
 void ObjInstancesHolder::Init(const ObjInstancesHolder& other) {
-  objectsInstances.clear();
-  objectsInstancesRefs.clear();
+  Clear();
 
   for (auto it = other.objectsInstances.cbegin();
        it != other.objectsInstances.cend();
        ++it) {
-    for (std::size_t i = 0; i < it->second.size();
+    for (std::size_t i = 0; i < it->size();
          ++i)  // We need to really copy the objects
-      AddObject(std::unique_ptr<RuntimeObject>(it->second[i]->Clone()));
+      AddObject(std::unique_ptr<RuntimeObject>((*it)[i]->Clone()));
   }
 }
 
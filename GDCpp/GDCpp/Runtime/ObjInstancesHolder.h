@@ -2,6 +2,7 @@
 #define OBJINSTANCESHOLDER_H
 
 #include <algorithm>
+#include <deque>
 #include <map>
 #include <memory>
 #include <string>
@@ -20,6 +21,14 @@ using RuntimeObjSPtr = std::unique_ptr<RuntimeObject>;
 /**
  * \brief Contains lists of objects classified by the name of the objects.
  *
+ * Names of objects are associated to an identifier (see
+ * ObjInstancesHolder::GetNameId) so that the lists can be stored in an array
+ * and the generated code can get a list without hashing the name of the
+ * object.
+ *
+ * Objects are kept in the order they were added. The lists are never moved in
+ * memory, so that references to them stay valid while the container exists.
+ *
  * \see RuntimeScene
  * \ingroup GameEngine
  */
@@ -28,7 +37,7 @@ class GD_API ObjInstancesHolder {
   /**
    * \brief Default constructor
    */
-  ObjInstancesHolder(){};
+  ObjInstancesHolder() { UpdateGeneration(); };
 
   /**
    * \brief Copy constructor
@@ -46,6 +55,14 @@ class GD_API ObjInstancesHolder {
    */
   ObjInstancesHolder& operator=(const ObjInstancesHolder& other);
 
+  /**
+   * \brief Return the identifier associated to an object name.
+   *
+   * Identifiers are the same for all the containers and never change during
+   * the execution of the game.
+   */
+  static std::size_t GetNameId(const gd::String& name);
+
   /**
    * \brief Add a new object to the lists.
    * \note The object is then hold in the container and you can
@@ -57,13 +74,39 @@ class GD_API ObjInstancesHolder {
    * \brief Get all objects with the specified name
    */
   inline const RuntimeObjList& GetObjects(const gd::String& name) {
-    return objectsInstances[name];
+    return GetObjects(GetNameId(name));
+  }
+
+  /**
+   * \brief Get all objects with the name having the specified identifier.
+   * \see ObjInstancesHolder::GetNameId
+   */
+  inline const RuntimeObjList& GetObjects(std::size_t nameId) {
+    ReserveNameId(nameId);
+    return objectsInstances[nameId];
   }
 
   /**
    * \brief Get a "raw pointers" list to objects with the specified name
    */
-  RuntimeObjNonOwningPtrList GetObjectsRawPointers(const gd::String& name);
+  inline const RuntimeObjNonOwningPtrList& GetObjectsRawPointers(
+      const gd::String& name) {
+    return GetObjectsRawPointers(GetNameId(name));
+  }
+
+  /**
+   * \brief Get a "raw pointers" list to objects with the name having the
+   * specified identifier.
+   * \note The returned reference stays valid while the container exists
+   * (even if other name identifiers are used), but the list must be copied if
+   * objects are added or removed while it's used.
+   * \see ObjInstancesHolder::GetNameId
+   */
+  inline const RuntimeObjNonOwningPtrList& GetObjectsRawPointers(
+      std::size_t nameId) {
+    ReserveNameId(nameId);
+    return objectsInstancesRefs[nameId];
+  }
 
   /**
    * \brief Get a list of all objects contained.
@@ -71,11 +114,10 @@ class GD_API ObjInstancesHolder {
   inline RuntimeObjNonOwningPtrList GetAllObjects() {
     RuntimeObjNonOwningPtrList objList;
 
-    for (auto it = objectsInstances.begin(); it != objectsInstances.end();
+    for (auto it = objectsInstancesRefs.begin();
+         it != objectsInstancesRefs.end();
          ++it) {
-      for (auto it2 = it->second.begin(); it2 != it->second.end(); ++it2) {
-        objList.push_back(it2->get());
-      }
+      objList.insert(objList.end(), it->begin(), it->end());
     }
 
     return objList;
@@ -91,34 +133,18 @@ class GD_API ObjInstancesHolder {
    * \endcode
    */
   inline void RemoveObject(RuntimeObject* object) {
-    for (auto it = objectsInstances.begin(); it != objectsInstances.end();
-         ++it) {
-      RuntimeObjList& associatedList = it->second;
-      associatedList.erase(
-          std::remove_if(
-              associatedList.begin(),
-              associatedList.end(),
-              [&object](const std::unique_ptr<RuntimeObject>& objectPtr) {
-                return objectPtr.get() == object;
-              }),
-          associatedList.end());
-    }
-    for (auto it = objectsInstancesRefs.begin();
-         it != objectsInstancesRefs.end();
-         ++it) {
-      RuntimeObjNonOwningPtrList& associatedList = it->second;
-      associatedList.erase(
-          std::remove(associatedList.begin(), associatedList.end(), object),
-          associatedList.end());
-    }
+    TakeObject(object);  // The object is destroyed.
   }
 
   /**
    * \brief Remove an entire list of object with a given name
    */
   inline void RemoveObjects(const gd::String& name) {
-    objectsInstances[name].clear();
-    objectsInstancesRefs[name].clear();
+    std::size_t nameId = GetNameId(name);
+    ReserveNameId(nameId);
+    objectsInstances[nameId].clear();
+    objectsInstancesRefs[nameId].clear();
+    UpdateGeneration();
   }
 
   /**
@@ -131,18 +157,55 @@ class GD_API ObjInstancesHolder {
    * \note All objects contained inside are destroyed.
    */
   inline void Clear() {
-    objectsInstances.clear();
-    objectsInstancesRefs.clear();
+    for (auto& list : objectsInstances) list.clear();
+    for (auto& list : objectsInstancesRefs) list.clear();
+    UpdateGeneration();
   }
 
+  /**
+   * \brief Return a number changing each time objects are added to or removed
+   * from the container.
+   *
+   * Generations are unique among all the containers, so that something
+   * computed from a container can be checked to be still up to date.
+   */
+  std::size_t GetGeneration() const { return generation; }
+
  private:
   void Init(const ObjInstancesHolder& other);
 
-  std::unordered_map<gd::String, RuntimeObjList>
-      objectsInstances;  ///< The list of all objects, classified by name
-  std::unordered_map<gd::String, RuntimeObjNonOwningPtrList>
+  /**
+   * \brief Ensure that the lists for the specified name identifier exist.
+   *
+   * Lists are stored in deques, so that adding lists does not move the
+   * existing ones.
+   */
+  inline void ReserveNameId(std::size_t nameId) {
+    if (nameId >= objectsInstances.size()) {
+      objectsInstances.resize(nameId + 1);
+      objectsInstancesRefs.resize(nameId + 1);
+    }
+  }
+
+  /**
+   * \brief Remove the object from the lists, keeping the order of the other
+   * objects, and return it (or nullptr if the object is not in the
+   * container).
+   */
+  RuntimeObjSPtr TakeObject(const RuntimeObject* object);
+
+  /**
+   * \brief Give a new generation to the container (see GetGeneration).
+   */
+  void UpdateGeneration();
+
+  std::deque<RuntimeObjList>
+      objectsInstances;  ///< The list of all objects, classified by the
+                         ///< identifier of their name.
+  std::deque<RuntimeObjNonOwningPtrList>
       objectsInstancesRefs;  ///< Clones of the objectsInstances lists, but with
                              ///< references instead.
+  std::size_t generation;  ///< See GetGeneration.
 };
 
 #endif  // OBJINSTANCESHOLDER_H
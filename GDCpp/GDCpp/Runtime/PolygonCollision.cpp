@@ -7,7 +7,11 @@
 #include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include "GDCpp/Runtime/HitBoxes.h"
 #include "GDCpp/Runtime/Polygon2d.h"
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
 
 namespace {
 
@@ -52,6 +56,49 @@ void project(const sf::Vector2f axis,
   }
 }
 
+/**
+ * Project the vertices (given as arrays of coordinates) on the axis.
+ */
+void project(float axisX,
+             float axisY,
+             const float* verticesX,
+             const float* verticesY,
+             std::size_t count,
+             float& min,
+             float& max) {
+  std::size_t i = 0;
+  min = FLT_MAX;
+  max = -FLT_MAX;
+
+#if defined(__SSE__)
+  if (count >= 4) {
+    __m128 axisX4 = _mm_set1_ps(axisX);
+    __m128 axisY4 = _mm_set1_ps(axisY);
+    __m128 min4 = _mm_set1_ps(FLT_MAX);
+    __m128 max4 = _mm_set1_ps(-FLT_MAX);
+    for (; i + 4 <= count; i += 4) {
+      __m128 dp = _mm_add_ps(_mm_mul_ps(axisX4, _mm_loadu_ps(verticesX + i)),
+                             _mm_mul_ps(axisY4, _mm_loadu_ps(verticesY + i)));
+      min4 = _mm_min_ps(min4, dp);
+      max4 = _mm_max_ps(max4, dp);
+    }
+
+    float mins[4];
+    float maxs[4];
+    _mm_storeu_ps(mins, min4);
+    _mm_storeu_ps(maxs, max4);
+    min = std::min(std::min(mins[0], mins[1]), std::min(mins[2], mins[3]));
+    max = std::max(std::max(maxs[0], maxs[1]), std::max(maxs[2], maxs[3]));
+  }
+#endif
+
+  for (; i < count; ++i) {
+    float dp = axisX * verticesX[i] + axisY * verticesY[i];
+    min = std::min(min, dp);
+    max = std::max(max, dp);
+  }
+}
+
 float distance(float minA, float maxA, float minB, float maxB) {
   if (minA < minB)
     return minB - maxA;
@@ -132,6 +179,81 @@ CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
   return result;
 }
 
+CollisionResult GD_API PolygonCollisionTest(const HitBoxes& hitBoxes1,
+                                            std::size_t polygon1,
+                                            const HitBoxes& hitBoxes2,
+                                            std::size_t polygon2,
+                                            bool ignoreTouchingEdges) {
+  CollisionResult result;
+  result.collision = false;
+  result.move_axis.x = 0.0f;
+  result.move_axis.y = 0.0f;
+
+  std::size_t count1 = hitBoxes1.GetVerticesCount(polygon1);
+  std::size_t count2 = hitBoxes2.GetVerticesCount(polygon2);
+  if (count1 < 3 || count2 < 3) return result;
+
+  // Polygons with separated bounding boxes can't be overlapping.
+  if (hitBoxes1.minX[polygon1] > hitBoxes2.maxX[polygon2] ||
+      hitBoxes2.minX[polygon2] > hitBoxes1.maxX[polygon1] ||
+      hitBoxes1.minY[polygon1] > hitBoxes2.maxY[polygon2] ||
+      hitBoxes2.minY[polygon2] > hitBoxes1.maxY[polygon1])
+    return result;
+
+  const float* verticesX1 =
+      hitBoxes1.verticesX.data() + hitBoxes1.GetFirstVertex(polygon1);
+  const float* verticesY1 =
+      hitBoxes1.verticesY.data() + hitBoxes1.GetFirstVertex(polygon1);
+  const float* verticesX2 =
+      hitBoxes2.verticesX.data() + hitBoxes2.GetFirstVertex(polygon2);
+  const float* verticesY2 =
+      hitBoxes2.verticesY.data() + hitBoxes2.GetFirstVertex(polygon2);
+
+  sf::Vector2f move_axis(0, 0);
+  float min_dist = FLT_MAX;
+
+  // Iterate over all the axes of the edges composing the polygons
+  for (std::size_t i = 0; i < count1 + count2; i++) {
+    sf::Vector2f axis =
+        i < count1
+            ? sf::Vector2f(
+                  hitBoxes1.axesX[hitBoxes1.GetFirstVertex(polygon1) + i],
+                  hitBoxes1.axesY[hitBoxes1.GetFirstVertex(polygon1) + i])
+            : sf::Vector2f(
+                  hitBoxes2
+                      .axesX[hitBoxes2.GetFirstVertex(polygon2) + i - count1],
+                  hitBoxes2
+                      .axesY[hitBoxes2.GetFirstVertex(polygon2) + i - count1]);
+
+    float minA, maxA, minB, maxB;
+    project(axis.x, axis.y, verticesX1, verticesY1, count1, minA, maxA);
+    project(axis.x, axis.y, verticesX2, verticesY2, count2, minB, maxB);
+
+    float dist = distance(minA, maxA, minB, maxB);
+    if (dist > 0.0f || (dist == 0.0 && ignoreTouchingEdges)) {
+      // If the projections on the axis do not overlap, then
+      // there is no collision
+      return result;
+    }
+
+    float absDist = std::abs(dist);
+
+    if (absDist < min_dist) {
+      min_dist = absDist;
+      move_axis = axis;
+    }
+  }
+
+  result.collision = true;
+
+  sf::Vector2f d(hitBoxes1.centersX[polygon1] - hitBoxes2.centersX[polygon2],
+                 hitBoxes1.centersY[polygon1] - hitBoxes2.centersY[polygon2]);
+  if (dotProduct(d, move_axis) < 0.0f) move_axis = -move_axis;
+  result.move_axis = move_axis * min_dist;
+
+  return result;
+}
+
 RaycastResult GD_API PolygonRaycastTest(
     Polygon2d& poly, float startX, float startY, float endX, float endY) {
   RaycastResult result;
@@ -230,5 +352,27 @@ bool GD_API IsPointInsidePolygon(Polygon2d& poly, float x, float y) {
       inside = !inside;
   }
 
+  return inside;
+}
+
+bool GD_API IsPointInsidePolygon(const HitBoxes& hitBoxes,
+                                 std::size_t polygon,
+                                 float x,
+                                 float y) {
+  bool inside = false;
+  const float* verticesX =
+      hitBoxes.verticesX.data() + hitBoxes.GetFirstVertex(polygon);
+  const float* verticesY =
+      hitBoxes.verticesY.data() + hitBoxes.GetFirstVertex(polygon);
+  std::size_t count = hitBoxes.GetVerticesCount(polygon);
+
+  for (std::size_t i = 0, j = count - 1; i < count; j = i++) {
+    if (((verticesY[i] > y) != (verticesY[j] > y)) &&
+        (x < (verticesX[j] - verticesX[i]) * (y - verticesY[i]) /
+                     (verticesY[j] - verticesY[i]) +
+                 verticesX[i]))
+      inside = !inside;
+  }
+
   return inside;
 }
\ No newline at end of file
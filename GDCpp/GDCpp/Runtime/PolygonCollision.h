@@ -6,7 +6,9 @@
 #ifndef POLYGONCOLLISION_H
 #define POLYGONCOLLISION_H
 #include <SFML/System.hpp>
+#include <cstddef>
 class Polygon2d;
+class HitBoxes;
 
 /**
  * \brief Contains the result of PolygonCollisionTest.
@@ -48,6 +50,33 @@ CollisionResult GD_API PolygonCollisionTest(Polygon2d& p1,
                                             Polygon2d& p2,
                                             bool ignoreTouchingEdges = false);
 
+/**
+ * Do a collision test between a polygon of \a hitBoxes1 and a polygon of
+ * \a hitBoxes2.
+ * \warning Polygons must convexes.
+ *
+ * This gives the same result as PolygonCollisionTest for Polygon2d, but uses
+ * the axes already computed in the HitBoxes and first check if the bounding
+ * boxes of the polygons are overlapping. Projections are made 4 vertices at
+ * once when SSE is available.
+ *
+ * \param hitBoxes1 The hitboxes containing the first polygon
+ * \param polygon1 The index of the first polygon in \a hitBoxes1
+ * \param hitBoxes2 The hitboxes containing the second polygon
+ * \param polygon2 The index of the second polygon in \a hitBoxes2
+ * \param ignoreTouchingEdges If true, then edges that are touching each other,
+ * without the polygons actually overlapping, won't be considered in collision.
+ *
+ * \return true if polygons are overlapping
+ *
+ * \ingroup GameEngine
+ */
+CollisionResult GD_API PolygonCollisionTest(const HitBoxes& hitBoxes1,
+                                            std::size_t polygon1,
+                                            const HitBoxes& hitBoxes2,
+                                            std::size_t polygon2,
+                                            bool ignoreTouchingEdges = false);
+
 /**
  * Do a raycast test.
  * \warning Polygon must be convex.
@@ -73,4 +102,16 @@ RaycastResult GD_API PolygonRaycastTest(
  */
 bool GD_API IsPointInsidePolygon(Polygon2d& poly, float x, float y);
 
+/**
+ * Check if a point is inside a polygon of \a hitBoxes.
+ *
+ * \return true if the point is inside the polygon
+ *
+ * \ingroup GameEngine
+ */
+bool GD_API IsPointInsidePolygon(const HitBoxes& hitBoxes,
+                                 std::size_t polygon,
+                                 float x,
+                                 float y);
+
 #endif  // POLYGONCOLLISION_H
@@ -0,0 +1,82 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/RectanglesGrid.h"
+#include <cmath>
+
+namespace {
+/**
+ * Rectangles covering more cells than this are not stored in the cells.
+ */
+const int maxCellsPerRectangle = 16;
+
+/**
+ * Cells coordinates are kept in this range so that they can't overflow.
+ */
+const float maxCellCoordinate = 1 << 30;
+}  // namespace
+
+RectanglesGrid::RectanglesGrid() : currentQuery(0), cellSize(1) {}
+
+void RectanglesGrid::Build(const std::vector<sf::FloatRect>& rectangles_) {
+  rectangles = rectangles_;
+  cells.clear();
+  largeRectangles.clear();
+  lastQueries.assign(rectangles.size(), 0);
+  currentQuery = 0;
+
+  // Use cells as large as the average rectangle, so that most rectangles are
+  // stored in at most four cells.
+  double sizesSum = 0;
+  std::size_t finiteRectanglesCount = 0;
+  for (const auto& rectangle : rectangles) {
+    float size = std::max(rectangle.width, rectangle.height);
+    if (std::isfinite(size)) {
+      sizesSum += size;
+      finiteRectanglesCount++;
+    }
+  }
+  cellSize = finiteRectanglesCount > 0 ? sizesSum / finiteRectanglesCount : 1;
+  if (!(cellSize >= 1)) cellSize = 1;
+
+  for (std::size_t index = 0; index < rectangles.size(); ++index) {
+    int left, top, right, bottom;
+    if (!GetCellsRange(rectangles[index], left, top, right, bottom) ||
+        (long long)(right - left + 1) * (bottom - top + 1) >
+            maxCellsPerRectangle) {
+      largeRectangles.push_back(index);
+      continue;
+    }
+
+    for (int y = top; y <= bottom; ++y)
+      for (int x = left; x <= right; ++x)
+        cells.push_back(std::make_pair(GetCellKey(x, y), index));
+  }
+
+  std::sort(cells.begin(), cells.end());
+}
+
+bool RectanglesGrid::GetCellsRange(const sf::FloatRect& rectangle,
+                                   int& left,
+                                   int& top,
+                                   int& right,
+                                   int& bottom) const {
+  float cellLeft = std::floor(rectangle.left / cellSize);
+  float cellTop = std::floor(rectangle.top / cellSize);
+  float cellRight = std::floor((rectangle.left + rectangle.width) / cellSize);
+  float cellBottom = std::floor((rectangle.top + rectangle.height) / cellSize);
+
+  // Also false for NaN.
+  if (!(cellLeft >= -maxCellCoordinate && cellTop >= -maxCellCoordinate &&
+        cellRight <= maxCellCoordinate && cellBottom <= maxCellCoordinate &&
+        cellLeft <= cellRight && cellTop <= cellBottom))
+    return false;
+
+  left = cellLeft;
+  top = cellTop;
+  right = cellRight;
+  bottom = cellBottom;
+  return true;
+}
@@ -0,0 +1,114 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef RECTANGLESGRID_H
+#define RECTANGLESGRID_H
+
+#include <SFML/Graphics/Rect.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief A uniform grid storing rectangles, used to quickly find the
+ * rectangles intersecting another one.
+ *
+ * This is used as a "broad phase" by tests done between two lists of objects
+ * (see TwoObjectListsTest): instead of testing every pair of objects, only
+ * the pairs of objects with intersecting bounds are tested.
+ *
+ * The grid is built in a single pass from all the rectangles: the size of the
+ * cells is the average size of the rectangles. Rectangles much larger than the
+ * cells (or not finite) are not stored in the cells but returned by every
+ * query.
+ *
+ * \ingroup GameEngine
+ */
+class GD_API RectanglesGrid {
+ public:
+  RectanglesGrid();
+  virtual ~RectanglesGrid(){};
+
+  /**
+   * \brief Fill the grid with the specified rectangles, removing the previous
+   * ones.
+   */
+  void Build(const std::vector<sf::FloatRect>& rectangles);
+
+  /**
+   * \brief Call \a callback with the index of each rectangle (in the vector
+   * passed to Build) intersecting \a rectangle.
+   *
+   * Rectangles are considered as closed: touching rectangles are intersecting.
+   * The callback is called once per rectangle.
+   */
+  template <typename Callback>
+  void ForEachIntersectingRectangle(const sf::FloatRect& rectangle,
+                                    Callback callback) {
+    currentQuery++;
+    auto visit = [&](std::size_t index) {
+      if (lastQueries[index] == currentQuery) return;
+      lastQueries[index] = currentQuery;
+      if (AreIntersecting(rectangles[index], rectangle)) callback(index);
+    };
+
+    for (std::size_t index : largeRectangles) visit(index);
+
+    int left, top, right, bottom;
+    if (!GetCellsRange(rectangle, left, top, right, bottom) ||
+        (std::size_t)(right - left + 1) * (bottom - top + 1) >
+            rectangles.size()) {
+      // Checking all the rectangles is faster than looking in all the cells.
+      for (std::size_t index = 0; index < rectangles.size(); ++index)
+        visit(index);
+      return;
+    }
+
+    for (int y = top; y <= bottom; ++y) {
+      auto it = std::lower_bound(
+          cells.begin(),
+          cells.end(),
+          std::make_pair(GetCellKey(left, y), (std::size_t)0));
+      long long lastKey = GetCellKey(right, y);
+      for (; it != cells.end() && it->first <= lastKey; ++it) visit(it->second);
+    }
+  }
+
+  /**
+   * \brief Return true if the two rectangles are intersecting or touching.
+   *
+   * Rectangles with non finite coordinates are considered as intersecting
+   * any other rectangle.
+   */
+  static bool AreIntersecting(const sf::FloatRect& first,
+                              const sf::FloatRect& second) {
+    return !(first.left > second.left + second.width ||
+             second.left > first.left + first.width ||
+             first.top > second.top + second.height ||
+             second.top > first.top + first.height);
+  }
+
+ private:
+  bool GetCellsRange(const sf::FloatRect& rectangle,
+                     int& left,
+                     int& top,
+                     int& right,
+                     int& bottom) const;
+  static long long GetCellKey(int x, int y) {
+    return ((long long)y << 32) + ((long long)x + 0x80000000LL);
+  }
+
+  std::vector<sf::FloatRect> rectangles;
+  std::vector<std::pair<long long, std::size_t> >
+      cells;  ///< Cells key and index of the rectangles, sorted by key.
+  std::vector<std::size_t> largeRectangles;  ///< Rectangles not in cells.
+  std::vector<std::size_t> lastQueries;  ///< For each rectangle, the last
+                                         ///< query that returned it.
+  std::size_t currentQuery;
+  float cellSize;
+};
+
+#endif  // RECTANGLESGRID_H
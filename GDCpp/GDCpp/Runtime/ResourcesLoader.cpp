@@ -35,13 +35,10 @@ bool ResourcesLoader::SetResourceFile(const gd::String& filename) {
 
 void ResourcesLoader::LoadSFMLImage(const gd::String& filename,
                                     sf::Image& image) {
-  if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
-    if (buffer == NULL)
-      cout << "Failed to get the file of a SFML image from resource file: "
-           << filename << endl;
-
-    if (!image.loadFromMemory(buffer, resFile.GetFileSize(filename)))
+  const char* data;
+  std::size_t size;
+  if (resFile.GetFileView(filename, data, size)) {
+    if (!image.loadFromMemory(data, size))
       cout << "Failed to load a SFML image from resource file: " << filename
            << endl;
   } else {
@@ -61,13 +58,10 @@ sf::Texture ResourcesLoader::LoadSFMLTexture(const gd::String& filename) {
 
 void ResourcesLoader::LoadSFMLTexture(const gd::String& filename,
                                       sf::Texture& texture) {
-  if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
-    if (buffer == NULL)
-      cout << "Failed to get the file of a SFML texture from resource file: "
-           << filename << endl;
-
-    if (!texture.loadFromMemory(buffer, resFile.GetFileSize(filename)))
+  const char* data;
+  std::size_t size;
+  if (resFile.GetFileView(filename, data, size)) {
+    if (!texture.loadFromMemory(data, size))
       cout << "Failed to load a SFML texture from resource file: " << filename
            << endl;
   } else {
@@ -79,29 +73,19 @@ void ResourcesLoader::LoadSFMLTexture(const gd::String& filename,
 
 std::pair<sf::Font*, StreamHolder*> ResourcesLoader::LoadFont(
     const gd::String& filename) {
-  if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
-    size_t bufferSize = resFile.GetFileSize(filename);
-    if (buffer == nullptr) {
-      cout << "Failed to get the file of a font from resource file:" << filename
-           << endl;
-      return std::make_pair((sf::Font*)nullptr, (StreamHolder*)nullptr);
-    }
-
+  const char* data;
+  std::size_t size;
+  if (resFile.GetFileView(filename, data, size)) {
+    // The font reads its data as long as it is used: the data of the
+    // resource file stays in memory and can be used directly.
     sf::Font* font = new sf::Font();
-    char* fontBuffer = new char[bufferSize];
-    memcpy(fontBuffer, buffer, bufferSize);
-
-    if (!font->loadFromMemory(fontBuffer, bufferSize)) {
+    if (!font->loadFromMemory(data, size)) {
       cout << "Failed to load a font from resource file: " << filename << endl;
       delete font;
-      delete fontBuffer;
       return std::make_pair((sf::Font*)nullptr, (StreamHolder*)nullptr);
     }
 
-    StreamHolder* streamHolder = new StreamHolder();
-    streamHolder->buffer = fontBuffer;
-    return std::make_pair(font, streamHolder);
+    return std::make_pair(font, (StreamHolder*)nullptr);
   } else {
     sf::Font* font = new sf::Font();
     StreamHolder* streamHolder = new StreamHolder();
@@ -121,13 +105,10 @@ std::pair<sf::Font*, StreamHolder*> ResourcesLoader::LoadFont(
 sf::SoundBuffer ResourcesLoader::LoadSoundBuffer(const gd::String& filename) {
   sf::SoundBuffer sbuffer;
 
-  if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
-    if (buffer == NULL)
-      cout << "Failed to get the file of a sound buffer from resource file: "
-           << filename << endl;
-
-    if (!sbuffer.loadFromMemory(buffer, resFile.GetFileSize(filename)))
+  const char* data;
+  std::size_t size;
+  if (resFile.GetFileView(filename, data, size)) {
+    if (!sbuffer.loadFromMemory(data, size))
       cout << "Failed to load a sound buffer from resource file: " << filename
            << endl;
   } else {
@@ -142,13 +123,10 @@ sf::SoundBuffer ResourcesLoader::LoadSoundBuffer(const gd::String& filename) {
 gd::String ResourcesLoader::LoadPlainText(const gd::String& filename) {
   gd::String text;
 
-  if (resFile.ContainsFile(filename)) {
-    char* buffer = resFile.GetFile(filename);
-    if (!buffer) {
-      cout << "Failed to read a file from resource file: " << filename << endl;
-    } else {
-      text = gd::String::FromUTF8(std::string(buffer));
-    }
+  const char* data;
+  std::size_t size;
+  if (resFile.GetFileView(filename, data, size)) {
+    text = gd::String::FromUTF8(std::string(data, size));
   } else {
     char* buffer = LoadBinaryFile(filename);
     if (!buffer)
@@ -224,5 +202,11 @@ bool ResourcesLoader::HasFile(const gd::String& filename) {
   return resFile.ContainsFile(filename);
 }
 
+bool ResourcesLoader::GetFileView(const gd::String& filename,
+                                  const char*& data,
+                                  std::size_t& size) const {
+  return resFile.GetFileView(filename, data, size);
+}
+
 }  // namespace gd
 #endif
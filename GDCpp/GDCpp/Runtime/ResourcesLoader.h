@@ -68,6 +68,19 @@ class GD_API ResourcesLoader {
 
   bool HasFile(const gd::String &filename);
 
+  /**
+   * \brief Get the data and the size of a file of the resource file, without
+   * copying it.
+   *
+   * The data stays valid as long as the resource file is not changed (see
+   * SetResourceFile).
+   *
+   * \return false if the file is not in the resource file.
+   */
+  bool GetFileView(const gd::String &filename,
+                   const char *&data,
+                   std::size_t &size) const;
+
   static ResourcesLoader *Get() {
     if (NULL == _singleton) {
       _singleton = new ResourcesLoader;
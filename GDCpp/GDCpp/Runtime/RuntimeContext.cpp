@@ -1,30 +1,35 @@
 #include "RuntimeContext.h"
+#include <unordered_map>
 #include <vector>
 #include "GDCpp/Runtime/RuntimeGame.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
 #include "GDCpp/Runtime/profile.h"
 
-bool RuntimeContext::TriggerOnce(std::size_t conditionId) {
-  onceConditionsTriggered[conditionId] =
-      true;  // Remember that we triggered this condition.
+std::size_t RuntimeContext::GetTriggerOnceSlot(std::size_t conditionId) {
+  static std::unordered_map<std::size_t, std::size_t> conditionsSlots;
 
-  // Return true only if the condition was not triggered the last frame.
-  std::map<std::size_t, bool>::iterator lastFrame =
-      onceConditionsTriggeredLastFrame.find(conditionId);
-  return lastFrame == onceConditionsTriggeredLastFrame.end() ||
-         lastFrame->second == false;
-}
+  auto it = conditionsSlots.find(conditionId);
+  if (it != conditionsSlots.end()) return it->second;
 
-void RuntimeContext::StartNewFrame() {
-  onceConditionsTriggeredLastFrame = onceConditionsTriggered;
-  onceConditionsTriggered.clear();
+  std::size_t slot = conditionsSlots.size();
+  conditionsSlots[conditionId] = slot;
+  return slot;
 }
 
-std::vector<RuntimeObject *> RuntimeContext::GetObjectsRawPointers(
+const std::vector<RuntimeObject *> &RuntimeContext::GetObjectsRawPointers(
     const gd::String &name) {
   return scene->objectsInstances.GetObjectsRawPointers(name);
 }
 
+const std::vector<RuntimeObject *> &RuntimeContext::GetObjectsRawPointers(
+    std::size_t objectNameId) {
+  return scene->objectsInstances.GetObjectsRawPointers(objectNameId);
+}
+
+std::size_t RuntimeContext::GetObjectNameId(const gd::String &name) {
+  return ObjInstancesHolder::GetNameId(name);
+}
+
 RuntimeVariablesContainer &RuntimeContext::GetSceneVariables() {
   return scene->GetVariables();
 }
@@ -33,20 +38,21 @@ RuntimeVariablesContainer &RuntimeContext::GetGameVariables() {
   return scene->game->GetVariables();
 }
 
-RuntimeContext &RuntimeContext::ClearObjectListsMap() {
-  temporaryMap.clear();
+RuntimeContext &RuntimeContext::ClearObjectListsMap(std::size_t mapIndex) {
+  if (mapIndex >= objectListsMaps.size()) objectListsMaps.resize(mapIndex + 1);
+  currentObjectListsMap = &objectListsMaps[mapIndex];
+  currentObjectListsMap->clear();
 
   return *this;
 }
 
 RuntimeContext &RuntimeContext::AddObjectListToMap(
     const gd::String &objectName, std::vector<RuntimeObject *> &list) {
-  temporaryMap[objectName] = &list;
+  (*currentObjectListsMap)[objectName] = &list;
 
   return *this;
 }
 
-std::map<gd::String, std::vector<RuntimeObject *> *>
-RuntimeContext::ReturnObjectListsMap() {
-  return temporaryMap;
+const RuntimeObjectsLists &RuntimeContext::ReturnObjectListsMap() {
+  return *currentObjectListsMap;
 }
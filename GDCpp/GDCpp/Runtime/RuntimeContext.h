@@ -1,6 +1,7 @@
 #ifndef RUNTIMECONTEXT_H
 #define RUNTIMECONTEXT_H
 
+#include <deque>
 #include <map>
 #include <string>
 #include <vector>
@@ -9,6 +10,13 @@ class RuntimeObject;
 class RuntimeScene;
 class RuntimeVariablesContainer;
 
+/**
+ * \brief The lists of objects passed to a function by events generated code,
+ * by object name.
+ */
+typedef std::map<gd::String, std::vector<RuntimeObject *> *>
+    RuntimeObjectsLists;
+
 /**
  * \brief Helper class used by events generated code to get access to
  * various things without including "heavy" classes such as RuntimeScene.
@@ -19,7 +27,8 @@ class GD_API RuntimeContext {
    * \brief Construct the context for a scene.
    * \param scene The scene associated to the context.
    */
-  RuntimeContext(RuntimeScene *scene_) : scene(scene_){};
+  RuntimeContext(RuntimeScene *scene_)
+      : scene(scene_), currentObjectListsMap(nullptr), currentFrame(0){};
   virtual ~RuntimeContext(){};
 
   /**
@@ -28,7 +37,22 @@ class GD_API RuntimeContext {
    * scene->objectsInstances.GetObjectsRawPointers(name)
    * \endcode
    */
-  std::vector<RuntimeObject *> GetObjectsRawPointers(const gd::String &name);
+  const std::vector<RuntimeObject *> &GetObjectsRawPointers(
+      const gd::String &name);
+
+  /**
+   * \brief Shortcut to get a "raw pointers" list to objects with the name
+   * having the specified identifier (see GetObjectNameId), without hashing the
+   * name.
+   */
+  const std::vector<RuntimeObject *> &GetObjectsRawPointers(
+      std::size_t objectNameId);
+
+  /**
+   * \brief Shortcut for ObjInstancesHolder::GetNameId(name). Used by the
+   * events generated code to find the identifier of an object name once.
+   */
+  static std::size_t GetObjectNameId(const gd::String &name);
 
   /**
    * \brief Shortcut for scene->GetVariables();
@@ -40,29 +64,80 @@ class GD_API RuntimeContext {
    */
   RuntimeVariablesContainer &GetGameVariables();
 
+  /**
+   * \brief Return the slot associated to the identifier of a "Trigger once"
+   * condition (as given by the events code generator).
+   *
+   * Slots are allocated one after the other, so that the state of the
+   * conditions can be stored in an array. Used by the events generated code
+   * to find the slot of a condition once.
+   */
+  static std::size_t GetTriggerOnceSlot(std::size_t conditionId);
+
   /**
    * \brief Used by "Trigger once" conditions: Return true only if
-   * this method was not called with the same identifier during the last frame.
+   * this method was not called with the same slot during the last frame.
+   * \see GetTriggerOnceSlot
    */
-  bool TriggerOnce(std::size_t conditionId);
+  bool TriggerOnce(std::size_t conditionSlot) {
+    if (conditionSlot >= onceConditionsFrames.size())
+      onceConditionsFrames.resize(conditionSlot + 1);
+
+    // Remember that we triggered this condition during this frame.
+    OnceConditionFrames &frames = onceConditionsFrames[conditionSlot];
+    if (frames.lastFrame != currentFrame) {
+      frames.previousFrame = frames.lastFrame;
+      frames.lastFrame = currentFrame;
+    }
+
+    // Return true only if the condition was not triggered the last frame.
+    return frames.previousFrame == 0 ||
+           frames.previousFrame + 1 != currentFrame;
+  }
 
   /**
    * \brief To be called when events begin so that "Trigger once" conditions
    * are properly handled.
    */
-  void StartNewFrame();
+  void StartNewFrame() { currentFrame++; }
 
-  RuntimeContext &ClearObjectListsMap();
+  /**
+   * \brief Clear the map of objects lists with the specified index, to be
+   * filled with AddObjectListToMap and then passed to a function with
+   * ReturnObjectListsMap.
+   *
+   * Maps are reused instead of being copied. The code generator gives its own
+   * index to each parameter, so that all the maps passed to a function stay
+   * valid.
+   */
+  RuntimeContext &ClearObjectListsMap(std::size_t mapIndex);
   RuntimeContext &AddObjectListToMap(const gd::String &objectName,
                                      std::vector<RuntimeObject *> &list);
-  std::map<gd::String, std::vector<RuntimeObject *> *> ReturnObjectListsMap();
+  const RuntimeObjectsLists &ReturnObjectListsMap();
 
   RuntimeScene *scene;  ///< The associated scene.
 
  private:
-  std::map<gd::String, std::vector<RuntimeObject *> *> temporaryMap;
-  std::map<std::size_t, bool> onceConditionsTriggered;
-  std::map<std::size_t, bool> onceConditionsTriggeredLastFrame;
+  /**
+   * \brief The frames during which a "Trigger once" condition was triggered
+   * (0 if it was never triggered).
+   */
+  struct OnceConditionFrames {
+    OnceConditionFrames() : lastFrame(0), previousFrame(0){};
+
+    std::size_t lastFrame;      ///< The last frame the condition was triggered.
+    std::size_t previousFrame;  ///< The frame the condition was triggered
+                                ///< before lastFrame.
+  };
+
+  std::deque<RuntimeObjectsLists>
+      objectListsMaps;  ///< The maps returned by ReturnObjectListsMap, by
+                        ///< index. References to the maps stay valid when
+                        ///< the deque grows.
+  RuntimeObjectsLists *currentObjectListsMap;  ///< The map being filled.
+  std::vector<OnceConditionFrames>
+      onceConditionsFrames;  ///< Indexed by the slots of the conditions.
+  std::size_t currentFrame;  ///< The number of frames started.
 };
 
 #endif  // RUNTIMECONTEXT_H
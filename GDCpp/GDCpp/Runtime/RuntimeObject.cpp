@@ -21,9 +21,13 @@
 #include "GDCpp/Runtime/Project/Object.h"
 #include "GDCpp/Runtime/RuntimeBehavior.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/SpriteBatch.h"
 
 using namespace std;
 
+std::size_t RuntimeObject::zOrdersGeneration = 0;
+std::size_t RuntimeObject::layersGeneration = 0;
+
 RuntimeObject::RuntimeObject(RuntimeScene &scene, const gd::Object &object)
     : name(object.GetName()),
       type(object.GetType()),
@@ -31,7 +35,10 @@ RuntimeObject::RuntimeObject(RuntimeScene &scene, const gd::Object &object)
       Y(0),
       zOrder(0),
       hidden(false),
-      objectVariables(object.GetVariables()) {
+      objectVariables(object.GetVariables()),
+      cachedHitBoxesValid(false),
+      instancesNameId(gd::String::npos),
+      instancesIndex(gd::String::npos) {
   ClearForce();
 
   // Create the behaviors
@@ -58,8 +65,11 @@ void RuntimeObject::Init(const RuntimeObject &object) {
   zOrder = object.zOrder;
   hidden = object.hidden;
   layer = object.layer;
+  zOrdersGeneration++;
+  layersGeneration++;
   force5 = object.force5;
   forces = object.forces;
+  cachedHitBoxesValid = false;
 
   // Clone behaviors
   behaviors.clear();
@@ -69,6 +79,7 @@ void RuntimeObject::Init(const RuntimeObject &object) {
         gd::make_unique<RuntimeBehavior>(*it->second->Clone());
     behaviors[it->first]->SetOwner(this);
   }
+  UpdateBehaviorsSlots();
 }
 
 /**
@@ -78,8 +89,14 @@ void RuntimeObject::AddBehavior(const gd::String &name,
                                 std::unique_ptr<RuntimeBehavior> behavior) {
   behaviors[name] = std::move(behavior);
   behaviors[name]->SetOwner(this);
+  UpdateBehaviorsSlots();
 };
 
+void RuntimeObject::UpdateBehaviorsSlots() {
+  behaviorsSlots.clear();
+  for (auto &it : behaviors) behaviorsSlots.push_back(it.second.get());
+}
+
 #if defined(GD_IDE_ONLY)
 void RuntimeObject::GetPropertyForDebugger(std::size_t propertyNb,
                                            gd::String &name,
@@ -139,7 +156,7 @@ bool RuntimeObject::ChangeProperty(std::size_t propertyNb,
     } else
       SetHidden(false);
   } else if (propertyNb == 4) {
-    layer = newValue;
+    SetLayer(newValue);
   } else if (propertyNb == 5) {
     SetZOrder(newValue.To<int>());
   } else if (propertyNb == 6) {
@@ -240,15 +257,15 @@ void RuntimeObject::AddForceToMoveAround(float positionX,
 
 void RuntimeObject::Duplicate(
     RuntimeScene &scene,
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    const RuntimeObjectsLists &pickedObjectLists) {
   RuntimeObject *newObject =
       scene.objectsInstances.AddObject(std::unique_ptr<RuntimeObject>(Clone()));
 
-  if (pickedObjectLists[name] != NULL &&
-      find(pickedObjectLists[name]->begin(),
-           pickedObjectLists[name]->end(),
-           newObject) == pickedObjectLists[name]->end())
-    pickedObjectLists[name]->push_back(newObject);
+  auto list = pickedObjectLists.find(name);
+  if (list != pickedObjectLists.end() && list->second != NULL &&
+      find(list->second->begin(), list->second->end(), newObject) ==
+          list->second->end())
+    list->second->push_back(newObject);
 }
 
 bool RuntimeObject::IsStopped() { return TotalForceLength() == 0; }
@@ -300,10 +317,10 @@ double RuntimeObject::GetDistanceWithObject(RuntimeObject *object) {
 }
 
 bool RuntimeObject::SeparateFromObjects(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists,
+    const RuntimeObjectsLists &pickedObjectLists,
     bool ignoreTouchingEdges) {
   vector<RuntimeObject *> objects;
-  for (std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
+  for (RuntimeObjectsLists::const_iterator it =
            pickedObjectLists.begin();
        it != pickedObjectLists.end();
        ++it) {
@@ -323,12 +340,12 @@ bool RuntimeObject::SeparateFromObjects(
   sf::Vector2f moveVector;
   for (std::size_t j = 0; j < objects.size(); ++j) {
     if (objects[j] != this) {
-      std::vector<Polygon2d> hitBoxes = GetHitBoxes(objects[j]->GetAABB());
-      vector<Polygon2d> otherHitBoxes = objects[j]->GetHitBoxes(GetAABB());
-      for (std::size_t k = 0; k < hitBoxes.size(); ++k) {
-        for (std::size_t l = 0; l < otherHitBoxes.size(); ++l) {
+      const HitBoxes &hitBoxes = GetCachedHitBoxes();
+      const HitBoxes &otherHitBoxes = objects[j]->GetCachedHitBoxes();
+      for (std::size_t k = 0; k < hitBoxes.GetPolygonsCount(); ++k) {
+        for (std::size_t l = 0; l < otherHitBoxes.GetPolygonsCount(); ++l) {
           CollisionResult result = PolygonCollisionTest(
-              hitBoxes[k], otherHitBoxes[l], ignoreTouchingEdges);
+              hitBoxes, k, otherHitBoxes, l, ignoreTouchingEdges);
           if (result.collision) {
             moveVector += result.move_axis;
             moved = true;
@@ -406,18 +423,12 @@ bool RuntimeObject::IsCollidingWith(RuntimeObject *obj2,
     return false;
 
   // Do a real check if necessary.
-
-  // Get the bounding rect of the two objects to use them
-  // as a hint to get the other's hitboxes
-  sf::FloatRect objRect = obj1->GetAABB();
-  sf::FloatRect obj2Rect = obj2->GetAABB();
-
-  vector<Polygon2d> objHitboxes = obj1->GetHitBoxes(obj2Rect);
-  vector<Polygon2d> obj2Hitboxes = obj2->GetHitBoxes(objRect);
-  for (std::size_t k = 0; k < objHitboxes.size(); ++k) {
-    for (std::size_t l = 0; l < obj2Hitboxes.size(); ++l) {
+  const HitBoxes &objHitboxes = obj1->GetCachedHitBoxes();
+  const HitBoxes &obj2Hitboxes = obj2->GetCachedHitBoxes();
+  for (std::size_t k = 0; k < objHitboxes.GetPolygonsCount(); ++k) {
+    for (std::size_t l = 0; l < obj2Hitboxes.GetPolygonsCount(); ++l) {
       if (PolygonCollisionTest(
-              objHitboxes[k], obj2Hitboxes[l], ignoreTouchingEdges)
+              objHitboxes, k, obj2Hitboxes, l, ignoreTouchingEdges)
               .collision)
         return true;
     }
@@ -427,9 +438,9 @@ bool RuntimeObject::IsCollidingWith(RuntimeObject *obj2,
 }
 
 bool RuntimeObject::IsCollidingWithPoint(float pointX, float pointY) {
-  vector<Polygon2d> hitBoxes = GetHitBoxes();
-  for (std::size_t i = 0; i < hitBoxes.size(); ++i) {
-    if (IsPointInsidePolygon(hitBoxes[i], pointX, pointY)) return true;
+  const HitBoxes &hitBoxes = GetCachedHitBoxes();
+  for (std::size_t i = 0; i < hitBoxes.GetPolygonsCount(); ++i) {
+    if (IsPointInsidePolygon(hitBoxes, i, pointX, pointY)) return true;
   }
 
   return false;
@@ -473,9 +484,9 @@ RaycastResult RuntimeObject::RaycastTest(
 }
 
 void RuntimeObject::SeparateObjectsWithoutForces(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    const RuntimeObjectsLists &pickedObjectLists) {
   vector<RuntimeObject *> objects2;
-  for (std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
+  for (RuntimeObjectsLists::const_iterator it =
            pickedObjectLists.begin();
        it != pickedObjectLists.end();
        ++it) {
@@ -513,9 +524,9 @@ void RuntimeObject::SeparateObjectsWithoutForces(
 }
 
 void RuntimeObject::SeparateObjectsWithForces(
-    std::map<gd::String, std::vector<RuntimeObject *> *> pickedObjectLists) {
+    const RuntimeObjectsLists &pickedObjectLists) {
   vector<RuntimeObject *> objects2;
-  for (std::map<gd::String, std::vector<RuntimeObject *> *>::const_iterator it =
+  for (RuntimeObjectsLists::const_iterator it =
            pickedObjectLists.begin();
        it != pickedObjectLists.end();
        ++it) {
@@ -610,6 +621,11 @@ void RuntimeObject::SetXY(const char *xOperator,
     SetY(GetY() / yValue);
 }
 
+bool RuntimeObject::DrawInBatch(SpriteBatch &batch) {
+  batch.Flush();
+  return Draw(batch.GetRenderTarget());
+}
+
 sf::FloatRect RuntimeObject::GetAABB() const {
   sf::FloatRect notTransformedAABB(
       -GetCenterX(), -GetCenterY(), GetWidth(), GetHeight());
@@ -642,6 +658,27 @@ std::vector<Polygon2d> RuntimeObject::GetHitBoxes(sf::FloatRect hint) const {
   return GetHitBoxes();
 }
 
+const HitBoxes &RuntimeObject::GetCachedHitBoxes() const {
+  // Get the transform first, as it can call InvalidateHitBoxes (when a
+  // sprite is updated for example).
+  HitBoxesTransform transform = {GetX(),
+                                 GetY(),
+                                 GetDrawableX(),
+                                 GetDrawableY(),
+                                 GetCenterX(),
+                                 GetCenterY(),
+                                 GetWidth(),
+                                 GetHeight(),
+                                 GetAngle()};
+  if (!cachedHitBoxesValid || !(transform == cachedHitBoxesTransform)) {
+    cachedHitBoxes.Set(GetHitBoxes());
+    cachedHitBoxesTransform = transform;
+    cachedHitBoxesValid = true;
+  }
+
+  return cachedHitBoxes;
+}
+
 bool RuntimeObject::CursorOnObject(RuntimeScene &scene, bool) {
   RuntimeLayer &theLayer = scene.GetRuntimeLayer(layer);
   auto insideObject = [this](const sf::Vector2f &pos) {
@@ -678,6 +715,13 @@ RuntimeBehavior *RuntimeObject::GetBehaviorRawPointer(
   return behaviors.find(name)->second.get();
 }
 
+std::size_t RuntimeObject::GetBehaviorSlot(const gd::String &name) const {
+  auto it = behaviors.find(name);
+  if (it == behaviors.end()) return gd::String::npos;
+
+  return std::distance(behaviors.begin(), it);
+}
+
 bool RuntimeObject::ClearForce() {
   force5.SetLength(0);  // Clear the deprecated force
   force5.SetClearing(0);
@@ -13,7 +13,9 @@
 #include <vector>
 #include "GDCore/Tools/MakeUnique.h"
 #include "GDCpp/Runtime/Force.h"
+#include "GDCpp/Runtime/HitBoxes.h"
 #include "GDCpp/Runtime/RuntimeBehavior.h"
+#include "GDCpp/Runtime/RuntimeContext.h"
 #include "GDCpp/Runtime/RuntimeVariablesContainer.h"
 #include "GDCpp/Runtime/String.h"
 namespace gd {
@@ -26,6 +28,7 @@ class RenderTarget;
 class Polygon2d;
 class RaycastResult;
 class RuntimeScene;
+class SpriteBatch;
 
 /**
  * \brief A RuntimeObject is something displayed on the scene.
@@ -37,7 +40,9 @@ class RuntimeScene;
  * gd::Object.
  * - An important function is RuntimeObject::Draw. It is called to render the
  * object on the scene. This function take in parameter a reference to the
- * target where render the object.
+ * target where render the object. Objects made of sprites can also redefine
+ * RuntimeObject::DrawInBatch, so that sprites sharing a texture are drawn
+ * together.
  * - RuntimeObject must be able to return their size, by redefining
  * RuntimeObject::GetWidth and RuntimeObject::GetHeight
  * - RuntimeObject must be able to return the position where they have precisely
@@ -90,7 +95,10 @@ class GD_API RuntimeObject {
   /**
    * \brief Copy constructor. Calls Init().
    */
-  RuntimeObject(const RuntimeObject& object) { Init(object); };
+  RuntimeObject(const RuntimeObject& object)
+      : instancesNameId(gd::String::npos), instancesIndex(gd::String::npos) {
+    Init(object);
+  };
 
   /**
    * \brief Assignment operator. Calls Init().
@@ -136,6 +144,24 @@ class GD_API RuntimeObject {
    */
   virtual bool Draw(sf::RenderTarget& renderTarget) { return true; };
 
+  /**
+   * \brief Draw the object using a SpriteBatch, used by the scene to draw
+   * objects.
+   *
+   * By default, the batch is flushed and the object is drawn with
+   * RuntimeObject::Draw on the render target of the batch.
+   */
+  virtual bool DrawInBatch(SpriteBatch& batch);
+
+  /**
+   * \brief Return true if the object is only drawn inside its AABB (see
+   * GetAABB), so that it's not drawn when its AABB is outside of the cameras.
+   *
+   * Objects drawing outside of their AABB (like particles or shapes painted
+   * anywhere) must return false.
+   */
+  virtual bool IsDrawnInsideAABB() const { return true; };
+
   /** \name Object variables
    * Members functions providing access to the object variables.
    */
@@ -180,6 +206,28 @@ class GD_API RuntimeObject {
    */
   RuntimeBehavior* GetBehaviorRawPointer(const gd::String& name) const;
 
+  /**
+   * \brief Return the slot of the behavior with the specified name, to be
+   * used with GetBehaviorRawPointerAtSlot, or gd::String::npos if the object
+   * has no such behavior.
+   *
+   * Objects created from the same gd::Object have their behaviors in the same
+   * slots, so that the generated code can find the slot once for all the
+   * instances of an object.
+   */
+  std::size_t GetBehaviorSlot(const gd::String& name) const;
+
+  /**
+   * \brief Return the behavior in the specified slot, without searching it
+   * by its name.
+   *
+   * Only used by GD events generated code.
+   * \see GetBehaviorSlot
+   */
+  RuntimeBehavior* GetBehaviorRawPointerAtSlot(std::size_t slot) const {
+    return behaviorsSlots[slot];
+  };
+
   /**
    * \brief Return true if the object has the behavior with the specified name.
    */
@@ -211,7 +259,17 @@ class GD_API RuntimeObject {
   /**
    * \brief Change the Z order of the object
    */
-  inline void SetZOrder(int zOrder_) { zOrder = zOrder_; }
+  inline void SetZOrder(int zOrder_) {
+    if (zOrder_ == zOrder) return;
+    zOrder = zOrder_;
+    zOrdersGeneration++;
+  }
+
+  /**
+   * \brief Return a number changing each time the Z order of an object is
+   * changed, used by RuntimeScene to know if objects must be sorted again.
+   */
+  static std::size_t GetZOrdersGeneration() { return zOrdersGeneration; }
 
   /**
    * \brief Return if the object is hidden or not
@@ -231,7 +289,17 @@ class GD_API RuntimeObject {
   /**
    * \brief Change the layer of the object
    */
-  inline void SetLayer(const gd::String& layer_) { layer = layer_; }
+  inline void SetLayer(const gd::String& layer_) {
+    if (layer_ == layer) return;
+    layer = layer_;
+    layersGeneration++;
+  }
+
+  /**
+   * \brief Return a number changing each time the layer of an object is
+   * changed, used by RuntimeScene to know if objects must be classified again.
+   */
+  static std::size_t GetLayersGeneration() { return layersGeneration; }
 
   /**
    * \brief Get the layer of the object
@@ -264,6 +332,16 @@ class GD_API RuntimeObject {
    */
   virtual std::vector<Polygon2d> GetHitBoxes(sf::FloatRect hint) const;
 
+  /**
+   * \brief Get the object hitboxes, stored in a cache ready to be used for
+   * collision tests.
+   *
+   * The cache is updated, using GetHitBoxes(), only when the position, the
+   * size, the center or the angle of the object changed, or after
+   * InvalidateHitBoxes() was called.
+   */
+  const HitBoxes& GetCachedHitBoxes() const;
+
   /**
    * \brief Check collision between two objects using their hitboxes.
    *
@@ -578,7 +656,7 @@ class GD_API RuntimeObject {
 
   void Duplicate(
       RuntimeScene& scene,
-      std::map<gd::String, std::vector<RuntimeObject*>*> pickedObjectLists);
+      const RuntimeObjectsLists& pickedObjectLists);
   void ActivateBehavior(const gd::String& behaviorName, bool activate = true);
   bool BehaviorActivated(const gd::String& behaviorName);
 
@@ -589,18 +667,18 @@ class GD_API RuntimeObject {
   double GetDistanceWithObject(RuntimeObject* other);
 
   bool SeparateFromObjects(
-      std::map<gd::String, std::vector<RuntimeObject*>*> pickedObjectLists,
+      const RuntimeObjectsLists& pickedObjectLists,
       bool ignoreTouchingEdges = false);
 
   /** \deprecated
    */
   void SeparateObjectsWithoutForces(
-      std::map<gd::String, std::vector<RuntimeObject*>*> pickedObjectLists);
+      const RuntimeObjectsLists& pickedObjectLists);
 
   /** \deprecated
    */
   void SeparateObjectsWithForces(
-      std::map<gd::String, std::vector<RuntimeObject*>*> pickedObjectLists);
+      const RuntimeObjectsLists& pickedObjectLists);
   ///@}
 
  protected:
@@ -616,15 +694,61 @@ class GD_API RuntimeObject {
   std::map<gd::String, std::unique_ptr<RuntimeBehavior>>
       behaviors;  ///< Contains all behaviors of the object. Behaviors are the
                   ///< ownership of the object
+  std::vector<RuntimeBehavior*>
+      behaviorsSlots;  ///< The behaviors, in the same order as in behaviors.
   RuntimeVariablesContainer
       objectVariables;        ///< List of the variables of the object
   std::vector<Force> forces;  ///< Forces applied to the object
 
+  /**
+   * \brief Must be called by objects when their hitboxes are changed without
+   * a change of their position, size, center or angle (for example, when a
+   * sprite is flipped).
+   *
+   * \see GetCachedHitBoxes
+   */
+  void InvalidateHitBoxes() const { cachedHitBoxesValid = false; }
+
   /**
    * \brief Initialize object using another object. Used by copy-ctor and
    * assign-op. \warning Don't forget to update me if members were changed!
    */
   void Init(const RuntimeObject& object);
+
+ private:
+  /**
+   * \brief Fill behaviorsSlots with the behaviors of the object.
+   */
+  void UpdateBehaviorsSlots();
+
+  /**
+   * \brief The properties of the object used to know if the cached hitboxes
+   * are still valid.
+   */
+  struct HitBoxesTransform {
+    float x, y, drawableX, drawableY, centerX, centerY, width, height, angle;
+
+    bool operator==(const HitBoxesTransform& other) const {
+      return x == other.x && y == other.y && drawableX == other.drawableX &&
+             drawableY == other.drawableY && centerX == other.centerX &&
+             centerY == other.centerY && width == other.width &&
+             height == other.height && angle == other.angle;
+    }
+  };
+
+  mutable HitBoxes cachedHitBoxes;  ///< See GetCachedHitBoxes.
+  mutable HitBoxesTransform
+      cachedHitBoxesTransform;        ///< The transform of cachedHitBoxes.
+  mutable bool cachedHitBoxesValid;  ///< False if cachedHitBoxes must be
+                                     ///< updated.
+
+  static std::size_t zOrdersGeneration;  ///< See GetZOrdersGeneration.
+  static std::size_t layersGeneration;   ///< See GetLayersGeneration.
+
+  friend class ObjInstancesHolder;
+  std::size_t instancesNameId;  ///< The identifier of the name of the list
+                                ///< of ObjInstancesHolder storing the object.
+  std::size_t instancesIndex;   ///< The position of the object in this list.
 };
 
 #endif  // RUNTIMEOBJECT_H
@@ -5,18 +5,84 @@
  */
 #include "RuntimeObjectsListsTools.h"
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include "RuntimeObject.h"
 #include "RuntimeScene.h"
 
-void GD_API PickOnly(RuntimeObjectsLists& pickedObjectsLists,
+void GD_API PickOnly(const RuntimeObjectsLists& pickedObjectsLists,
                      RuntimeObject* thisOne) {
   for (auto it = pickedObjectsLists.begin(); it != pickedObjectsLists.end();
        ++it) {
     if (it->second != NULL) it->second->clear();
   }
 
-  if (pickedObjectsLists[thisOne->GetName()] != NULL)
-    pickedObjectsLists[thisOne->GetName()]->push_back(thisOne);
+  auto list = pickedObjectsLists.find(thisOne->GetName());
+  if (list != pickedObjectsLists.end() && list->second != NULL)
+    list->second->push_back(thisOne);
 }
+
+void PickedObjectsFlags::Reset(const RuntimeObjectsLists& objectsLists) {
+  listsFirstBit.clear();
+  listsSize.clear();
+
+  std::size_t wordsCount = 0;
+  for (auto it = objectsLists.begin(); it != objectsLists.end(); ++it) {
+    std::size_t size = it->second ? it->second->size() : 0;
+    listsFirstBit.push_back(wordsCount * 64);
+    listsSize.push_back(size);
+    wordsCount += (size + 63) / 64;
+  }
+
+  words.assign(wordsCount, 0);
+}
+
+void PickedObjectsFlags::Trim(const RuntimeObjectsLists& objectsLists,
+                              bool skipTrimmedLists) const {
+  std::size_t i = 0;
+  for (auto it = objectsLists.begin(); it != objectsLists.end(); ++it, ++i) {
+    size_t finalSize = 0;
+    if (!it->second) continue;
+    std::vector<RuntimeObject*>& arr = *it->second;
+
+    //*This is important*! We can have a list that has already been trimmed
+    // just before
+    if (skipTrimmedLists && arr.size() != listsSize[i]) continue;
+
+    for (std::size_t k = 0; k < arr.size(); ++k) {
+      RuntimeObject* obj = arr[k];
+      if (IsPicked(i, k)) {
+        arr[finalSize] = obj;
+        finalSize++;
+      }
+    }
+    arr.resize(finalSize);
+  }
+}
+
+namespace {
+/**
+ * The scratches used by the picking functions of the current thread, the
+ * first usedScratchesCount ones being in use.
+ */
+struct ObjectsPickingScratchPool {
+  ObjectsPickingScratchPool() : usedScratchesCount(0) {}
+
+  std::vector<std::unique_ptr<ObjectsPickingScratch> > scratches;
+  std::size_t usedScratchesCount;
+};
+
+thread_local ObjectsPickingScratchPool scratchPool;
+
+ObjectsPickingScratch& AcquireScratch() {
+  if (scratchPool.usedScratchesCount == scratchPool.scratches.size())
+    scratchPool.scratches.emplace_back(new ObjectsPickingScratch);
+
+  return *scratchPool.scratches[scratchPool.usedScratchesCount++];
+}
+}  // namespace
+
+ObjectsPickingScratch::Scope::Scope() : scratch(AcquireScratch()) {}
+
+ObjectsPickingScratch::Scope::~Scope() { scratchPool.usedScratchesCount--; }
@@ -6,24 +6,119 @@
 #ifndef OBJECTSLISTSTOOLS_H
 #define OBJECTSLISTSTOOLS_H
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
+#include "RectanglesGrid.h"
 #include "RuntimeObject.h"
 #include "RuntimeScene.h"
 
-typedef std::map<gd::String, std::vector<RuntimeObject *> *>
-    RuntimeObjectsLists;
-
 /**
  * \brief Keep only the specified object in the lists of picked objects.
  * \param objectsLists The lists of objects to trim
  * \param thisOne The object to keep in the lists
  * \ingroup GameEngine
  */
-void GD_API PickOnly(RuntimeObjectsLists &pickedObjectsLists,
+void GD_API PickOnly(const RuntimeObjectsLists &pickedObjectsLists,
                      RuntimeObject *thisOne);
 
+/**
+ * \brief Flags telling, for each object of some lists, if it is picked.
+ *
+ * Flags are stored in a flat bitset (a bit per object, the bits of each list
+ * starting on a new word) which is reused by successive calls to Reset, so
+ * that no allocation is done once it is large enough.
+ *
+ * \see ObjectsPickingScratch
+ * \ingroup GameEngine
+ */
+class GD_API PickedObjectsFlags {
+ public:
+  PickedObjectsFlags(){};
+  virtual ~PickedObjectsFlags(){};
+
+  /**
+   * \brief Set up a flag, initially not picked, for each object of the lists.
+   */
+  void Reset(const RuntimeObjectsLists &objectsLists);
+
+  /**
+   * \brief Return true if the object at \a index in the \a list -th list is
+   * picked.
+   */
+  bool IsPicked(std::size_t list, std::size_t index) const {
+    std::size_t bit = listsFirstBit[list] + index;
+    return (words[bit / 64] >> (bit % 64)) & 1;
+  }
+
+  /**
+   * \brief Mark the object at \a index in the \a list -th list as picked.
+   */
+  void Pick(std::size_t list, std::size_t index) {
+    std::size_t bit = listsFirstBit[list] + index;
+    words[bit / 64] |= (std::uint64_t)1 << (bit % 64);
+  }
+
+  /**
+   * \brief Remove from the lists, in place, the objects that are not picked.
+   *
+   * \param objectsLists The lists passed to Reset.
+   * \param skipTrimmedLists If true, lists with a size different from the one
+   * they had when Reset was called are not changed, as they were already
+   * trimmed (the same list can be present twice in the lists used by
+   * TwoObjectListsTest).
+   */
+  void Trim(const RuntimeObjectsLists &objectsLists,
+            bool skipTrimmedLists) const;
+
+ private:
+  std::vector<std::uint64_t> words;
+  std::vector<std::size_t> listsFirstBit;
+  std::vector<std::size_t> listsSize;
+};
+
+/**
+ * \brief Memory used by TwoObjectListsTest, kept between calls so that
+ * evaluating a condition does not allocate memory.
+ *
+ * Get one with ObjectsPickingScratch::Scope: scratches are owned by a pool
+ * (one per thread, as events of scenes are run by a single thread), so that a
+ * predicate can itself use a scratch without overwriting the one in use.
+ *
+ * \ingroup GameEngine
+ */
+class GD_API ObjectsPickingScratch {
+ public:
+  /**
+   * \brief Gives access to a scratch of the pool for its lifetime.
+   */
+  class GD_API Scope {
+   public:
+    Scope();
+    ~Scope();
+
+    ObjectsPickingScratch &operator*() const { return scratch; }
+    ObjectsPickingScratch *operator->() const { return &scratch; }
+
+   private:
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+    ObjectsPickingScratch &scratch;
+  };
+
+  PickedObjectsFlags picked1;  ///< Flags of the first lists.
+  PickedObjectsFlags picked2;  ///< Flags of the second lists.
+  std::vector<sf::FloatRect> bounds2;  ///< Bounds of the objects of the
+                                       ///< second lists.
+  std::vector<std::pair<std::size_t, std::size_t> >
+      positions2;  ///< List and index of the objects of the second lists.
+  std::vector<const std::vector<RuntimeObject *> *>
+      lists2;           ///< The second lists.
+  RectanglesGrid grid;  ///< The grid containing bounds2.
+};
+
 /**
  * \brief Filter objects to keep only the one that fullfil the predicate
  *
@@ -43,46 +138,22 @@ bool PickObjectsIf(const RuntimeObjectsLists &pickedObjectsLists,
                    Pred predicate) {
   bool isTrue = false;
 
-  // Create a boolean for each object
-  std::vector<std::vector<bool> > pickedList;
+  // Pick objects which are fulfulling the predicate, moving them to the
+  // beginning of the list (the predicate is only called on objects not yet
+  // moved).
   for (RuntimeObjectsLists::const_iterator it = pickedObjectsLists.begin();
        it != pickedObjectsLists.end();
        ++it) {
-    std::vector<bool> arr;
-    arr.assign(it->second->size(), false);
-    pickedList.push_back(arr);
-  }
-
-  // Pick objects which are fulfulling the predicate.
-  std::size_t i = 0;
-  for (RuntimeObjectsLists::const_iterator it = pickedObjectsLists.begin();
-       it != pickedObjectsLists.end();
-       ++it, ++i) {
-    if (!it->second) continue;
-    const std::vector<RuntimeObject *> &arr1 = *it->second;
-
-    for (std::size_t k = 0; k < arr1.size(); ++k) {
-      if (negatePredicate ^ predicate(arr1[k])) {
-        pickedList[i][k] = true;
-        isTrue = true;
-      }
-    }
-  }
-
-  // Trim not picked objects from lists.
-  i = 0;
-  for (RuntimeObjectsLists::const_iterator it = pickedObjectsLists.begin();
-       it != pickedObjectsLists.end();
-       ++it, ++i) {
-    size_t finalSize = 0;
     if (!it->second) continue;
     std::vector<RuntimeObject *> &arr = *it->second;
 
+    std::size_t finalSize = 0;
     for (std::size_t k = 0; k < arr.size(); ++k) {
       RuntimeObject *obj = arr[k];
-      if (pickedList[i][k]) {
+      if (negatePredicate ^ predicate(obj)) {
         arr[finalSize] = obj;
         finalSize++;
+        isTrue = true;
       }
     }
     arr.resize(finalSize);
@@ -120,30 +191,18 @@ bool PickObjectsIf(const RuntimeObjectsLists &pickedObjectsLists,
  * \ingroup GameEngine
  */
 template <typename Pred>
-bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
-                        RuntimeObjectsLists objectsLists2,
+bool TwoObjectListsTest(const RuntimeObjectsLists &objectsLists1,
+                        const RuntimeObjectsLists &objectsLists2,
                         bool negatePredicate,
                         Pred predicate) {
   bool isTrue = false;
 
-  // Create a boolean for each object
-  std::vector<std::vector<bool> > pickedList1;
-  std::vector<std::vector<bool> > pickedList2;
-
-  for (RuntimeObjectsLists::const_iterator it = objectsLists1.begin();
-       it != objectsLists1.end();
-       ++it) {
-    std::vector<bool> arr;
-    arr.assign(it->second->size(), false);
-    pickedList1.push_back(arr);
-  }
-  for (RuntimeObjectsLists::const_iterator it = objectsLists2.begin();
-       it != objectsLists2.end();
-       ++it) {
-    std::vector<bool> arr;
-    arr.assign(it->second->size(), false);
-    pickedList2.push_back(arr);
-  }
+  // Create a flag for each object
+  ObjectsPickingScratch::Scope scratch;
+  PickedObjectsFlags &picked1 = scratch->picked1;
+  PickedObjectsFlags &picked2 = scratch->picked2;
+  picked1.Reset(objectsLists1);
+  picked2.Reset(objectsLists2);
 
   // Launch the function each object of the first list with each object
   // of the second list.
@@ -165,7 +224,7 @@ bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
         const std::vector<RuntimeObject *> &arr2 = *it2->second;
 
         for (std::size_t l = 0; l < arr2.size(); ++l) {
-          if (pickedList1[i][k] && pickedList2[j][l])
+          if (picked1.IsPicked(i, k) && picked2.IsPicked(j, l))
             continue;  // Avoid unnecessary costly call to functor.
 
           if (std::addressof(arr1[k]) != std::addressof(arr2[l]) &&
@@ -174,8 +233,8 @@ bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
               isTrue = true;
 
               // Pick the objects
-              pickedList1[i][k] = true;
-              pickedList2[j][l] = true;
+              picked1.Pick(i, k);
+              picked2.Pick(j, l);
             }
 
             atLeastOneObject = true;
@@ -186,57 +245,116 @@ bool TwoObjectListsTest(RuntimeObjectsLists objectsLists1,
       if (!atLeastOneObject &&
           negatePredicate) {  // The object is not overlapping any other object.
         isTrue = true;
-        pickedList1[i][k] = true;
+        picked1.Pick(i, k);
       }
     }
   }
 
-  // Trim not picked objects from lists.
-  i = 0;
+  picked1.Trim(objectsLists1, false);
+  if (!negatePredicate) picked2.Trim(objectsLists2, true);
+
+  return isTrue;
+}
+
+/**
+ * \brief Picks objects that fullfil the predicate with at least another object,
+ * testing only the pairs of objects with intersecting bounds.
+ *
+ * This is the same as TwoObjectListsTest, but the predicate must be false for
+ * objects with non intersecting bounds, as returned by \a getBounds (a function
+ * taking a RuntimeObject* and returning a sf::FloatRect). The bounds of the
+ * objects of the second lists are stored in a RectanglesGrid so that the
+ * predicate is only called for nearby objects: the cost is roughly
+ * proportional to NbObjList1+NbObjList2 instead of NbObjList1*NbObjList2.
+ *
+ * \ingroup GameEngine
+ */
+template <typename Bounds, typename Pred>
+bool TwoObjectListsTest(const RuntimeObjectsLists &objectsLists1,
+                        const RuntimeObjectsLists &objectsLists2,
+                        bool negatePredicate,
+                        Bounds getBounds,
+                        Pred predicate) {
+  bool isTrue = false;
+
+  // Create a flag for each object
+  ObjectsPickingScratch::Scope scratch;
+  PickedObjectsFlags &picked1 = scratch->picked1;
+  PickedObjectsFlags &picked2 = scratch->picked2;
+  picked1.Reset(objectsLists1);
+  picked2.Reset(objectsLists2);
+
+  // Store the bounds of the objects of the second lists in a grid, remembering
+  // the position of each object in the lists.
+  std::vector<sf::FloatRect> &bounds2 = scratch->bounds2;
+  std::vector<std::pair<std::size_t, std::size_t> > &positions2 =
+      scratch->positions2;
+  std::vector<const std::vector<RuntimeObject *> *> &lists2 = scratch->lists2;
+  bounds2.clear();
+  positions2.clear();
+  lists2.clear();
+  std::size_t j = 0;
+  for (RuntimeObjectsLists::const_iterator it2 = objectsLists2.begin();
+       it2 != objectsLists2.end();
+       ++it2, ++j) {
+    lists2.push_back(it2->second);
+    if (!it2->second) continue;
+
+    const std::vector<RuntimeObject *> &arr2 = *it2->second;
+    for (std::size_t l = 0; l < arr2.size(); ++l) {
+      bounds2.push_back(getBounds(arr2[l]));
+      positions2.push_back(std::make_pair(j, l));
+    }
+  }
+
+  RectanglesGrid &grid = scratch->grid;
+  grid.Build(bounds2);
+
+  // Launch the function each object of the first list with each object
+  // of the second list having intersecting bounds.
+  std::size_t i = 0;
   for (RuntimeObjectsLists::const_iterator it = objectsLists1.begin();
        it != objectsLists1.end();
        ++it, ++i) {
-    size_t finalSize = 0;
     if (!it->second) continue;
-    std::vector<RuntimeObject *> &arr = *it->second;
+    const std::vector<RuntimeObject *> &arr1 = *it->second;
 
-    for (std::size_t k = 0; k < arr.size(); ++k) {
-      RuntimeObject *obj = arr[k];
-      if (pickedList1[i][k]) {
-        arr[finalSize] = obj;
-        finalSize++;
-      }
-    }
-    arr.resize(finalSize);
-  }
+    for (std::size_t k = 0; k < arr1.size(); ++k) {
+      bool atLeastOneObject = false;
 
-  if (!negatePredicate) {
-    std::size_t i = 0;
-    for (RuntimeObjectsLists::const_iterator it = objectsLists2.begin();
-         it != objectsLists2.end();
-         ++it, ++i) {
-      size_t finalSize = 0;
-      if (!it->second) continue;
-      std::vector<RuntimeObject *> &arr = *it->second;
-
-      //*This is important*! We can have a list that has already been trimmed
-      // just before
-      if (arr.size() !=
-          pickedList2[i].size())  // If the size of the objects list != size of
-                                  // the boolean "picked" list...
-        continue;  //... then the object list was already trimmed, skip it.
-
-      for (std::size_t k = 0; k < arr.size(); ++k) {
-        RuntimeObject *obj = arr[k];
-        if (pickedList2[i][k]) {
-          arr[finalSize] = obj;
-          finalSize++;
-        }
+      grid.ForEachIntersectingRectangle(
+          getBounds(arr1[k]), [&](std::size_t index) {
+            std::size_t j = positions2[index].first;
+            std::size_t l = positions2[index].second;
+            if (picked1.IsPicked(i, k) && picked2.IsPicked(j, l))
+              return;  // Avoid unnecessary costly call to functor.
+
+            const std::vector<RuntimeObject *> &arr2 = *lists2[j];
+            if (std::addressof(arr1[k]) != std::addressof(arr2[l]) &&
+                predicate(arr1[k], arr2[l])) {
+              if (!negatePredicate) {
+                isTrue = true;
+
+                // Pick the objects
+                picked1.Pick(i, k);
+                picked2.Pick(j, l);
+              }
+
+              atLeastOneObject = true;
+            }
+          });
+
+      if (!atLeastOneObject &&
+          negatePredicate) {  // The object is not overlapping any other object.
+        isTrue = true;
+        picked1.Pick(i, k);
       }
-      arr.resize(finalSize);
     }
   }
 
+  picked1.Trim(objectsLists1, false);
+  if (!negatePredicate) picked2.Trim(objectsLists2, true);
+
   return isTrue;
 }
 #endif
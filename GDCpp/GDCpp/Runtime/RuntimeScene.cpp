@@ -10,6 +10,7 @@
 #include <fstream>
 #include <iomanip>
 #include <sstream>
+#include <unordered_map>
 
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
@@ -57,6 +58,9 @@ RuntimeScene::RuntimeScene(sf::RenderWindow* renderWindow_, RuntimeGame* game_)
 #endif
       isFullScreen(false),
       inputManager(renderWindow_),
+      renderQueueObjectsGeneration(0),
+      renderQueueLayersGeneration(0),
+      renderQueueZOrdersGeneration(0),
       codeExecutionEngine(new CodeExecutionEngine) {
   ChangeRenderWindow(renderWindow);
 }
@@ -201,9 +205,9 @@ void RuntimeScene::Render() {
                                 GetBackgroundColorGreen(),
                                 GetBackgroundColorBlue()));
 
-  // Sort object by order to render them
-  RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
-  OrderObjectsByZOrder(allObjects);
+  // Get the objects of each layer, sorted by Z order
+  UpdateRenderQueue();
+  spriteBatch.ResetStatistics();
 
 #if !defined(ANDROID)  // TODO: OpenGL
   // To allow using OpenGL to draw:
@@ -219,6 +223,7 @@ void RuntimeScene::Render() {
            cameraIndex < layers[layerIndex].GetCameraCount();
            ++cameraIndex) {
         RuntimeCamera& camera = layers[layerIndex].GetCamera(cameraIndex);
+        const sf::View& view = camera.GetSFMLView();
 
 // Prepare OpenGL rendering
 #if !defined(ANDROID)  // TODO: OpenGL
@@ -232,7 +237,7 @@ void RuntimeScene::Render() {
                                    GetOpenGLZFar());
 #endif
 
-        const sf::FloatRect& viewport = camera.GetSFMLView().getViewport();
+        const sf::FloatRect& viewport = view.getViewport();
 
 #if !defined(ANDROID)  // TODO: OpenGL
         glViewport(viewport.left * renderWindow->getSize().x,
@@ -246,13 +251,35 @@ void RuntimeScene::Render() {
 #endif
 
         // Prepare SFML rendering
-        renderWindow->setView(camera.GetSFMLView());
-
-        // Rendering all objects
-        for (std::size_t id = 0; id < allObjects.size(); ++id) {
-          if (allObjects[id]->GetLayer() == layers[layerIndex].GetName())
-            allObjects[id]->Draw(*renderWindow);
+        renderWindow->setView(view);
+        spriteBatch.Begin(*renderWindow);
+
+        // The area seen by the camera, to skip objects outside of it
+        sf::Transform viewTransform;
+        viewTransform.translate(view.getCenter().x, view.getCenter().y);
+        viewTransform.rotate(view.getRotation());
+        sf::FloatRect visibleArea =
+            viewTransform.transformRect(sf::FloatRect(-view.getSize().x / 2,
+                                                      -view.getSize().y / 2,
+                                                      view.getSize().x,
+                                                      view.getSize().y));
+
+        // Rendering all objects of the layer
+        const RuntimeObjNonOwningPtrList& layerObjects =
+            renderQueue[layerIndex];
+        for (std::size_t id = 0; id < layerObjects.size(); ++id) {
+          RuntimeObject* object = layerObjects[id];
+          if (object->IsDrawnInsideAABB()) {
+            sf::FloatRect aabb = object->GetAABB();
+            if (aabb.width > 0 && aabb.height > 0 &&
+                !visibleArea.intersects(aabb))
+              continue;
+          }
+
+          object->DrawInBatch(spriteBatch);
         }
+
+        spriteBatch.End();
       }
     }
   }
@@ -265,6 +292,47 @@ void RuntimeScene::Render() {
   renderWindow->display();
 }
 
+void RuntimeScene::UpdateRenderQueue() {
+  if (renderQueue.size() != layers.size() ||
+      renderQueueObjectsGeneration != objectsInstances.GetGeneration() ||
+      renderQueueLayersGeneration != RuntimeObject::GetLayersGeneration()) {
+    // Classify all objects according to their layer
+    std::unordered_map<gd::String, std::size_t> layersIndexes;
+    for (std::size_t i = 0; i < layers.size(); ++i)
+      layersIndexes.emplace(layers[i].GetName(), i);
+
+    renderQueue.resize(layers.size());
+    for (auto& layerObjects : renderQueue) layerObjects.clear();
+
+    RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
+    for (RuntimeObject* object : allObjects) {
+      auto it = layersIndexes.find(object->GetLayer());
+      if (it != layersIndexes.end()) renderQueue[it->second].push_back(object);
+    }
+
+    for (auto& layerObjects : renderQueue) OrderObjectsByZOrder(layerObjects);
+  } else if (renderQueueZOrdersGeneration !=
+             RuntimeObject::GetZOrdersGeneration()) {
+    // Only Z orders changed: use an insertion sort, which is fast on lists
+    // that are almost sorted and keeps the order of objects with the same Z
+    // order.
+    for (auto& layerObjects : renderQueue) {
+      for (std::size_t i = 1; i < layerObjects.size(); ++i) {
+        RuntimeObject* object = layerObjects[i];
+        std::size_t j = i;
+        for (; j > 0 && layerObjects[j - 1]->GetZOrder() > object->GetZOrder();
+             --j)
+          layerObjects[j] = layerObjects[j - 1];
+        layerObjects[j] = object;
+      }
+    }
+  }
+
+  renderQueueObjectsGeneration = objectsInstances.GetGeneration();
+  renderQueueLayersGeneration = RuntimeObject::GetLayersGeneration();
+  renderQueueZOrdersGeneration = RuntimeObject::GetZOrdersGeneration();
+}
+
 bool RuntimeScene::OrderObjectsByZOrder(RuntimeObjNonOwningPtrList& objList) {
   if (StandardSortMethod())
     std::sort(objList.begin(),
@@ -300,23 +368,23 @@ const RuntimeLayer& RuntimeScene::GetRuntimeLayer(
 }
 
 void RuntimeScene::ManageObjectsAfterEvents() {
-  // Delete objects that were removed.
-  RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
-  for (std::size_t id = 0; id < allObjects.size(); ++id) {
-    if (allObjects[id]->GetName().empty()) {
+  // Delete objects that were removed (their name was made empty, so they are
+  // in the list of objects without name), all at once.
+  RuntimeObjNonOwningPtrList deletedObjects =
+      objectsInstances.GetObjectsRawPointers("");
+  if (!deletedObjects.empty()) {
+    for (RuntimeObject* object : deletedObjects) {
       for (std::size_t i = 0; i < extensionsToBeNotifiedOnObjectDeletion.size();
            ++i)
         extensionsToBeNotifiedOnObjectDeletion[i]->ObjectDeletedFromScene(
-            *this, allObjects[id]);
-
-      objectsInstances.RemoveObject(
-          allObjects[id]);  // Remove from objects instances, not from the
-                            // temporary list!
+            *this, object);
     }
+
+    objectsInstances.RemoveObjects("");
   }
 
   // Update objects positions, forces and behaviors
-  allObjects = objectsInstances.GetAllObjects();
+  RuntimeObjNonOwningPtrList allObjects = objectsInstances.GetAllObjects();
   for (RuntimeObject* object : allObjects) {
     double elapsedTimeInSeconds =
         static_cast<double>(object->GetElapsedTime(*this)) / 1000000.0;
@@ -436,6 +504,7 @@ bool RuntimeScene::LoadFromSceneAndCustomInstances(
   // Initialize layers
   std::cout << ".";
   layers.clear();
+  renderQueue.clear();
   sf::View defaultView(sf::FloatRect(0.0f,
                                      0.0f,
                                      game->GetGameResolutionWidth(),
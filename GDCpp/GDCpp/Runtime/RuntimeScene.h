@@ -17,6 +17,7 @@
 #include "GDCpp/Runtime/Project/Layout.h"
 #include "GDCpp/Runtime/RuntimeLayer.h"
 #include "GDCpp/Runtime/RuntimeVariablesContainer.h"
+#include "GDCpp/Runtime/SpriteBatch.h"
 #include "GDCpp/Runtime/TimeManager.h"
 namespace sf {
 class RenderWindow;
@@ -112,6 +113,12 @@ class GD_API RuntimeScene : public Scene {
    */
   const RuntimeLayer& GetRuntimeLayer(const gd::String& name) const;
 
+  /**
+   * \brief Get the batch used to draw the objects, to know how many draw calls
+   * were made during the last frame.
+   */
+  const SpriteBatch& GetSpriteBatch() const { return spriteBatch; }
+
   /**
    * \brief Return the shared data for a behavior.
    * \warning Be careful, no check is made to ensure that the shared data exist.
@@ -227,6 +234,15 @@ class GD_API RuntimeScene : public Scene {
    */
   bool OrderObjectsByZOrder(RuntimeObjNonOwningPtrList& objList);
 
+  /**
+   * \brief Update the lists of objects to be rendered on each layer.
+   *
+   * The lists are built again only when objects were added or removed or when
+   * the layer of an object changed. When only Z orders changed, the lists are
+   * sorted again, which is fast as they are almost sorted.
+   */
+  void UpdateRenderQueue();
+
   /**
    * \brief Render a frame in the window
    */
@@ -265,6 +281,18 @@ class GD_API RuntimeScene : public Scene {
       behaviorsSharedDatas;  ///< Contains all behaviors shared datas.
   std::vector<RuntimeLayer>
       layers;  ///< The layers used at runtime to display the scene.
+  std::vector<RuntimeObjNonOwningPtrList>
+      renderQueue;  ///< For each layer, the objects to be rendered, sorted by
+                    ///< Z order. See UpdateRenderQueue.
+  std::size_t renderQueueObjectsGeneration;  ///< The generation of
+                                             ///< objectsInstances when
+                                             ///< renderQueue was built.
+  std::size_t renderQueueLayersGeneration;   ///< See
+                                             ///< RuntimeObject::GetLayersGeneration
+  std::size_t renderQueueZOrdersGeneration;  ///< See
+                                             ///< RuntimeObject::GetZOrdersGeneration
+  SpriteBatch spriteBatch;  ///< Used to draw together the sprites of objects
+                            ///< sharing a texture.
   std::shared_ptr<CodeExecutionEngine> codeExecutionEngine;
   SceneChange
       requestedChange;  ///< What should be done at the end of the frame.
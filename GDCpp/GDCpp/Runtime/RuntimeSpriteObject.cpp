@@ -17,6 +17,7 @@
 #include "GDCpp/Runtime/Project/Project.h"
 #include "GDCpp/Runtime/RuntimeLayer.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/SpriteBatch.h"
 #include "GDCpp/Runtime/TinyXml/tinyxml.h"
 #if defined(GD_IDE_ONLY)
 #include "GDCore/IDE/Project/ArbitraryResourceWorker.h"
@@ -31,6 +32,16 @@
 gd::Animation RuntimeSpriteObject::badAnimation;
 gd::Sprite* RuntimeSpriteObject::badSpriteDatas = NULL;
 
+namespace {
+sf::BlendMode GetSFMLBlendMode(unsigned int blendMode) {
+  return blendMode == 0
+             ? sf::BlendAlpha
+             : (blendMode == 1
+                    ? sf::BlendAdd
+                    : (blendMode == 2 ? sf::BlendMultiply : sf::BlendNone));
+}
+}  // namespace
+
 RuntimeSpriteObject::RuntimeSpriteObject(RuntimeScene& scene,
                                          const gd::SpriteObject& spriteObject)
     : RuntimeObject(scene, spriteObject),
@@ -85,14 +96,17 @@ bool RuntimeSpriteObject::Draw(sf::RenderTarget& renderTarget) {
   // Don't draw anything if hidden
   if (hidden) return true;
 
-  renderTarget.draw(
-      GetCurrentSFMLSprite(),
-      sf::RenderStates(
-          blendMode == 0
-              ? sf::BlendAlpha
-              : (blendMode == 1
-                     ? sf::BlendAdd
-                     : (blendMode == 2 ? sf::BlendMultiply : sf::BlendNone))));
+  renderTarget.draw(GetCurrentSFMLSprite(),
+                    sf::RenderStates(GetSFMLBlendMode(blendMode)));
+
+  return true;
+}
+
+bool RuntimeSpriteObject::DrawInBatch(SpriteBatch& batch) {
+  // Don't draw anything if hidden
+  if (hidden) return true;
+
+  batch.Draw(GetCurrentSFMLSprite(), GetSFMLBlendMode(blendMode));
 
   return true;
 }
@@ -222,6 +236,7 @@ void RuntimeSpriteObject::CopyImageOnImageOfCurrentSprite(
                    sf::IntRect(0, 0, 0, 0),
                    useTransparency);
   dest->texture.loadFromImage(dest->image);
+  dest->InvalidateAlphaMasks();
 }
 
 void RuntimeSpriteObject::MakeColorTransparent(const gd::String& colorStr) {
@@ -242,6 +257,7 @@ void RuntimeSpriteObject::MakeColorTransparent(const gd::String& colorStr) {
   dest->image.createMaskFromColor(
       sf::Color(colors[0].To<int>(), colors[1].To<int>(), colors[2].To<int>()));
   dest->texture.loadFromImage(dest->image);
+  dest->InvalidateAlphaMasks();
 }
 
 void RuntimeSpriteObject::SetColor(const gd::String& colorStr) {
@@ -304,6 +320,7 @@ void RuntimeSpriteObject::UpdateCurrentSprite() const {
       sf::Color(colorR, colorV, colorB, opacity));
 
   needUpdateCurrentSprite = false;
+  InvalidateHitBoxes();
 }
 
 void RuntimeSpriteObject::Update(const RuntimeScene& scene) {
@@ -59,6 +59,7 @@ class GD_API RuntimeSpriteObject : public RuntimeObject {
       const gd::InitialInstance& position);
 
   virtual bool Draw(sf::RenderTarget& renderTarget);
+  virtual bool DrawInBatch(SpriteBatch& batch);
 
 #if defined(GD_IDE_ONLY)
   virtual void GetPropertyForDebugger(std::size_t propertyNb,
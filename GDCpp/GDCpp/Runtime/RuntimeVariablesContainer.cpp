@@ -9,6 +9,7 @@
 #include "GDCore/Project/Variable.h"
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/TinyXml/tinyxml.h"
+#include "GDCore/Tools/MakeUnique.h"
 
 BadVariable RuntimeVariablesContainer::badVariable;
 BadRuntimeVariablesContainer RuntimeVariablesContainer::badVariablesContainer;
@@ -18,6 +19,30 @@ RuntimeVariablesContainer::RuntimeVariablesContainer(
   Merge(container);
 }
 
+RuntimeVariablesContainer::RuntimeVariablesContainer(
+    const RuntimeVariablesContainer& other) {
+  Init(other);
+}
+
+RuntimeVariablesContainer& RuntimeVariablesContainer::operator=(
+    const RuntimeVariablesContainer& other) {
+  if (this != &other) {
+    Clear();
+    Init(other);
+  }
+
+  return *this;
+}
+
+void RuntimeVariablesContainer::Init(const RuntimeVariablesContainer& other) {
+  std::unordered_map<const gd::Variable*, gd::Variable*> copiedVariables;
+  for (auto& it : other.variables)
+    copiedVariables[it.second] = &Add(it.first, *it.second);
+
+  for (auto* variable : other.variablesArray)
+    variablesArray.push_back(copiedVariables[variable]);
+}
+
 RuntimeVariablesContainer& RuntimeVariablesContainer::operator=(
     const gd::VariablesContainer& container) {
   Clear();
@@ -28,11 +53,15 @@ RuntimeVariablesContainer& RuntimeVariablesContainer::operator=(
 
 void RuntimeVariablesContainer::Clear() {
   variablesArray.clear();
-  for (std::map<gd::String, gd::Variable*>::iterator it = variables.begin();
-       it != variables.end();
-       ++it)
-    delete it->second;
   variables.clear();
+  ownedVariables.clear();
+}
+
+gd::Variable& RuntimeVariablesContainer::Add(
+    const gd::String& name, const gd::Variable& variable) const {
+  ownedVariables.push_back(gd::make_unique<gd::Variable>(variable));
+  variables[name] = ownedVariables.back().get();
+  return *ownedVariables.back();
 }
 
 void RuntimeVariablesContainer::Merge(const gd::VariablesContainer& container) {
@@ -40,37 +69,35 @@ void RuntimeVariablesContainer::Merge(const gd::VariablesContainer& container) {
     const gd::String& name = container.GetNameAt(i);
     const gd::Variable& variable = container.Get(i);
 
-    if (Has(name))
-      Get(name) = variable;
-    else {
-      gd::Variable* newVariable = new gd::Variable(variable);
-      variablesArray.push_back(newVariable);
-      variables[name] = newVariable;
-    }
+    auto var = variables.find(name);
+    if (var != variables.end())
+      *var->second = variable;
+    else
+      variablesArray.push_back(&Add(name, variable));
   }
 }
 
 gd::Variable& RuntimeVariablesContainer::Get(const gd::String& name) {
-  std::map<gd::String, gd::Variable*>::const_iterator var =
-      variables.find(name);
-
-  if (var != variables.end()) return *(var->second);
+  auto var = variables.find(name);
+  if (var != variables.end()) return *var->second;
 
-  gd::Variable* newVariable = new gd::Variable;
-  variables[name] = newVariable;
-  return *newVariable;
+  return Add(name, gd::Variable());
 }
 
 const gd::Variable& RuntimeVariablesContainer::Get(
     const gd::String& name) const {
-  std::map<gd::String, gd::Variable*>::const_iterator var =
-      variables.find(name);
+  auto var = variables.find(name);
+  if (var != variables.end()) return *var->second;
+
+  return Add(name, gd::Variable());
+}
 
-  if (var != variables.end()) return *(var->second);
+std::map<gd::String, gd::Variable*>
+RuntimeVariablesContainer::DumpAllVariables() {
+  std::map<gd::String, gd::Variable*> allVariables;
+  for (auto& it : variables) allVariables[it.first] = it.second;
 
-  gd::Variable* newVariable = new gd::Variable;
-  variables[name] = newVariable;
-  return *newVariable;
+  return allVariables;
 }
 
 gd::Variable& RuntimeVariablesContainer::GetBadVariable() {
@@ -7,7 +7,9 @@
 #ifndef RUNTIMEVARIABLESCONTAINER_H
 #define RUNTIMEVARIABLESCONTAINER_H
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "GDCore/Project/Variable.h"
 namespace gd {
@@ -21,6 +23,9 @@ class BadVariable;
  *
  * See gd::VariablesContainer for the container used for storage.
  *
+ * Variables are found by name using a hash table. Copying the container
+ * copies all the variables.
+ *
  * \see gd::VariablesContainer
  * \see RuntimeScene
  * \see RuntimeObject
@@ -42,6 +47,16 @@ class GD_API RuntimeVariablesContainer {
    */
   RuntimeVariablesContainer(){};
 
+  /**
+   * \brief Copy constructor: the variables are copied.
+   */
+  RuntimeVariablesContainer(const RuntimeVariablesContainer& other);
+
+  /**
+   * \brief Assignment operator: the variables are copied.
+   */
+  RuntimeVariablesContainer& operator=(const RuntimeVariablesContainer& other);
+
   /**
    * \brief Initialize a RuntimeVariablesContainer from a
    * gd::VariablesContainer.
@@ -128,9 +143,7 @@ class GD_API RuntimeVariablesContainer {
   /**
    * Get a map containing all variables.
    */
-  const std::map<gd::String, gd::Variable*>& DumpAllVariables() {
-    return variables;
-  };
+  std::map<gd::String, gd::Variable*> DumpAllVariables();
 
  private:
   /**
@@ -138,8 +151,22 @@ class GD_API RuntimeVariablesContainer {
    */
   void Clear();
 
-  std::vector<gd::Variable*> variablesArray;
-  mutable std::map<gd::String, gd::Variable*> variables;
+  /**
+   * \brief Copy the variables of another container.
+   */
+  void Init(const RuntimeVariablesContainer& other);
+
+  /**
+   * \brief Add a copy of the variable to the container, with the specified
+   * name.
+   */
+  gd::Variable& Add(const gd::String& name, const gd::Variable& variable) const;
+
+  mutable std::vector<std::unique_ptr<gd::Variable>>
+      ownedVariables;  ///< All the variables, owned by the container.
+  std::vector<gd::Variable*> variablesArray;  ///< Variables accessible thanks
+                                              ///< to their index.
+  mutable std::unordered_map<gd::String, gd::Variable*> variables;
   static BadVariable badVariable;
   static BadRuntimeVariablesContainer badVariablesContainer;
 };
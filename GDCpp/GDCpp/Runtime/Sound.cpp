@@ -13,16 +13,45 @@
 
 using namespace std;
 
-Sound::Sound(gd::String pFile) : file(pFile), volume(100) {
-  buffer = gd::ResourcesLoader::Get()->LoadSoundBuffer(file);
-  sound.setBuffer(buffer);
+Sound::Sound(gd::String pFile)
+    : buffer(std::make_shared<sf::SoundBuffer>(
+          gd::ResourcesLoader::Get()->LoadSoundBuffer(pFile))),
+      file(pFile),
+      volume(100) {
+  sound.setBuffer(*buffer);
 }
 
-Sound::Sound() : volume(100) { sound.setBuffer(buffer); }
+Sound::Sound(const gd::String& pFile,
+             std::shared_ptr<const sf::SoundBuffer> buffer_)
+    : buffer(buffer_), file(pFile), volume(100) {
+  sound.setBuffer(*buffer);
+}
+
+Sound::Sound()
+    : buffer(std::make_shared<sf::SoundBuffer>()), volume(100) {
+  sound.setBuffer(*buffer);
+}
+
+Sound::Sound(const Sound& copy)
+    : buffer(copy.buffer), file(copy.file), volume(100) {
+  if (buffer) sound.setBuffer(*buffer);
+}
+
+void Sound::SetBuffer(const gd::String& pFile,
+                      std::shared_ptr<const sf::SoundBuffer> buffer_) {
+  sound.stop();
+  if (buffer_ != buffer) {
+    sound.setBuffer(*buffer_);
+    buffer = buffer_;
+  }
+  file = pFile;
+}
 
-Sound::Sound(const Sound& copy) : file(copy.file) {
-  buffer = gd::ResourcesLoader::Get()->LoadSoundBuffer(file);
-  sound.setBuffer(buffer);
+void Sound::ReleaseBuffer() {
+  sound.stop();
+  sound.resetBuffer();
+  buffer.reset();
+  file.clear();
 }
 
 void Sound::SetVolume(float volume_, float globalVolume) {
@@ -6,6 +6,7 @@
 #ifndef SOUND_H
 #define SOUND_H
 #include <SFML/Audio.hpp>
+#include <memory>
 #include "GDCpp/Runtime/String.h"
 
 /**
@@ -18,9 +19,30 @@ class GD_API Sound : sf::NonCopyable {
  public:
   Sound();
   Sound(gd::String file);
+
+  /**
+   * \brief Create a sound playing an already loaded buffer.
+   */
+  Sound(const gd::String& file, std::shared_ptr<const sf::SoundBuffer> buffer);
   Sound(const Sound& copy);
   virtual ~Sound(){};
 
+  /**
+   * \brief Stop the sound and change the buffer it plays.
+   *
+   * Used by SoundManager to reuse sounds which are not playing anymore.
+   */
+  void SetBuffer(const gd::String& file,
+                 std::shared_ptr<const sf::SoundBuffer> buffer);
+
+  /**
+   * \brief Stop the sound and release the buffer it plays.
+   *
+   * Used by SoundManager so that sounds kept to be reused do not keep their
+   * buffer in memory.
+   */
+  void ReleaseBuffer();
+
   /**
    * \brief Get the sound status
    * \return sf::Music::Paused, sf::Music::Playing or sf::Music::Stopped.
@@ -64,7 +86,8 @@ class GD_API Sound : sf::NonCopyable {
   };
 
   // Order is important :
-  sf::SoundBuffer buffer;
+  std::shared_ptr<const sf::SoundBuffer>
+      buffer;  ///< The buffer played, which can be shared by other sounds.
   sf::Sound sound;
 
   gd::String file;
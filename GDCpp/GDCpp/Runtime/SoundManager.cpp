@@ -13,7 +13,32 @@
 #include "GDCpp/Runtime/Sound.h"
 #include "GDCpp/Runtime/String.h"
 
-SoundManager::SoundManager() : globalVolume(100), resourcesManager(nullptr) {}
+namespace {
+/**
+ * Number of sounds created when the first sound is played.
+ */
+const std::size_t initialFreeSoundsCount = 16;
+}  // namespace
+
+const std::size_t SoundManager::maxSoundsCount;
+
+SoundManager::SoundManager()
+    : nextStolenSound(0), globalVolume(100), resourcesManager(nullptr) {}
+
+std::shared_ptr<const sf::SoundBuffer> SoundManager::GetSoundBuffer(
+    const gd::String& file) {
+  auto it = soundBuffers.find(file);
+  if (it != soundBuffers.end()) {
+    std::shared_ptr<const sf::SoundBuffer> buffer = it->second.lock();
+    if (buffer) return buffer;
+  }
+
+  std::shared_ptr<const sf::SoundBuffer> buffer =
+      std::make_shared<sf::SoundBuffer>(
+          gd::ResourcesLoader::Get()->LoadSoundBuffer(file));
+  soundBuffers[file] = buffer;
+  return buffer;
+}
 
 const gd::String& SoundManager::GetFileFromSoundName(
     const gd::String& name) const {
@@ -27,8 +52,9 @@ void SoundManager::PlaySoundOnChannel(const gd::String& name,
                                       bool repeat,
                                       float volume,
                                       float pitch) {
+  const gd::String& file = GetFileFromSoundName(name);
   std::shared_ptr<Sound> sound =
-      std::make_shared<Sound>(GetFileFromSoundName(name));
+      std::make_shared<Sound>(file, GetSoundBuffer(file));
   sound->sound.play();
   sound->sound.setRelativeToListener(true);
 
@@ -42,8 +68,29 @@ void SoundManager::PlaySound(const gd::String& name,
                              bool repeat,
                              float volume,
                              float pitch) {
-  sounds.push_back(
-      std::shared_ptr<Sound>(new Sound(GetFileFromSoundName(name))));
+  const gd::String& file = GetFileFromSoundName(name);
+  std::shared_ptr<const sf::SoundBuffer> buffer = GetSoundBuffer(file);
+
+  if (freeSounds.empty() && sounds.empty()) {
+    sounds.reserve(maxSoundsCount);
+    freeSounds.reserve(maxSoundsCount);
+    for (std::size_t i = 0; i < initialFreeSoundsCount; ++i)
+      freeSounds.push_back(std::make_shared<Sound>());
+  }
+
+  if (!freeSounds.empty()) {
+    sounds.push_back(freeSounds.back());
+    freeSounds.pop_back();
+  } else if (sounds.size() < maxSoundsCount) {
+    sounds.push_back(std::make_shared<Sound>());
+  } else {
+    // Stop a sound being played, moving it to the end of the sounds.
+    nextStolenSound %= sounds.size();
+    std::swap(sounds[nextStolenSound], sounds.back());
+    nextStolenSound++;
+  }
+
+  sounds.back()->SetBuffer(file, buffer);
   sounds.back()->sound.play();
   sounds.back()->sound.setRelativeToListener(true);
 
@@ -108,10 +155,17 @@ void SoundManager::PlayMusicOnChannel(const gd::String& name,
 }
 
 void SoundManager::ManageGarbage() {
+  // Move stopped sounds to the free sounds, keeping the order of the others.
+  std::size_t playingSoundsCount = 0;
   for (std::size_t i = 0; i < sounds.size(); i++) {
-    if (sounds[i]->sound.getStatus() == sf::Sound::Stopped)
-      sounds.erase(sounds.begin() + i);
+    if (sounds[i]->sound.getStatus() != sf::Sound::Stopped)
+      sounds[playingSoundsCount++] = sounds[i];
+    else if (sounds[i].unique()) {
+      sounds[i]->ReleaseBuffer();
+      freeSounds.push_back(sounds[i]);
+    }
   }
+  sounds.resize(playingSoundsCount);
 
   for (std::size_t i = 0; i < musics.size(); i++) {
     if (musics[i]->GetStatus() == sf::Music::Stopped)
@@ -10,6 +10,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "GDCpp/Runtime/Music.h"
 #include "GDCpp/Runtime/Sound.h"
@@ -23,6 +24,11 @@ using namespace std;
 /**
  * \brief Manage sounds and musics played by games.
  *
+ * Sound buffers are shared by all the sounds playing the same file, and are
+ * kept in memory as long as a sound uses them. Sounds which are not playing
+ * anymore are not destroyed but kept, without their buffer, in a pool to be
+ * reused by PlaySound, so that playing a sound does not allocate memory.
+ *
  * \see Sound
  * \see Music
  *
@@ -40,6 +46,12 @@ class GD_API SoundManager {
     resourcesManager = resourcesManager_;
   }
 
+  /**
+   * \brief Get the buffer of a sound file, loading it if it is not used by
+   * any sound.
+   */
+  std::shared_ptr<const sf::SoundBuffer> GetSoundBuffer(const gd::String& file);
+
   vector<std::shared_ptr<Music> > musics;
   vector<std::shared_ptr<Sound> > sounds;
 
@@ -135,18 +147,32 @@ class GD_API SoundManager {
     soundsChannel.clear();
     sounds.clear();
     musics.clear();
+    freeSounds.clear();
   }
 
   /**
    * Ensure sounds and musics without channels and stopped are destroyed.
+   * Stopped sounds are kept to be reused by PlaySound.
    */
   void ManageGarbage();
 
+  /**
+   * \brief The maximum number of sounds played at the same time by PlaySound.
+   * When reached, playing a sound stops one of the sounds being played.
+   */
+  static const std::size_t maxSoundsCount = 200;
+
  private:
   const gd::String& GetFileFromSoundName(const gd::String& name) const;
 
   std::map<std::size_t, std::shared_ptr<Sound> > soundsChannel;
   std::map<std::size_t, std::shared_ptr<Music> > musicsChannel;
+  std::unordered_map<gd::String, std::weak_ptr<const sf::SoundBuffer> >
+      soundBuffers;  ///< The buffers of the files being used by sounds.
+  std::vector<std::shared_ptr<Sound> >
+      freeSounds;  ///< Sounds not played anymore, to be reused.
+  std::size_t nextStolenSound;  ///< The sound to stop when the maximum number
+                                ///< of sounds is reached.
 
   float globalVolume;
   gd::ResourcesManager* resourcesManager;
@@ -0,0 +1,99 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCpp/Runtime/SpriteBatch.h"
+
+SpriteBatch::SpriteBatch()
+    : renderTarget(nullptr),
+      vertices(sf::Triangles),
+      texture(nullptr),
+      shader(nullptr),
+      drawCallsCount(0),
+      batchesCount(0),
+      verticesCount(0) {}
+
+void SpriteBatch::Begin(sf::RenderTarget& renderTarget_) {
+  Flush();
+  renderTarget = &renderTarget_;
+}
+
+void SpriteBatch::End() {
+  Flush();
+  renderTarget = nullptr;
+}
+
+void SpriteBatch::Draw(const sf::Sprite& sprite,
+                       const sf::BlendMode& blendMode_,
+                       const sf::Shader* shader_) {
+  if (!renderTarget) return;
+
+  if (vertices.getVertexCount() != 0 &&
+      (sprite.getTexture() != texture || blendMode_ != blendMode ||
+       shader_ != shader))
+    Flush();
+
+  texture = sprite.getTexture();
+  blendMode = blendMode_;
+  shader = shader_;
+
+  // Add the two triangles of the sprite, like sf::Sprite would draw them.
+  const sf::IntRect& textureRect = sprite.getTextureRect();
+  const sf::FloatRect bounds = sprite.getLocalBounds();
+  const sf::Transform& transform = sprite.getTransform();
+  const sf::Color& color = sprite.getColor();
+
+  float left = static_cast<float>(textureRect.left);
+  float right = left + textureRect.width;
+  float top = static_cast<float>(textureRect.top);
+  float bottom = top + textureRect.height;
+
+  sf::Vertex topLeft(transform.transformPoint(0, 0),
+                     color,
+                     sf::Vector2f(left, top));
+  sf::Vertex bottomLeft(transform.transformPoint(0, bounds.height),
+                        color,
+                        sf::Vector2f(left, bottom));
+  sf::Vertex topRight(transform.transformPoint(bounds.width, 0),
+                      color,
+                      sf::Vector2f(right, top));
+  sf::Vertex bottomRight(transform.transformPoint(bounds.width, bounds.height),
+                         color,
+                         sf::Vector2f(right, bottom));
+
+  vertices.append(topLeft);
+  vertices.append(bottomLeft);
+  vertices.append(topRight);
+  vertices.append(topRight);
+  vertices.append(bottomLeft);
+  vertices.append(bottomRight);
+}
+
+void SpriteBatch::Draw(const sf::Drawable& drawable,
+                       const sf::RenderStates& states) {
+  if (!renderTarget) return;
+
+  Flush();
+  renderTarget->draw(drawable, states);
+  drawCallsCount++;
+}
+
+void SpriteBatch::Flush() {
+  if (!renderTarget || vertices.getVertexCount() == 0) return;
+
+  renderTarget->draw(
+      vertices,
+      sf::RenderStates(blendMode, sf::Transform(), texture, shader));
+  drawCallsCount++;
+  batchesCount++;
+  verticesCount += vertices.getVertexCount();
+
+  vertices.clear();
+}
+
+void SpriteBatch::ResetStatistics() {
+  drawCallsCount = 0;
+  batchesCount = 0;
+  verticesCount = 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef SPRITEBATCH_H
+#define SPRITEBATCH_H
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+
+/**
+ * \brief Gather the sprites drawn one after the other with the same texture,
+ * blend mode and shader, to draw them with a single call to the render target.
+ *
+ * Sprites are drawn in the order they are given: anything that can't be added
+ * to the current batch (a sprite using other render states, or another
+ * drawable) first flushes the batch.
+ *
+ * \see RuntimeObject::DrawInBatch
+ * \ingroup GameEngine
+ */
+class GD_API SpriteBatch {
+ public:
+  SpriteBatch();
+  virtual ~SpriteBatch(){};
+
+  /**
+   * \brief Start drawing on the specified render target.
+   *
+   * \note Statistics are not reset (see ResetStatistics).
+   */
+  void Begin(sf::RenderTarget& renderTarget);
+
+  /**
+   * \brief Draw the sprites of the current batch, if any, and stop drawing on
+   * the render target.
+   */
+  void End();
+
+  /**
+   * \brief Add a sprite to the batch.
+   *
+   * The batch is flushed before if the sprite uses other render states than
+   * the sprites of the batch.
+   */
+  void Draw(const sf::Sprite& sprite,
+            const sf::BlendMode& blendMode = sf::BlendAlpha,
+            const sf::Shader* shader = nullptr);
+
+  /**
+   * \brief Flush the batch and draw directly the drawable on the render target.
+   */
+  void Draw(const sf::Drawable& drawable,
+            const sf::RenderStates& states = sf::RenderStates::Default);
+
+  /**
+   * \brief Draw the sprites of the current batch, if any.
+   *
+   * Must be called before drawing directly on the render target (or before
+   * changing its view).
+   */
+  void Flush();
+
+  /**
+   * \brief Return the render target being drawn on.
+   *
+   * \warning Only valid between Begin and End.
+   */
+  sf::RenderTarget& GetRenderTarget() { return *renderTarget; }
+
+  /**
+   * \brief Return the number of calls made to the render target since the
+   * statistics were reset.
+   */
+  std::size_t GetDrawCallsCount() const { return drawCallsCount; }
+
+  /**
+   * \brief Return the number of batches of sprites drawn since the statistics
+   * were reset.
+   */
+  std::size_t GetBatchesCount() const { return batchesCount; }
+
+  /**
+   * \brief Return the number of vertices drawn in batches since the statistics
+   * were reset.
+   */
+  std::size_t GetVerticesCount() const { return verticesCount; }
+
+  /**
+   * \brief Reset the number of draw calls, batches and vertices.
+   */
+  void ResetStatistics();
+
+ private:
+  sf::RenderTarget* renderTarget;  ///< The target being drawn on, if any.
+  sf::VertexArray vertices;  ///< The triangles of the sprites of the batch.
+  const sf::Texture* texture;  ///< The texture of the sprites of the batch.
+  sf::BlendMode blendMode;     ///< The blend mode of the sprites of the batch.
+  const sf::Shader* shader;    ///< The shader of the sprites of the batch.
+
+  std::size_t drawCallsCount;
+  std::size_t batchesCount;
+  std::size_t verticesCount;
+};
+
+#endif  // SPRITEBATCH_H
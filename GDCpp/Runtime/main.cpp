@@ -125,15 +125,25 @@ int main( int argc, char *p_argv[] )
         delete [] obuffer;
 
         cout << "Loading game data..." << endl;
-        TiXmlDocument doc;
-        if ( !doc.Parse(uncryptedSrc.c_str()) )
+        gd::SerializerElement rootElement;
+        if ( gd::Serializer::IsBinary(uncryptedSrc.data(), uncryptedSrc.size()) )
         {
-            return DisplayMessage("Unable to parse game data. Aborting.");
+            //Game data can be exported in the binary format, which is faster to load.
+            rootElement = gd::Serializer::FromBinary(uncryptedSrc);
+            if ( rootElement.IsValueUndefined() && rootElement.GetAllChildren().empty() )
+                return DisplayMessage("Unable to read game data. Aborting.");
+        }
+        else
+        {
+            TiXmlDocument doc;
+            if ( !doc.Parse(uncryptedSrc.c_str()) )
+            {
+                return DisplayMessage("Unable to parse game data. Aborting.");
+            }
+
+            TiXmlHandle hdl(&doc);
+            gd::Serializer::FromXML(rootElement, hdl.FirstChildElement().Element());
         }
-
-        TiXmlHandle hdl(&doc);
-        gd::SerializerElement rootElement;
-        gd::Serializer::FromXML(rootElement, hdl.FirstChildElement().Element());
         game.UnserializeFrom(rootElement);
 	}
 
@@ -0,0 +1,151 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering pixel perfect collisions.
+ */
+#include "GDCpp/Runtime/Collisions.h"
+#include <SFML/Graphics.hpp>
+#include "GDCore/Project/ImageManager.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * Create an image with an opaque disc, with a transparent hole in its center.
+ */
+sf::Image CreateRingImage(unsigned int width, unsigned int height) {
+  sf::Image image;
+  image.create(width, height, sf::Color(255, 255, 255, 0));
+  float radius = std::min(width, height) / 2.0f;
+  for (unsigned int x = 0; x < width; ++x) {
+    for (unsigned int y = 0; y < height; ++y) {
+      float dx = x + 0.5f - width / 2.0f;
+      float dy = y + 0.5f - height / 2.0f;
+      float distance = sqrt(dx * dx + dy * dy);
+      if (distance < radius && distance > radius / 2)
+        image.setPixel(x, y, sf::Color(255, 255, 255, 128));
+    }
+  }
+
+  return image;
+}
+
+/**
+ * The pixel perfect test as done before alpha masks, testing each pixel
+ * of the images.
+ */
+bool ReferencePixelPerfectTest(const sf::Sprite& object1,
+                               const sf::Sprite& object2,
+                               sf::Uint8 alphaLimit,
+                               const sf::Image& image1,
+                               const sf::Image& image2) {
+  sf::FloatRect intersection;
+  if (!object1.getGlobalBounds().intersects(object2.getGlobalBounds(),
+                                            intersection))
+    return false;
+
+  for (int i = intersection.left; i < intersection.left + intersection.width;
+       i++) {
+    for (int j = intersection.top; j < intersection.top + intersection.height;
+         j++) {
+      sf::Vector2f o1v = object1.getInverseTransform().transformPoint(i, j);
+      sf::Vector2f o2v = object2.getInverseTransform().transformPoint(i, j);
+      if (o1v.x > 0 && o1v.y > 0 && o2v.x > 0 && o2v.y > 0 &&
+          o1v.x < image1.getSize().x && o1v.y < image1.getSize().y &&
+          o2v.x < image2.getSize().x && o2v.y < image2.getSize().y &&
+          image1.getPixel(o1v.x, o1v.y).a > alphaLimit &&
+          image2.getPixel(o2v.x, o2v.y).a > alphaLimit)
+        return true;
+    }
+  }
+
+  return false;
+}
+}  // namespace
+
+TEST_CASE("Collisions", "[game-engine]") {
+  SECTION("AlphaMask") {
+    sf::Image image = CreateRingImage(100, 70);
+    image.setPixel(99, 0, sf::Color(255, 255, 255, 255));
+    AlphaMask mask(image, 1);
+    REQUIRE(mask.GetWidth() == 100);
+    REQUIRE(mask.GetHeight() == 70);
+
+    for (unsigned int x = 0; x < 100; ++x)
+      for (unsigned int y = 0; y < 70; ++y)
+        REQUIRE(mask.IsOpaque(x, y) == (image.getPixel(x, y).a > 1));
+
+    REQUIRE(AlphaMask(image, 128).IsOpaque(50, 5) == false);
+    REQUIRE(AlphaMask(image, 128).IsOpaque(99, 0) == true);
+
+    // Bits are read across words, and are not set after the end of the row.
+    sf::Image emptyImage;
+    emptyImage.create(100, 2, sf::Color(255, 255, 255, 0));
+    emptyImage.setPixel(99, 0, sf::Color(255, 255, 255, 255));
+    emptyImage.setPixel(0, 1, sf::Color(255, 255, 255, 255));
+    AlphaMask emptyMask(emptyImage, 1);
+    REQUIRE(emptyMask.GetBits(99, 0) == 1);
+    REQUIRE(emptyMask.GetBits(36, 0) == (std::uint64_t)1 << 63);
+    REQUIRE(emptyMask.GetBits(0, 0) == 0);
+    REQUIRE(emptyMask.GetBits(0, 1) == 1);
+  }
+
+  SECTION("SFMLTextureWrapper caches alpha masks") {
+    SFMLTextureWrapper texture;
+    texture.image = CreateRingImage(20, 20);
+    const AlphaMask& mask = texture.GetAlphaMask(1);
+    REQUIRE(&texture.GetAlphaMask(1) == &mask);
+    REQUIRE(texture.GetAlphaMask(200).IsOpaque(10, 2) == false);
+    REQUIRE(texture.GetAlphaMask(1).IsOpaque(10, 2) == true);
+
+    texture.image.create(20, 20, sf::Color(255, 255, 255, 0));
+    texture.InvalidateAlphaMasks();
+    REQUIRE(texture.GetAlphaMask(1).IsOpaque(10, 2) == false);
+  }
+
+  SECTION("PixelPerfectTest gives the same results as testing each pixel") {
+    sf::Image image1 = CreateRingImage(150, 90);
+    sf::Image image2 = CreateRingImage(40, 60);
+    sf::Texture texture1, texture2;
+    texture1.loadFromImage(image1);
+    texture2.loadFromImage(image2);
+    AlphaMask mask1(image1, 1);
+    AlphaMask mask2(image2, 1);
+
+    sf::Sprite sprite1(texture1);
+    sf::Sprite sprite2(texture2);
+    sprite1.setPosition(100, 50);
+
+    std::size_t collisionsCount = 0;
+    std::size_t testsCount = 0;
+    for (float angle : {0.0f, 30.0f, 90.0f}) {
+      for (float scaleX : {1.0f, -1.0f, 1.5f}) {
+        for (float scaleY : {1.0f, 0.5f}) {
+          sprite2.setRotation(angle);
+          sprite2.setScale(scaleX, scaleY);
+          sprite2.setOrigin(20, 30);
+          for (float x = 60; x < 300; x += 7.25) {
+            for (float y = 20; y < 180; y += 11) {
+              sprite2.setPosition(x, y);
+              bool expected =
+                  ReferencePixelPerfectTest(sprite1, sprite2, 1, image1, image2);
+              REQUIRE(PixelPerfectTest(sprite1, sprite2, mask1, mask2) ==
+                      expected);
+              REQUIRE(PixelPerfectTest(sprite2, sprite1, mask2, mask1) ==
+                      ReferencePixelPerfectTest(
+                          sprite2, sprite1, 1, image2, image1));
+              if (expected) collisionsCount++;
+              testsCount++;
+            }
+          }
+        }
+      }
+    }
+
+    // Both results must be covered.
+    REQUIRE(collisionsCount > 0);
+    REQUIRE(collisionsCount < testsCount);
+  }
+}
@@ -0,0 +1,94 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of pixel perfect collisions.
+ */
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <functional>
+#include <numeric>
+#include "GDCore/Project/ImageManager.h"
+#include "GDCpp/Runtime/Collisions.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * Create an image with only the columns in [firstColumn, lastColumn] being
+ * opaque.
+ */
+sf::Image CreateImage(unsigned int size,
+                      unsigned int firstColumn,
+                      unsigned int lastColumn) {
+  sf::Image image;
+  image.create(size, size, sf::Color(255, 255, 255, 0));
+  for (unsigned int x = firstColumn; x <= lastColumn; ++x)
+    for (unsigned int y = 0; y < size; ++y)
+      image.setPixel(x, y, sf::Color(255, 255, 255, 255));
+
+  return image;
+}
+}  // namespace
+
+TEST_CASE("Collisions - Benchmarks", "[game-engine][benchmarks]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  // Two large sprites covering each other, without opaque pixels overlapping:
+  // all the pixels of the intersection must be tested.
+  SFMLTextureWrapper texture1, texture2;
+  texture1.image = CreateImage(512, 0, 200);
+  texture2.image = CreateImage(512, 311, 511);
+  texture1.texture.loadFromImage(texture1.image);
+  texture2.texture.loadFromImage(texture2.image);
+  sf::Sprite sprite1(texture1.texture);
+  sf::Sprite sprite2(texture2.texture);
+  sprite1.setPosition(100, 100);
+  sprite2.setOrigin(256, 256);
+  sprite2.setPosition(356, 356);
+
+  SECTION("Sprites of 512x512 pixels") {
+    bool collision = true;
+    doBenchmark("PixelPerfectTest (512x512 sprites)", 10, [&]() {
+      collision = PixelPerfectTest(sprite1,
+                                   sprite2,
+                                   texture1.GetAlphaMask(1),
+                                   texture2.GetAlphaMask(1));
+    });
+    REQUIRE(collision == false);
+  }
+
+  SECTION("Rotated sprites of 512x512 pixels") {
+    sprite2.setRotation(1);
+    bool collision = true;
+    doBenchmark("PixelPerfectTest (rotated 512x512 sprites)", 10, [&]() {
+      collision = PixelPerfectTest(sprite1,
+                                   sprite2,
+                                   texture1.GetAlphaMask(1),
+                                   texture2.GetAlphaMask(1));
+    });
+    REQUIRE(collision == false);
+  }
+}
@@ -0,0 +1,64 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering DatFile, the archive containing the resources of games.
+ */
+#include "GDCpp/Runtime/DatFile.h"
+#include <cstring>
+#include <fstream>
+#include "catch.hpp"
+
+TEST_CASE("DatFile", "[game-engine]") {
+  // Creating the files to put in the archive
+  std::vector<gd::String> files = {"DatFileTest1.test", "DatFileTest2.test"};
+  {
+    std::ofstream file1("DatFileTest1.test", std::ios_base::binary);
+    file1 << "First file";
+    std::ofstream file2("DatFileTest2.test", std::ios_base::binary);
+    file2 << std::string("Second\0file", 11);
+  }
+
+  DatFile datFile;
+  REQUIRE(datFile.Create(files, ".", "DatFileTest.dat") == true);
+
+  SECTION("Reading files") {
+    DatFile readDatFile;
+    REQUIRE(readDatFile.Read("DatFileTest.dat") == true);
+    REQUIRE(readDatFile.ContainsFile("DatFileTest1.test") == true);
+    REQUIRE(readDatFile.ContainsFile("DatFileTest2.test") == true);
+    REQUIRE(readDatFile.ContainsFile("DatFileTest3.test") == false);
+
+    const char* data1;
+    const char* data2;
+    std::size_t size1, size2;
+    REQUIRE(readDatFile.GetFileView("DatFileTest1.test", data1, size1) == true);
+    REQUIRE(readDatFile.GetFileView("DatFileTest2.test", data2, size2) == true);
+    REQUIRE(std::string(data1, size1) == "First file");
+    REQUIRE(std::string(data2, size2) == std::string("Second\0file", 11));
+    REQUIRE(readDatFile.GetFileView("DatFileTest3.test", data1, size1) ==
+            false);
+
+    // Views stay valid when other files are read.
+    REQUIRE(readDatFile.GetFile("DatFileTest1.test") == data1);
+    REQUIRE(readDatFile.GetFileSize("DatFileTest2.test") == 11);
+    REQUIRE(std::string(data1, size1) == "First file");
+    REQUIRE(readDatFile.GetFile("DatFileTest3.test") == NULL);
+    REQUIRE(readDatFile.GetFileSize("DatFileTest3.test") == 0);
+  }
+
+  SECTION("Invalid files") {
+    DatFile readDatFile;
+    REQUIRE(readDatFile.Read("DatFileTestMissing.dat") == false);
+    REQUIRE(readDatFile.ContainsFile("DatFileTest1.test") == false);
+
+    std::ofstream truncatedFile("DatFileTestTruncated.dat",
+                                std::ios_base::binary);
+    truncatedFile << "EXEGD0.1";
+    truncatedFile.close();
+    REQUIRE(readDatFile.Read("DatFileTestTruncated.dat") == false);
+    REQUIRE(readDatFile.ContainsFile("DatFileTest1.test") == false);
+  }
+}
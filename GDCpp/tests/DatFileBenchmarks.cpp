@@ -0,0 +1,66 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of DatFile, the archive containing the resources of games.
+ */
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include "GDCpp/Runtime/DatFile.h"
+#include "catch.hpp"
+
+TEST_CASE("DatFile - Benchmarks", "[game-engine][benchmarks]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  // An archive with 500 resources of 16KB.
+  std::vector<gd::String> files;
+  for (std::size_t i = 0; i < 500; ++i) {
+    files.push_back("DatFileBenchmark" + gd::String::From(i) + ".test");
+    std::ofstream file(files.back().ToLocale(), std::ios_base::binary);
+    file << std::string(16 * 1024, 'a' + i % 26);
+  }
+  DatFile datFile;
+  REQUIRE(datFile.Create(files, ".", "DatFileBenchmark.dat") == true);
+
+  SECTION("Reading all the files of an archive") {
+    std::size_t totalSize = 0;
+    doBenchmark("Read archive and get 500 files", 3, [&]() {
+      DatFile readDatFile;
+      readDatFile.Read("DatFileBenchmark.dat");
+
+      totalSize = 0;
+      for (const gd::String &file : files) {
+        const char *data = readDatFile.GetFile(file);
+        const char expectedFirstByte = 'a' + totalSize / (16 * 1024) % 26;
+        if (data && data[0] == expectedFirstByte)
+          totalSize += readDatFile.GetFileSize(file);
+      }
+    });
+    REQUIRE(totalSize == 500 * 16 * 1024);
+  }
+}
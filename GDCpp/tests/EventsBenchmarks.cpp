@@ -0,0 +1,252 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of the conditions run by events, called the same way as by
+ * the events generated code.
+ */
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include "GDCore/Project/Object.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/MakeUnique.h"
+#include "GDCpp/Extensions/Builtin/ObjectTools.h"
+#include "GDCpp/Runtime/RuntimeBehavior.h"
+#include "GDCpp/Runtime/RuntimeContext.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeObjectsListsTools.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+namespace {
+class SquareRuntimeObject : public RuntimeObject {
+ public:
+  SquareRuntimeObject(RuntimeScene &scene, const gd::Object &object)
+      : RuntimeObject(scene, object) {}
+
+  virtual float GetWidth() const { return 32; }
+  virtual float GetHeight() const { return 32; }
+};
+}  // namespace
+
+TEST_CASE("Events - Benchmarks", "[game-engine][benchmarks]") {
+  gd::Object playerObject("Player");
+  gd::Object enemyObject("Enemy");
+  gd::Object coinObject("Coin");
+
+  RuntimeGame game;
+  RuntimeScene scene(NULL, &game);
+  RuntimeContext runtimeContext(&scene);
+
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  // A small scene, typical of what most events are working on.
+  std::vector<std::unique_ptr<RuntimeObject>> objects;
+  std::vector<RuntimeObject *> players, enemies, coins;
+  auto createObjects = [&](const gd::Object &object,
+                           std::vector<RuntimeObject *> &list,
+                           std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+      objects.emplace_back(new SquareRuntimeObject(scene, object));
+      objects.back()->SetX((objects.size() * 97) % 800);
+      objects.back()->SetY((objects.size() * 61) % 600);
+      list.push_back(objects.back().get());
+    }
+  };
+  createObjects(playerObject, players, 1);
+  createObjects(enemyObject, enemies, 20);
+  createObjects(coinObject, coins, 30);
+
+  SECTION("Conditions of 100 events, during 1000 frames") {
+    // The lists of picked objects of the events, as declared by the events
+    // generated code.
+    std::vector<RuntimeObject *> playerObjects, enemyObjects, coinObjects;
+
+    std::size_t trueConditionsCount = 0;
+    doBenchmark("Events conditions", 3, [&]() {
+      trueConditionsCount = 0;
+      for (std::size_t frame = 0; frame < 1000; ++frame) {
+        for (std::size_t event = 0; event < 100; ++event) {
+          playerObjects = players;
+          enemyObjects = enemies;
+          coinObjects = coins;
+
+          float x = (frame + event * 8) % 800;
+          if (PickObjectsIf(runtimeContext.ClearObjectListsMap(0)
+                                .AddObjectListToMap("Enemy", enemyObjects)
+                                .AddObjectListToMap("Coin", coinObjects)
+                                .ReturnObjectListsMap(),
+                            false,
+                            [x](RuntimeObject *obj) {
+                              return obj->GetX() >= x - 200 &&
+                                     obj->GetX() <= x + 200;
+                            }))
+            trueConditionsCount++;
+
+          if (DistanceBetweenObjects(runtimeContext.ClearObjectListsMap(1)
+                                         .AddObjectListToMap("Enemy",
+                                                             enemyObjects)
+                                         .ReturnObjectListsMap(),
+                                     runtimeContext.ClearObjectListsMap(2)
+                                         .AddObjectListToMap("Coin",
+                                                             coinObjects)
+                                         .ReturnObjectListsMap(),
+                                     150,
+                                     false))
+            trueConditionsCount++;
+
+          if (HitBoxesCollision(runtimeContext.ClearObjectListsMap(3)
+                                    .AddObjectListToMap("Player", playerObjects)
+                                    .ReturnObjectListsMap(),
+                                runtimeContext.ClearObjectListsMap(4)
+                                    .AddObjectListToMap("Enemy", enemyObjects)
+                                    .ReturnObjectListsMap(),
+                                true,
+                                scene))
+            trueConditionsCount++;
+        }
+      }
+    });
+
+    REQUIRE(trueConditionsCount > 0);
+  }
+
+  SECTION("Object and behavior conditions on 10000 instances") {
+    gd::SerializerElement behaviorContent;
+    std::vector<RuntimeObject *> manyEnemies;
+    createObjects(enemyObject, manyEnemies, 10000);
+    for (std::size_t i = 0; i < manyEnemies.size(); ++i) {
+      manyEnemies[i]->AddBehavior(
+          "Other", gd::make_unique<RuntimeBehavior>(behaviorContent));
+      manyEnemies[i]->AddBehavior(
+          "Behavior", gd::make_unique<RuntimeBehavior>(behaviorContent));
+      if (i % 3 == 0)
+        manyEnemies[i]->GetBehaviorRawPointer("Behavior")->Activate(false);
+    }
+
+    std::vector<RuntimeObject *> enemyObjects;
+    std::size_t pickedObjectsCount = 0;
+    doBenchmark("Object and behavior conditions (10000 instances)", 3, [&]() {
+      pickedObjectsCount = 0;
+      for (std::size_t event = 0; event < 10; ++event) {
+        enemyObjects = manyEnemies;
+
+        // The same code as generated by EventsCodeGenerator for an object
+        // condition followed by a behavior condition.
+        bool condition0IsTrue = false;
+        {
+          std::size_t pickedCount = 0;
+          for (std::size_t i = 0; i < enemyObjects.size(); ++i) {
+            if (enemyObjects[i]->GetX() >= 200 + event * 10) {
+              condition0IsTrue = true;
+              enemyObjects[pickedCount++] = enemyObjects[i];
+            }
+          }
+          enemyObjects.resize(pickedCount);
+        }
+        bool condition1IsTrue = false;
+        {
+          std::size_t behaviorSlot =
+              enemyObjects.empty()
+                  ? 0
+                  : enemyObjects[0]->GetBehaviorSlot("Behavior");
+          std::size_t pickedCount = 0;
+          for (std::size_t i = 0; i < enemyObjects.size(); ++i) {
+            if (enemyObjects[i]
+                    ->GetBehaviorRawPointerAtSlot(behaviorSlot)
+                    ->Activated()) {
+              condition1IsTrue = true;
+              enemyObjects[pickedCount++] = enemyObjects[i];
+            }
+          }
+          enemyObjects.resize(pickedCount);
+        }
+
+        if (condition0IsTrue && condition1IsTrue)
+          pickedObjectsCount += enemyObjects.size();
+      }
+    });
+
+    REQUIRE(pickedObjectsCount > 0);
+  }
+
+  SECTION("Delete 10000 instances") {
+    std::size_t deletedObjectsCount = 0;
+    doBenchmark("Delete 10000 instances", 3, [&]() {
+      for (std::size_t i = 0; i < 10000; ++i) {
+        scene.objectsInstances.AddObject(
+            gd::make_unique<SquareRuntimeObject>(scene, coinObject));
+        scene.objectsInstances.AddObject(
+            gd::make_unique<SquareRuntimeObject>(scene, enemyObject));
+      }
+
+      // Delete the objects as done by the events and the scene.
+      static const std::size_t coinObjectsId =
+          RuntimeContext::GetObjectNameId("Coin");
+      std::vector<RuntimeObject *> coinObjects =
+          runtimeContext.GetObjectsRawPointers(coinObjectsId);
+      for (RuntimeObject *object : coinObjects)
+        object->DeleteFromScene(scene);
+      for (RuntimeObject *object : coinObjects)
+        scene.objectsInstances.RemoveObject(object);
+      deletedObjectsCount = coinObjects.size();
+
+      scene.objectsInstances.RemoveObjects("Enemy");
+    });
+
+    REQUIRE(deletedObjectsCount == 10000);
+  }
+
+  SECTION("Trigger once conditions of 5000 events, during 100 frames") {
+    // The identifiers of the conditions, as given by the events code
+    // generator (based on the addresses of the instructions).
+    std::vector<std::size_t> conditionsSlots;
+    for (std::size_t i = 0; i < 5000; ++i)
+      conditionsSlots.push_back(
+          RuntimeContext::GetTriggerOnceSlot(0x7f0000000000 + i * 48));
+
+    std::size_t trueConditionsCount = 0;
+    doBenchmark("Trigger once conditions", 3, [&]() {
+      trueConditionsCount = 0;
+      for (std::size_t frame = 0; frame < 100; ++frame) {
+        runtimeContext.StartNewFrame();
+        for (std::size_t i = 0; i < conditionsSlots.size(); ++i) {
+          // Half of the conditions are checked every other frame.
+          if (i % 2 == 0 || frame % 2 == 0) {
+            if (runtimeContext.TriggerOnce(conditionsSlots[i]))
+              trueConditionsCount++;
+          }
+        }
+      }
+    });
+
+    // Conditions checked every frame were only true during the first run.
+    REQUIRE(trueConditionsCount == 5000 / 2 * 50);
+  }
+}
@@ -11,6 +11,7 @@
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Object.h"
+#include "GDCore/Tools/MakeUnique.h"
 #include "GDCpp/Runtime/RuntimeGame.h"
 #include "GDCpp/Runtime/RuntimeObject.h"
 #include "GDCpp/Runtime/RuntimeScene.h"
@@ -62,4 +63,89 @@ TEST_CASE("ObjInstancesHolder", "[common]") {
     REQUIRE(container.GetObjects("2").size() == 3);
     REQUIRE(container.GetObjectsRawPointers("2").size() == 3);
   }
+
+  SECTION("Objects are found using the identifiers of their names") {
+    gd::Object obj1("1");
+    gd::Object obj2("2");
+
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+
+    ObjInstancesHolder& container = scene.objectsInstances;
+    std::vector<RuntimeObject*> objects;
+    for (std::size_t i = 0; i < 4; ++i)
+      objects.push_back(container.AddObject(
+          gd::make_unique<RuntimeObject>(scene, i % 2 ? obj2 : obj1)));
+
+    std::size_t nameId1 = ObjInstancesHolder::GetNameId("1");
+    std::size_t nameId2 = ObjInstancesHolder::GetNameId("2");
+    REQUIRE(nameId1 != nameId2);
+    REQUIRE(ObjInstancesHolder::GetNameId("1") == nameId1);
+    REQUIRE(container.GetObjectsRawPointers(nameId1).size() == 2);
+    REQUIRE(container.GetObjects(nameId2).size() == 2);
+    REQUIRE(container.GetObjectsRawPointers(nameId2)[1] == objects[3]);
+
+    // Objects are removed from their lists, the others being still found.
+    container.RemoveObject(objects[0]);
+    REQUIRE(container.GetObjectsRawPointers(nameId1).size() == 1);
+    REQUIRE(container.GetObjectsRawPointers(nameId1)[0] == objects[2]);
+    container.RemoveObject(objects[2]);
+    REQUIRE(container.GetObjectsRawPointers(nameId1).empty());
+    REQUIRE(container.GetAllObjects().size() == 2);
+
+    // Objects are moved to another list when their name is changed.
+    objects[1]->DeleteFromScene(scene);
+    REQUIRE(container.GetObjectsRawPointers("").size() == 1);
+    REQUIRE(container.GetObjectsRawPointers("")[0] == objects[1]);
+    REQUIRE(container.GetObjectsRawPointers("2").size() == 1);
+    container.RemoveObject(objects[1]);
+    REQUIRE(container.GetObjectsRawPointers("").empty());
+    REQUIRE(container.GetObjects("2")[0].get() == objects[3]);
+
+    // Objects of copied containers are found.
+    ObjInstancesHolder copy = container;
+    REQUIRE(copy.GetObjectsRawPointers(nameId2).size() == 1);
+    RuntimeObject* copiedObject = copy.GetObjectsRawPointers(nameId2)[0];
+    REQUIRE(copiedObject != objects[3]);
+    container.RemoveObject(copiedObject);  // Not in this container.
+    REQUIRE(container.GetObjectsRawPointers(nameId2).size() == 1);
+    copy.RemoveObject(copiedObject);
+    REQUIRE(copy.GetObjectsRawPointers(nameId2).empty());
+  }
+
+  SECTION("Objects are kept in the order they were added") {
+    gd::Object obj1("1");
+
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+
+    ObjInstancesHolder container;
+    std::vector<RuntimeObject*> objects;
+    for (std::size_t i = 0; i < 5; ++i)
+      objects.push_back(container.AddObject(
+          gd::make_unique<RuntimeObject>(scene, obj1)));
+
+    container.RemoveObject(objects[1]);
+    container.RemoveObject(objects[3]);
+    REQUIRE(container.GetObjectsRawPointers("1") ==
+            std::vector<RuntimeObject*>({objects[0], objects[2], objects[4]}));
+
+    // Lists stay at the same place when lists for other names are created,
+    // or when the container is cleared.
+    const RuntimeObjNonOwningPtrList& list =
+        container.GetObjectsRawPointers("1");
+    for (std::size_t i = 0; i < 100; ++i)
+      container.GetObjectsRawPointers("Other" + gd::String::From(i));
+    REQUIRE(&container.GetObjectsRawPointers("1") == &list);
+    REQUIRE(list.size() == 3);
+
+    // Positions of the objects are updated after a removal.
+    container.RemoveObject(objects[4]);
+    container.RemoveObject(objects[0]);
+    REQUIRE(container.GetObjectsRawPointers("1") ==
+            std::vector<RuntimeObject*>({objects[2]}));
+    container.Clear();
+    REQUIRE(&container.GetObjectsRawPointers("1") == &list);
+    REQUIRE(list.empty());
+  }
 }
@@ -6,6 +6,7 @@
 /**
  * @file Tests covering common features of GDevelop C++ Platform.
  */
+#include <cmath>
 #include "GDCore/CommonTools.h"
 #include "GDCore/Project/ObjectsContainer.h"
 #include "GDCore/Project/Layout.h"
@@ -101,6 +102,84 @@ TEST_CASE("ObjectsListsTools", "[game-engine]") {
     REQUIRE(list1[0] == &obj1A);
     REQUIRE(list2[0] == &obj2C);
   }
+  SECTION("TwoObjectListsTest (with bounds)") {
+    std::map<gd::String, std::vector<RuntimeObject*>*> map1;
+    std::map<gd::String, std::vector<RuntimeObject*>*> map2;
+    std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
+    std::vector<RuntimeObject*> list2 = {&obj2A, &obj2B, &obj2C};
+    map1["1"] = &list1;
+    map2["2"] = &list2;
+    obj1A.SetX(0);
+    obj1B.SetX(100);
+    obj1C.SetX(1000);
+    obj2A.SetX(5);
+    obj2B.SetX(500);
+    obj2C.SetX(1010);
+
+    std::size_t predicateCallsCount = 0;
+    auto getBounds = [](RuntimeObject* obj) {
+      return sf::FloatRect(obj->GetX(), obj->GetY(), 10, 10);
+    };
+    auto areNear = [&predicateCallsCount](RuntimeObject* obj1,
+                                          RuntimeObject* obj2) {
+      predicateCallsCount++;
+      return std::abs(obj1->GetX() - obj2->GetX()) <= 10;
+    };
+
+    REQUIRE(TwoObjectListsTest(map1, map2, true, getBounds, areNear) == true);
+    REQUIRE(list1.size() == 1);  // Only obj1B is not near another object.
+    REQUIRE(list1[0] == &obj1B);
+    REQUIRE(list2.size() == 3);
+    REQUIRE(predicateCallsCount == 2);  // Far objects were not tested.
+
+    list1 = {&obj1A, &obj1B, &obj1C};
+    predicateCallsCount = 0;
+    REQUIRE(TwoObjectListsTest(map1, map2, false, getBounds, areNear) == true);
+    REQUIRE(list1.size() == 2);
+    REQUIRE(list1[0] == &obj1A);
+    REQUIRE(list1[1] == &obj1C);
+    REQUIRE(list2.size() == 2);
+    REQUIRE(list2[0] == &obj2A);
+    REQUIRE(list2[1] == &obj2C);
+    REQUIRE(predicateCallsCount == 2);
+
+    // An object is never tested against itself.
+    REQUIRE(TwoObjectListsTest(map1, map1, false, getBounds, areNear) ==
+            false);
+    REQUIRE(list1.size() == 0);
+  }
+  SECTION("TwoObjectListsTest (nested)") {
+    std::map<gd::String, std::vector<RuntimeObject*>*> map1;
+    std::map<gd::String, std::vector<RuntimeObject*>*> map2;
+    std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
+    std::vector<RuntimeObject*> list2 = {&obj2A, &obj2B, &obj2C};
+    map1["1"] = &list1;
+    map2["2"] = &list2;
+
+    // A predicate can itself pick objects, without changing the flags of the
+    // objects being tested.
+    REQUIRE(TwoObjectListsTest(
+                map1,
+                map2,
+                false,
+                [&](RuntimeObject* obj1, RuntimeObject* obj2) {
+                  std::map<gd::String, std::vector<RuntimeObject*>*> map3;
+                  std::map<gd::String, std::vector<RuntimeObject*>*> map4;
+                  std::vector<RuntimeObject*> list3 = {obj1, &obj1C};
+                  std::vector<RuntimeObject*> list4 = {obj2, &obj2A};
+                  map3["1"] = &list3;
+                  map4["2"] = &list4;
+                  TwoObjectListsTest(
+                      map3, map4, false, [](RuntimeObject*, RuntimeObject*) {
+                        return false;
+                      });
+                  return obj1 == &obj1B && obj2 == &obj2B;
+                }) == true);
+    REQUIRE(list1.size() == 1);
+    REQUIRE(list1[0] == &obj1B);
+    REQUIRE(list2.size() == 1);
+    REQUIRE(list2[0] == &obj2B);
+  }
   SECTION("PickNearestObject") {
     std::map<gd::String, std::vector<RuntimeObject*>*> map;
     std::vector<RuntimeObject*> list1 = {&obj1A, &obj1B, &obj1C};
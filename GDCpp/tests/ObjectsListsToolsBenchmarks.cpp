@@ -0,0 +1,145 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of the conditions testing two lists of objects.
+ */
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Extensions/Builtin/ObjectTools.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeObjectsListsTools.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+namespace {
+class SquareRuntimeObject : public RuntimeObject {
+ public:
+  SquareRuntimeObject(RuntimeScene &scene, const gd::Object &object)
+      : RuntimeObject(scene, object) {}
+
+  virtual float GetWidth() const { return 32; }
+  virtual float GetHeight() const { return 32; }
+};
+}  // namespace
+
+TEST_CASE("ObjectsListsTools - Benchmarks", "[game-engine][benchmarks]") {
+  gd::Object bulletObject("Bullet");
+  gd::Object enemyObject("Enemy");
+
+  RuntimeGame game;
+  RuntimeScene scene(NULL, &game);
+
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  // Bullets and enemies spread on a 4000x4000 area, with a few of them
+  // overlapping.
+  std::vector<std::unique_ptr<RuntimeObject>> objects;
+  std::vector<RuntimeObject *> bullets;
+  std::vector<RuntimeObject *> enemies;
+  for (std::size_t i = 0; i < 2000; ++i) {
+    objects.emplace_back(new SquareRuntimeObject(scene, bulletObject));
+    objects.back()->SetX((i * 7919) % 4000);
+    objects.back()->SetY((i * 104729) % 4000);
+    bullets.push_back(objects.back().get());
+
+    objects.emplace_back(new SquareRuntimeObject(scene, enemyObject));
+    objects.back()->SetX((i * 6133) % 4000);
+    objects.back()->SetY((i * 15485863) % 4000);
+    enemies.push_back(objects.back().get());
+  }
+
+  // Run the test on copies of the lists, returning the number of picked
+  // bullets and enemies.
+  auto countPicked =
+      [&](std::function<void(RuntimeObjectsLists, RuntimeObjectsLists)> test) {
+        std::vector<RuntimeObject *> pickedBullets = bullets;
+        std::vector<RuntimeObject *> pickedEnemies = enemies;
+        RuntimeObjectsLists lists1, lists2;
+        lists1["Bullet"] = &pickedBullets;
+        lists2["Enemy"] = &pickedEnemies;
+
+        test(lists1, lists2);
+        return std::make_pair(pickedBullets.size(), pickedEnemies.size());
+      };
+
+  SECTION("Collisions between 2000 bullets and 2000 enemies") {
+    std::pair<std::size_t, std::size_t> pickedWithAllPairs;
+    doBenchmark("TwoObjectListsTest (collisions, all pairs)", 3, [&]() {
+      pickedWithAllPairs = countPicked(
+          [](RuntimeObjectsLists lists1, RuntimeObjectsLists lists2) {
+            TwoObjectListsTest(lists1,
+                               lists2,
+                               false,
+                               [](RuntimeObject *obj1, RuntimeObject *obj2) {
+                                 return obj1->IsCollidingWith(obj2);
+                               });
+          });
+    });
+
+    std::pair<std::size_t, std::size_t> picked;
+    doBenchmark("HitBoxesCollision", 3, [&]() {
+      picked = countPicked(
+          [&](RuntimeObjectsLists lists1, RuntimeObjectsLists lists2) {
+            HitBoxesCollision(lists1, lists2, false, scene);
+          });
+    });
+
+    REQUIRE(pickedWithAllPairs.first > 0);
+    REQUIRE(picked == pickedWithAllPairs);
+  }
+
+  SECTION("Distance between 2000 bullets and 2000 enemies") {
+    std::pair<std::size_t, std::size_t> pickedWithAllPairs;
+    doBenchmark("TwoObjectListsTest (distance, all pairs)", 3, [&]() {
+      pickedWithAllPairs = countPicked(
+          [](RuntimeObjectsLists lists1, RuntimeObjectsLists lists2) {
+            TwoObjectListsTest(lists1,
+                               lists2,
+                               false,
+                               [](RuntimeObject *obj1, RuntimeObject *obj2) {
+                                 return obj1->GetSqDistanceWithObject(obj2) <=
+                                        50 * 50;
+                               });
+          });
+    });
+
+    std::pair<std::size_t, std::size_t> picked;
+    doBenchmark("DistanceBetweenObjects", 3, [&]() {
+      picked = countPicked(
+          [](RuntimeObjectsLists lists1, RuntimeObjectsLists lists2) {
+            DistanceBetweenObjects(lists1, lists2, 50, false);
+          });
+    });
+
+    REQUIRE(pickedWithAllPairs.first > 0);
+    REQUIRE(picked == pickedWithAllPairs);
+  }
+}
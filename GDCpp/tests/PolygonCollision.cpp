@@ -0,0 +1,145 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering collisions between polygons and objects hitboxes.
+ */
+#include "GDCpp/Runtime/PolygonCollision.h"
+#include <cmath>
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/HitBoxes.h"
+#include "GDCpp/Runtime/Polygon2d.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/RuntimeSpriteObject.h"
+#include "catch.hpp"
+
+namespace {
+Polygon2d CreateRegularPolygon(std::size_t verticesCount,
+                               float radius,
+                               float x,
+                               float y) {
+  Polygon2d polygon;
+  for (std::size_t i = 0; i < verticesCount; ++i) {
+    float angle = 2 * 3.14159f * i / verticesCount;
+    polygon.vertices.push_back(
+        sf::Vector2f(x + radius * cos(angle), y + radius * sin(angle)));
+  }
+
+  return polygon;
+}
+
+class SquareRuntimeObject : public RuntimeObject {
+ public:
+  SquareRuntimeObject(RuntimeScene &scene, const gd::Object &object)
+      : RuntimeObject(scene, object), size(32) {}
+
+  virtual float GetWidth() const { return size; }
+  virtual float GetHeight() const { return size; }
+
+  float size;
+};
+}  // namespace
+
+TEST_CASE("PolygonCollision", "[game-engine]") {
+  SECTION("HitBoxes give the same results as polygons") {
+    std::vector<Polygon2d> polygons;
+    polygons.push_back(Polygon2d::CreateRectangle(10, 20));
+    polygons.push_back(CreateRegularPolygon(3, 10, 4, 5));
+    polygons.push_back(CreateRegularPolygon(6, 8, -3, 2));
+    polygons.push_back(CreateRegularPolygon(32, 12, 15, 0));
+    polygons.push_back(CreateRegularPolygon(5, 6, 30, 30));
+    polygons.push_back(Polygon2d::CreateRectangle(10, 10));
+    polygons.back().Move(10, 0);  // Touching the first rectangle.
+    polygons.push_back(Polygon2d::CreateRectangle(10, 10));
+    polygons.back().Rotate(0.3);
+    polygons.back().Move(4, -12);
+
+    HitBoxes hitBoxes;
+    hitBoxes.Set(polygons);
+    REQUIRE(hitBoxes.GetPolygonsCount() == polygons.size());
+    REQUIRE(hitBoxes.GetVerticesCount(3) == 32);
+
+    for (std::size_t i = 0; i < polygons.size(); ++i) {
+      for (std::size_t j = 0; j < polygons.size(); ++j) {
+        for (bool ignoreTouchingEdges : {false, true}) {
+          CollisionResult expected = PolygonCollisionTest(
+              polygons[i], polygons[j], ignoreTouchingEdges);
+          CollisionResult result =
+              PolygonCollisionTest(hitBoxes, i, hitBoxes, j, ignoreTouchingEdges);
+          REQUIRE(result.collision == expected.collision);
+          REQUIRE(result.move_axis.x == Approx(expected.move_axis.x));
+          REQUIRE(result.move_axis.y == Approx(expected.move_axis.y));
+        }
+      }
+
+      for (float x = -20; x <= 40; x += 3.5) {
+        for (float y = -20; y <= 40; y += 3.5) {
+          REQUIRE(IsPointInsidePolygon(hitBoxes, i, x, y) ==
+                  IsPointInsidePolygon(polygons[i], x, y));
+        }
+      }
+    }
+
+    REQUIRE(PolygonCollisionTest(hitBoxes, 0, hitBoxes, 5).collision == true);
+    REQUIRE(PolygonCollisionTest(hitBoxes, 0, hitBoxes, 5, true).collision ==
+            false);
+  }
+
+  SECTION("Cached hitboxes of objects") {
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+    gd::Object object("Square");
+    SquareRuntimeObject square(scene, object);
+    SquareRuntimeObject otherSquare(scene, object);
+    otherSquare.SetX(100);
+
+    REQUIRE(square.IsCollidingWith(&otherSquare) == false);
+    REQUIRE(&square.GetCachedHitBoxes() == &square.GetCachedHitBoxes());
+    REQUIRE(square.GetCachedHitBoxes().minX[0] == 0);
+
+    square.SetX(80);
+    REQUIRE(square.GetCachedHitBoxes().minX[0] == 80);
+    REQUIRE(square.IsCollidingWith(&otherSquare) == true);
+    REQUIRE(square.IsCollidingWithPoint(100, 16) == true);
+    REQUIRE(square.IsCollidingWithPoint(120, 16) == false);
+
+    // The size is part of the transform of the hitboxes.
+    square.size = 10;
+    REQUIRE(square.IsCollidingWith(&otherSquare) == false);
+    REQUIRE(square.GetCachedHitBoxes().maxX[0] == 90);
+  }
+
+  SECTION("Cached hitboxes of sprites") {
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+
+    gd::SpriteObject spriteObject("SpriteObject");
+    gd::Animation anim;
+    anim.SetDirectionsCount(1);
+    for (float maskX : {10, 50}) {
+      gd::Sprite sprite;
+      std::vector<Polygon2d> mask;
+      mask.push_back(Polygon2d::CreateRectangle(10, 10));
+      mask.back().Move(maskX, 5);
+      sprite.SetCustomCollisionMask(mask);
+      sprite.SetCollisionMaskAutomatic(false);
+      anim.GetDirection(0).AddSprite(sprite);
+    }
+    spriteObject.AddAnimation(anim);
+
+    RuntimeSpriteObject object(scene, spriteObject);
+    object.SetX(100);
+    REQUIRE(object.GetCachedHitBoxes().minX[0] == 105);
+
+    // Changing the sprite does not change the position of the object, but
+    // changes the hitboxes.
+    object.SetSprite(1);
+    REQUIRE(object.GetCachedHitBoxes().minX[0] == 145);
+  }
+}
@@ -0,0 +1,146 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of the collision tests between polygons.
+ */
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include "GDCore/Project/Object.h"
+#include "GDCpp/Runtime/HitBoxes.h"
+#include "GDCpp/Runtime/Polygon2d.h"
+#include "GDCpp/Runtime/PolygonCollision.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+namespace {
+Polygon2d CreateRegularPolygon(std::size_t verticesCount, float radius) {
+  Polygon2d polygon;
+  for (std::size_t i = 0; i < verticesCount; ++i) {
+    float angle = 2 * 3.14159f * i / verticesCount;
+    polygon.vertices.push_back(
+        sf::Vector2f(radius * cos(angle), radius * sin(angle)));
+  }
+
+  return polygon;
+}
+
+class SquareRuntimeObject : public RuntimeObject {
+ public:
+  SquareRuntimeObject(RuntimeScene &scene, const gd::Object &object)
+      : RuntimeObject(scene, object) {}
+
+  virtual float GetWidth() const { return 32; }
+  virtual float GetHeight() const { return 32; }
+};
+}  // namespace
+
+TEST_CASE("PolygonCollision - Benchmarks", "[game-engine][benchmarks]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  // Test each polygon of the list against all the others, with the
+  // polygons and with the hitboxes, and check that results are the same.
+  auto benchmarkPolygons = [&](const gd::String &name,
+                               std::vector<Polygon2d> polygons) {
+    HitBoxes hitBoxes;
+    hitBoxes.Set(polygons);
+
+    std::size_t collisionsCount = 0;
+    doBenchmark(name + " (Polygon2d)", 3, [&]() {
+      collisionsCount = 0;
+      for (std::size_t i = 0; i < polygons.size(); ++i)
+        for (std::size_t j = 0; j < polygons.size(); ++j)
+          if (PolygonCollisionTest(polygons[i], polygons[j]).collision)
+            collisionsCount++;
+    });
+
+    std::size_t hitBoxesCollisionsCount = 0;
+    doBenchmark(name + " (HitBoxes)", 3, [&]() {
+      hitBoxesCollisionsCount = 0;
+      for (std::size_t i = 0; i < polygons.size(); ++i)
+        for (std::size_t j = 0; j < polygons.size(); ++j)
+          if (PolygonCollisionTest(hitBoxes, i, hitBoxes, j).collision)
+            hitBoxesCollisionsCount++;
+    });
+
+    REQUIRE(collisionsCount > polygons.size());
+    REQUIRE(hitBoxesCollisionsCount == collisionsCount);
+  };
+
+  SECTION("Boxes") {
+    std::vector<Polygon2d> polygons;
+    for (std::size_t i = 0; i < 300; ++i) {
+      polygons.push_back(Polygon2d::CreateRectangle(32, 32));
+      polygons.back().Move((i * 37) % 300, (i * 53) % 300);
+    }
+    benchmarkPolygons("300x300 boxes", polygons);
+  }
+
+  SECTION("Rotated polygons") {
+    std::vector<Polygon2d> polygons;
+    for (std::size_t i = 0; i < 300; ++i) {
+      polygons.push_back(CreateRegularPolygon(3 + i % 6, 20));
+      polygons.back().Rotate(i * 0.1);
+      polygons.back().Move((i * 37) % 300, (i * 53) % 300);
+    }
+    benchmarkPolygons("300x300 rotated polygons", polygons);
+  }
+
+  SECTION("Polygons with many vertices") {
+    std::vector<Polygon2d> polygons;
+    for (std::size_t i = 0; i < 100; ++i) {
+      polygons.push_back(CreateRegularPolygon(64, 20));
+      polygons.back().Move((i * 37) % 200, (i * 53) % 200);
+    }
+    benchmarkPolygons("100x100 polygons with 64 vertices", polygons);
+  }
+
+  SECTION("Objects") {
+    RuntimeGame game;
+    RuntimeScene scene(NULL, &game);
+    gd::Object object("Square");
+
+    std::vector<std::unique_ptr<RuntimeObject>> objects;
+    for (std::size_t i = 0; i < 300; ++i) {
+      objects.emplace_back(new SquareRuntimeObject(scene, object));
+      objects.back()->SetX((i * 37) % 300);
+      objects.back()->SetY((i * 53) % 300);
+    }
+
+    std::size_t collisionsCount = 0;
+    doBenchmark("300x300 RuntimeObject::IsCollidingWith", 3, [&]() {
+      collisionsCount = 0;
+      for (std::size_t i = 0; i < objects.size(); ++i)
+        for (std::size_t j = 0; j < objects.size(); ++j)
+          if (objects[i]->IsCollidingWith(objects[j].get())) collisionsCount++;
+    });
+    REQUIRE(collisionsCount > objects.size());
+  }
+}
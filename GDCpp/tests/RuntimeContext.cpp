@@ -0,0 +1,73 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the RuntimeContext used by the events generated code.
+ */
+#include "GDCpp/Runtime/RuntimeContext.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+TEST_CASE("RuntimeContext", "[game-engine]") {
+  RuntimeGame game;
+  RuntimeScene scene(NULL, &game);
+  RuntimeContext runtimeContext(&scene);
+
+  SECTION("Trigger once conditions slots") {
+    std::size_t slot1 = RuntimeContext::GetTriggerOnceSlot(0x1234560);
+    std::size_t slot2 = RuntimeContext::GetTriggerOnceSlot(0x1234561);
+    REQUIRE(slot2 == slot1 + 1);
+    REQUIRE(RuntimeContext::GetTriggerOnceSlot(0x1234560) == slot1);
+  }
+
+  SECTION("Trigger once conditions") {
+    std::size_t slot1 = RuntimeContext::GetTriggerOnceSlot(0x1234570);
+    std::size_t slot2 = RuntimeContext::GetTriggerOnceSlot(0x1234571);
+
+    runtimeContext.StartNewFrame();
+    REQUIRE(runtimeContext.TriggerOnce(slot1) == true);
+
+    runtimeContext.StartNewFrame();
+    REQUIRE(runtimeContext.TriggerOnce(slot1) == false);
+    REQUIRE(runtimeContext.TriggerOnce(slot1) == false);
+    REQUIRE(runtimeContext.TriggerOnce(slot2) == true);
+
+    // The condition is true again once it was not checked during a frame.
+    runtimeContext.StartNewFrame();
+    REQUIRE(runtimeContext.TriggerOnce(slot2) == false);
+    runtimeContext.StartNewFrame();
+    REQUIRE(runtimeContext.TriggerOnce(slot1) == true);
+    REQUIRE(runtimeContext.TriggerOnce(slot2) == false);
+  }
+
+  SECTION("Maps of objects lists") {
+    std::vector<RuntimeObject *> list1, list2;
+    const RuntimeObjectsLists &map1 =
+        runtimeContext.ClearObjectListsMap(0)
+            .AddObjectListToMap("Object1", list1)
+            .ReturnObjectListsMap();
+    const RuntimeObjectsLists &map2 =
+        runtimeContext.ClearObjectListsMap(5)
+            .AddObjectListToMap("Object2", list2)
+            .ReturnObjectListsMap();
+
+    // Maps with different indexes can be used at the same time.
+    REQUIRE(&map1 != &map2);
+    REQUIRE(map1.size() == 1);
+    REQUIRE(map1.at("Object1") == &list1);
+    REQUIRE(map2.size() == 1);
+    REQUIRE(map2.at("Object2") == &list2);
+
+    // Maps are reused.
+    const RuntimeObjectsLists &map1Again =
+        runtimeContext.ClearObjectListsMap(0)
+            .AddObjectListToMap("Object2", list2)
+            .ReturnObjectListsMap();
+    REQUIRE(&map1Again == &map1);
+    REQUIRE(map1.size() == 1);
+    REQUIRE(map1.at("Object2") == &list2);
+  }
+}
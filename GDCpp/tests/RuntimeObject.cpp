@@ -0,0 +1,48 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the behaviors of RuntimeObject.
+ */
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/MakeUnique.h"
+#include "GDCpp/Runtime/RuntimeBehavior.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "catch.hpp"
+
+TEST_CASE("RuntimeObject", "[game-engine]") {
+  RuntimeGame game;
+  RuntimeScene scene(NULL, &game);
+  gd::Object object("MyObject");
+  gd::SerializerElement behaviorContent;
+
+  SECTION("Behaviors slots") {
+    RuntimeObject runtimeObject(scene, object);
+    REQUIRE(runtimeObject.GetBehaviorSlot("Behavior1") == gd::String::npos);
+
+    runtimeObject.AddBehavior(
+        "Behavior2", gd::make_unique<RuntimeBehavior>(behaviorContent));
+    runtimeObject.AddBehavior(
+        "Behavior1", gd::make_unique<RuntimeBehavior>(behaviorContent));
+    std::size_t slot1 = runtimeObject.GetBehaviorSlot("Behavior1");
+    std::size_t slot2 = runtimeObject.GetBehaviorSlot("Behavior2");
+    REQUIRE(slot1 != slot2);
+    REQUIRE(runtimeObject.GetBehaviorRawPointerAtSlot(slot1) ==
+            runtimeObject.GetBehaviorRawPointer("Behavior1"));
+    REQUIRE(runtimeObject.GetBehaviorRawPointerAtSlot(slot2) ==
+            runtimeObject.GetBehaviorRawPointer("Behavior2"));
+
+    // Copies of the object have their behaviors in the same slots.
+    RuntimeObject copiedObject(runtimeObject);
+    REQUIRE(copiedObject.GetBehaviorSlot("Behavior1") == slot1);
+    REQUIRE(copiedObject.GetBehaviorRawPointerAtSlot(slot1) ==
+            copiedObject.GetBehaviorRawPointer("Behavior1"));
+    REQUIRE(copiedObject.GetBehaviorRawPointerAtSlot(slot1) !=
+            runtimeObject.GetBehaviorRawPointerAtSlot(slot1));
+  }
+}
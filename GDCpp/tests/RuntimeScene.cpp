@@ -0,0 +1,177 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the rendering of the objects of a RuntimeScene.
+ */
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <vector>
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/MakeUnique.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeLayer.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeSpriteObject.h"
+#include "GDCpp/Runtime/SpriteBatch.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * \brief An object remembering in which order objects are drawn.
+ */
+class DrawnRuntimeObject : public RuntimeObject {
+ public:
+  DrawnRuntimeObject(RuntimeScene &scene,
+                     const gd::Object &object,
+                     std::vector<RuntimeObject *> &drawnObjects_,
+                     bool drawnInsideAABB_ = true)
+      : RuntimeObject(scene, object),
+        drawnObjects(drawnObjects_),
+        drawnInsideAABB(drawnInsideAABB_) {}
+
+  virtual bool Draw(sf::RenderTarget &renderTarget) {
+    drawnObjects.push_back(this);
+    return true;
+  }
+  virtual bool IsDrawnInsideAABB() const { return drawnInsideAABB; }
+
+  virtual float GetWidth() const { return 32; }
+  virtual float GetHeight() const { return 32; }
+
+ private:
+  std::vector<RuntimeObject *> &drawnObjects;
+  bool drawnInsideAABB;
+};
+}  // namespace
+
+TEST_CASE("RuntimeScene rendering", "[game-engine]") {
+  gd::Layout layout;
+  gd::SerializerElement layersElement;
+  layersElement.ConsiderAsArrayOf("layer");
+  for (const gd::String &layerName : std::vector<gd::String>{"", "Top"}) {
+    gd::SerializerElement &layerElement = layersElement.AddChild("layer");
+    layerElement.SetAttribute("name", layerName);
+    layerElement.AddChild("cameras").ConsiderAsArrayOf("camera");
+    layerElement.GetChild("cameras").AddChild("camera");
+  }
+  layout.UnserializeLayersFrom(layersElement);
+  gd::Object object("MyObject");
+
+  RuntimeGame game;
+  sf::RenderWindow window;
+  RuntimeScene scene(&window, &game);
+  scene.LoadFromScene(layout);
+
+  std::vector<RuntimeObject *> drawnObjects;
+  auto addObject = [&](float x, int zOrder, const gd::String &layer) {
+    RuntimeObject *runtimeObject = scene.objectsInstances.AddObject(
+        gd::make_unique<DrawnRuntimeObject>(scene, object, drawnObjects));
+    runtimeObject->SetX(x);
+    runtimeObject->SetZOrder(zOrder);
+    runtimeObject->SetLayer(layer);
+    return runtimeObject;
+  };
+  auto render = [&]() {
+    drawnObjects.clear();
+    scene.RenderWithoutStep();
+    return drawnObjects;
+  };
+
+  RuntimeObject *object1 = addObject(10, 3, "");
+  RuntimeObject *object2 = addObject(20, 1, "Top");
+  RuntimeObject *object3 = addObject(30, 2, "");
+  RuntimeObject *object4 = addObject(40, 1, "");
+
+  SECTION("Objects are drawn layer by layer, sorted by Z order") {
+    REQUIRE(render() == std::vector<RuntimeObject *>(
+                            {object4, object3, object1, object2}));
+    REQUIRE(render() == std::vector<RuntimeObject *>(
+                            {object4, object3, object1, object2}));
+  }
+
+  SECTION("Changes of Z orders and layers are taken into account") {
+    render();
+    object4->SetZOrder(5);
+    REQUIRE(render() == std::vector<RuntimeObject *>(
+                            {object3, object1, object4, object2}));
+
+    object3->SetLayer("Top");
+    REQUIRE(render() == std::vector<RuntimeObject *>(
+                            {object1, object4, object2, object3}));
+
+    object1->SetLayer("Unknown layer");
+    REQUIRE(render() ==
+            std::vector<RuntimeObject *>({object4, object2, object3}));
+  }
+
+  SECTION("Added and removed objects are taken into account") {
+    render();
+    RuntimeObject *object5 = addObject(50, 0, "Top");
+    scene.objectsInstances.RemoveObject(object1);
+    REQUIRE(render() == std::vector<RuntimeObject *>(
+                            {object4, object3, object5, object2}));
+  }
+
+  SECTION("Objects outside of the cameras are not drawn") {
+    object1->SetX(-100);
+    object3->SetX(2000);
+    REQUIRE(render() ==
+            std::vector<RuntimeObject *>({object4, object2}));
+
+    // Objects drawing outside of their AABB are always drawn.
+    RuntimeObject *object5 = scene.objectsInstances.AddObject(
+        gd::make_unique<DrawnRuntimeObject>(
+            scene, object, drawnObjects, false));
+    object5->SetX(3000);
+    REQUIRE(render() ==
+            std::vector<RuntimeObject *>({object5, object4, object2}));
+
+    scene.GetRuntimeLayer("").GetCamera(0).SetViewCenter(
+        sf::Vector2f(2000, 300));
+    REQUIRE(render() ==
+            std::vector<RuntimeObject *>({object5, object3, object2}));
+  }
+
+  SECTION("Sprites sharing a texture are drawn together") {
+    gd::SpriteObject spriteObject("MySprite");
+    gd::Animation animation;
+    animation.SetDirectionsCount(1);
+    gd::Sprite sprite;
+    sprite.SetImageName("Image.png");
+    animation.GetDirection(0).AddSprite(sprite);
+    spriteObject.AddAnimation(animation);
+
+    auto addSprite = [&](int zOrder) {
+      RuntimeSpriteObject *runtimeObject = static_cast<RuntimeSpriteObject *>(
+          scene.objectsInstances.AddObject(
+              gd::make_unique<RuntimeSpriteObject>(scene, spriteObject)));
+      runtimeObject->SetZOrder(zOrder);
+      return runtimeObject;
+    };
+    addSprite(10);
+    addSprite(11);
+    RuntimeSpriteObject *sprite3 = addSprite(12);
+    render();
+    REQUIRE(scene.GetSpriteBatch().GetBatchesCount() == 1);
+    REQUIRE(scene.GetSpriteBatch().GetVerticesCount() == 18);
+
+    // Objects drawn between the sprites, or sprites with another blend mode,
+    // need another batch.
+    addSprite(20);
+    object1->SetZOrder(15);
+    render();
+    REQUIRE(scene.GetSpriteBatch().GetBatchesCount() == 2);
+
+    sprite3->SetBlendMode(1);
+    render();
+    REQUIRE(scene.GetSpriteBatch().GetBatchesCount() == 3);
+    REQUIRE(scene.GetSpriteBatch().GetVerticesCount() == 24);
+  }
+}
@@ -0,0 +1,132 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of the rendering of the objects of a RuntimeScene.
+ */
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <chrono>
+#include <functional>
+#include <numeric>
+#include "GDCore/Extensions/Builtin/SpriteExtension/Animation.h"
+#include "GDCore/Extensions/Builtin/SpriteExtension/SpriteObject.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Tools/MakeUnique.h"
+#include "GDCpp/Runtime/RuntimeGame.h"
+#include "GDCpp/Runtime/RuntimeObject.h"
+#include "GDCpp/Runtime/RuntimeScene.h"
+#include "GDCpp/Runtime/RuntimeSpriteObject.h"
+#include "GDCpp/Runtime/SpriteBatch.h"
+#include "catch.hpp"
+
+namespace {
+class SquareRuntimeObject : public RuntimeObject {
+ public:
+  SquareRuntimeObject(RuntimeScene &scene, const gd::Object &object)
+      : RuntimeObject(scene, object) {}
+
+  virtual float GetWidth() const { return 32; }
+  virtual float GetHeight() const { return 32; }
+};
+}  // namespace
+
+TEST_CASE("RuntimeScene - Benchmarks", "[game-engine][benchmarks]") {
+  gd::Layout layout;
+  const std::size_t layersCount = 5;
+  gd::SerializerElement layersElement;
+  layersElement.ConsiderAsArrayOf("layer");
+  for (std::size_t i = 0; i < layersCount; ++i) {
+    gd::SerializerElement &layerElement = layersElement.AddChild("layer");
+    layerElement.SetAttribute("name",
+                              i == 0 ? "" : "Layer" + gd::String::From(i));
+    layerElement.AddChild("cameras").ConsiderAsArrayOf("camera");
+    layerElement.GetChild("cameras").AddChild("camera");
+  }
+  layout.UnserializeLayersFrom(layersElement);
+  gd::Object object("MyObject");
+
+  RuntimeGame game;
+  sf::RenderWindow window;
+  RuntimeScene scene(&window, &game);
+  scene.LoadFromScene(layout);
+
+  // Objects spread on the layers, mostly outside of the cameras.
+  std::vector<RuntimeObject *> objects;
+  for (std::size_t i = 0; i < 20000; ++i) {
+    RuntimeObject *runtimeObject = scene.objectsInstances.AddObject(
+        gd::make_unique<SquareRuntimeObject>(scene, object));
+    runtimeObject->SetX((i * 37) % 8000);
+    runtimeObject->SetY((i * 13) % 6000);
+    runtimeObject->SetZOrder((i * 7) % 100);
+    runtimeObject->SetLayer(layout.GetLayer(i % layersCount).GetName());
+    objects.push_back(runtimeObject);
+  }
+
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  SECTION("Render 20000 objects on 5 layers") {
+    doBenchmark("Render 20000 objects on 5 layers", 10, [&]() {
+      scene.RenderWithoutStep();
+    });
+  }
+
+  SECTION("Render 20000 objects on 5 layers, changing some Z orders") {
+    std::size_t frame = 0;
+    doBenchmark(
+        "Render 20000 objects on 5 layers, changing some Z orders", 10, [&]() {
+          for (std::size_t i = 0; i < 10; ++i)
+            objects[(frame * 10 + i) * 97 % objects.size()]->SetZOrder(frame);
+          frame++;
+          scene.RenderWithoutStep();
+        });
+  }
+
+  SECTION("Render 5000 sprites") {
+    gd::SpriteObject spriteObject("MySprite");
+    gd::Animation animation;
+    animation.SetDirectionsCount(1);
+    gd::Sprite sprite;
+    sprite.SetImageName("Image.png");
+    animation.GetDirection(0).AddSprite(sprite);
+    spriteObject.AddAnimation(animation);
+    for (std::size_t i = 0; i < 5000; ++i) {
+      RuntimeObject *runtimeObject = scene.objectsInstances.AddObject(
+          gd::make_unique<RuntimeSpriteObject>(scene, spriteObject));
+      runtimeObject->SetX((i * 37) % 800);
+      runtimeObject->SetY((i * 13) % 600);
+      runtimeObject->SetZOrder(100 + i % 10);
+    }
+
+    doBenchmark("Render 5000 sprites", 10, [&]() {
+      scene.RenderWithoutStep();
+    });
+    std::cout << "Render 5000 sprites: "
+              << scene.GetSpriteBatch().GetDrawCallsCount() << " draw calls"
+              << std::endl;
+  }
+}
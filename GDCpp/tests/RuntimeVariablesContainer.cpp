@@ -0,0 +1,76 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the RuntimeVariablesContainer used by games.
+ */
+#include "GDCpp/Runtime/RuntimeVariablesContainer.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Project/VariablesContainer.h"
+#include "catch.hpp"
+
+TEST_CASE("RuntimeVariablesContainer", "[game-engine]") {
+  gd::VariablesContainer container;
+  gd::Variable variable1;
+  variable1.SetValue(1);
+  container.Insert("Variable1", variable1, 0);
+  gd::Variable variable2;
+  variable2.GetChild("Child").SetString("Hello");
+  container.Insert("Variable2", variable2, 1);
+
+  RuntimeVariablesContainer variables(container);
+
+  SECTION("Access by name and by index") {
+    REQUIRE(variables.Has("Variable1") == true);
+    REQUIRE(variables.Has("Variable2") == true);
+    REQUIRE(variables.Has("Variable3") == false);
+    REQUIRE(variables.Get("Variable1").GetValue() == 1);
+    REQUIRE(variables.Get(0).GetValue() == 1);
+    REQUIRE(variables.Get(1).GetChild("Child").GetString() == "Hello");
+    REQUIRE(&variables.Get("Variable2") == &variables.Get(1));
+  }
+
+  SECTION("Variables are created when accessed") {
+    gd::Variable &variable3 = variables.Get("Variable3");
+    variable3.SetValue(3);
+    REQUIRE(variables.Has("Variable3") == true);
+
+    // References to existing variables stay valid.
+    for (std::size_t i = 0; i < 1000; ++i)
+      variables.Get("NewVariable" + gd::String::From(i));
+    REQUIRE(&variables.Get("Variable3") == &variable3);
+    REQUIRE(variable3.GetValue() == 3);
+    REQUIRE(variables.DumpAllVariables().size() == 1003);
+  }
+
+  SECTION("Merge") {
+    gd::VariablesContainer otherContainer;
+    gd::Variable otherVariable1;
+    otherVariable1.SetValue(10);
+    otherContainer.Insert("Variable1", otherVariable1, 0);
+    gd::Variable variable3;
+    variable3.SetValue(3);
+    otherContainer.Insert("Variable3", variable3, 1);
+
+    variables.Merge(otherContainer);
+    REQUIRE(variables.Get("Variable1").GetValue() == 10);
+    REQUIRE(variables.Get(0).GetValue() == 10);
+    REQUIRE(variables.Get(2).GetValue() == 3);
+  }
+
+  SECTION("Copy") {
+    RuntimeVariablesContainer copiedVariables(variables);
+    copiedVariables.Get("Variable1").SetValue(2);
+    copiedVariables.Get(1).GetChild("Child").SetString("World");
+    REQUIRE(variables.Get("Variable1").GetValue() == 1);
+    REQUIRE(variables.Get(1).GetChild("Child").GetString() == "Hello");
+    REQUIRE(copiedVariables.Get(0).GetValue() == 2);
+
+    RuntimeVariablesContainer assignedVariables;
+    assignedVariables = copiedVariables;
+    REQUIRE(assignedVariables.Get("Variable1").GetValue() == 2);
+    REQUIRE(&assignedVariables.Get(0) != &copiedVariables.Get(0));
+  }
+}
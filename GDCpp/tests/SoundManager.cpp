@@ -0,0 +1,87 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering SoundManager.
+ */
+#include "GDCpp/Runtime/SoundManager.h"
+#include "catch.hpp"
+
+TEST_CASE("SoundManager", "[game-engine]") {
+  SoundManager soundManager;
+
+  SECTION("Buffers are shared") {
+    soundManager.PlaySound("SoundManagerTest1.wav", false, 100, 1);
+    soundManager.PlaySound("SoundManagerTest1.wav", false, 100, 1);
+    soundManager.PlaySound("SoundManagerTest2.wav", false, 100, 1);
+    REQUIRE(soundManager.sounds.size() == 3);
+    REQUIRE(soundManager.sounds[0]->buffer == soundManager.sounds[1]->buffer);
+    REQUIRE(soundManager.sounds[0]->buffer != soundManager.sounds[2]->buffer);
+    REQUIRE(soundManager.sounds[0] != soundManager.sounds[1]);
+    REQUIRE(soundManager.sounds[1]->file == "SoundManagerTest1.wav");
+    REQUIRE(soundManager.sounds[2]->file == "SoundManagerTest2.wav");
+
+    soundManager.PlaySoundOnChannel("SoundManagerTest2.wav", 1, false, 100, 1);
+    REQUIRE(soundManager.GetSoundOnChannel(1)->buffer ==
+            soundManager.sounds[2]->buffer);
+
+    // Buffers are released when not used anymore.
+    std::weak_ptr<const sf::SoundBuffer> buffer =
+        soundManager.sounds[0]->buffer;
+    soundManager.ClearAllSoundsAndMusics();
+    REQUIRE(buffer.expired());
+  }
+
+  SECTION("Stopped sounds are reused") {
+    soundManager.PlaySound("SoundManagerTest1.wav", false, 100, 1);
+    soundManager.PlaySound("SoundManagerTest1.wav", false, 100, 1);
+    std::shared_ptr<Sound> firstSound = soundManager.sounds[0];
+    Sound* secondSound = soundManager.sounds[1].get();
+
+    soundManager.sounds[1]->sound.stop();
+    soundManager.ManageGarbage();
+    REQUIRE(soundManager.sounds.size() == 1);
+    REQUIRE(soundManager.sounds[0] == firstSound);
+
+    soundManager.PlaySound("SoundManagerTest2.wav", true, 50, 1);
+    REQUIRE(soundManager.sounds.size() == 2);
+    REQUIRE(soundManager.sounds[1].get() == secondSound);
+    REQUIRE(soundManager.sounds[1]->file == "SoundManagerTest2.wav");
+    REQUIRE(soundManager.sounds[1]->GetStatus() == sf::Sound::Playing);
+    REQUIRE(soundManager.sounds[1]->GetVolume() == 50);
+
+    // Sounds kept to be reused do not keep their buffer.
+    std::weak_ptr<const sf::SoundBuffer> buffer =
+        soundManager.sounds[1]->buffer;
+    soundManager.sounds[1]->sound.stop();
+    soundManager.ManageGarbage();
+    REQUIRE(buffer.expired());
+    REQUIRE(secondSound->buffer == nullptr);
+    REQUIRE(secondSound->file.empty());
+    Sound copy(*secondSound);
+    REQUIRE(copy.buffer == nullptr);
+    soundManager.PlaySound("SoundManagerTest2.wav", true, 50, 1);
+
+    // A stopped sound still used elsewhere is not reused.
+    firstSound->sound.stop();
+    soundManager.ManageGarbage();
+    soundManager.sounds[0]->sound.stop();
+    soundManager.ManageGarbage();
+    REQUIRE(soundManager.sounds.empty());
+    for (std::size_t i = 0; i < 20; ++i)
+      soundManager.PlaySound("SoundManagerTest1.wav", false, 100, 1);
+    for (std::size_t i = 0; i < 20; ++i)
+      REQUIRE(soundManager.sounds[i] != firstSound);
+  }
+
+  SECTION("Number of sounds is limited") {
+    for (std::size_t i = 0; i < SoundManager::maxSoundsCount + 10; ++i)
+      soundManager.PlaySound("SoundManagerTest1.wav", false, 100, 1);
+
+    REQUIRE(soundManager.sounds.size() == SoundManager::maxSoundsCount);
+    for (std::size_t i = 0; i < soundManager.sounds.size(); ++i)
+      REQUIRE(soundManager.sounds[i]->GetStatus() == sf::Sound::Playing);
+  }
+}
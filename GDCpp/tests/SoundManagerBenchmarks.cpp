@@ -0,0 +1,65 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of SoundManager.
+ */
+#include <chrono>
+#include <functional>
+#include <numeric>
+#include "GDCpp/Runtime/SoundManager.h"
+#include "catch.hpp"
+
+TEST_CASE("SoundManager - Benchmarks", "[game-engine][benchmarks]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  // Rapid fire sounds: 10 sounds played each frame, during 1000 frames, with
+  // sounds ending after 5 frames.
+  SECTION("Playing 10000 sounds") {
+    SoundManager soundManager;
+    std::size_t maxPlayingSoundsCount = 0;
+    doBenchmark("PlaySound", 3, [&]() {
+      for (std::size_t frame = 0; frame < 1000; ++frame) {
+        for (std::size_t i = 0; i < 10; ++i)
+          soundManager.PlaySound(
+              i % 2 ? "SoundManagerBenchmark1.wav"
+                    : "SoundManagerBenchmark2.wav",
+              false,
+              100,
+              1);
+
+        if (soundManager.sounds.size() >= 50)
+          for (std::size_t i = 0; i < 10; ++i)
+            soundManager.sounds[i]->sound.stop();
+
+        maxPlayingSoundsCount =
+            std::max(maxPlayingSoundsCount, soundManager.sounds.size());
+        soundManager.ManageGarbage();
+      }
+    });
+    REQUIRE(maxPlayingSoundsCount == 50);
+  }
+}
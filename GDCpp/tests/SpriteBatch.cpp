@@ -0,0 +1,62 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering the batching of the sprites drawn on a render target.
+ */
+#include "GDCpp/Runtime/SpriteBatch.h"
+#include <SFML/Graphics.hpp>
+#include "catch.hpp"
+
+TEST_CASE("SpriteBatch", "[game-engine]") {
+  sf::RenderTexture renderTexture;
+  renderTexture.create(800, 600);
+
+  sf::Texture texture1;
+  texture1.create(64, 64);
+  sf::Texture texture2;
+  texture2.create(64, 64);
+  sf::Sprite sprite1(texture1);
+  sf::Sprite sprite2(texture2);
+
+  SpriteBatch batch;
+  batch.Begin(renderTexture);
+
+  SECTION("Sprites with the same render states are drawn together") {
+    for (std::size_t i = 0; i < 10; ++i) batch.Draw(sprite1);
+    REQUIRE(batch.GetDrawCallsCount() == 0);
+
+    batch.End();
+    REQUIRE(batch.GetDrawCallsCount() == 1);
+    REQUIRE(batch.GetBatchesCount() == 1);
+    REQUIRE(batch.GetVerticesCount() == 60);
+  }
+
+  SECTION("Sprites are drawn in the order they are given") {
+    batch.Draw(sprite1);
+    batch.Draw(sprite1);
+    batch.Draw(sprite2);
+    batch.Draw(sprite1);
+    batch.Draw(sprite1, sf::BlendAdd);
+    batch.Draw(sprite1, sf::BlendAdd);
+    batch.End();
+    REQUIRE(batch.GetBatchesCount() == 4);
+    REQUIRE(batch.GetVerticesCount() == 36);
+  }
+
+  SECTION("Other drawables flush the batch") {
+    batch.Draw(sprite1);
+    batch.Draw(sf::RectangleShape(sf::Vector2f(10, 10)));
+    batch.Draw(sprite1);
+    batch.End();
+    REQUIRE(batch.GetDrawCallsCount() == 3);
+    REQUIRE(batch.GetBatchesCount() == 2);
+    REQUIRE(batch.GetVerticesCount() == 12);
+
+    batch.ResetStatistics();
+    REQUIRE(batch.GetDrawCallsCount() == 0);
+    REQUIRE(batch.GetVerticesCount() == 0);
+  }
+}
@@ -0,0 +1,148 @@
+/*
+ * GDevelop C++ Platform
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Benchmarks of the access to variables, as done by events.
+ */
+#include <chrono>
+#include <functional>
+#include <numeric>
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Project/VariablesContainer.h"
+#include "GDCpp/Runtime/RuntimeVariablesContainer.h"
+#include "catch.hpp"
+
+TEST_CASE("Variables - Benchmarks", "[game-engine][benchmarks]") {
+  gd::VariablesContainer container;
+  std::vector<gd::String> variablesNames;
+  for (std::size_t i = 0; i < 100; ++i) {
+    variablesNames.push_back("Variable" + gd::String::From(i));
+    container.Insert(variablesNames.back(), gd::Variable(), i);
+  }
+
+  RuntimeVariablesContainer variables(container);
+
+  std::vector<gd::String> names;
+  for (std::size_t i = 0; i < 1000; ++i)
+    names.push_back("Name" + gd::String::From(i));
+
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  SECTION("Access 100 variables by name, 1000 times") {
+    doBenchmark("Access 100 variables by name, 1000 times", 10, [&]() {
+      for (std::size_t j = 0; j < 1000; ++j)
+        for (std::size_t i = 0; i < 100; ++i)
+          variables.Get(variablesNames[i]) += 1;
+    });
+    REQUIRE(variables.Get("Variable42").GetValue() == 10000);
+  }
+
+  SECTION("Access 100 variables by index, 1000 times") {
+    doBenchmark("Access 100 variables by index, 1000 times", 10, [&]() {
+      for (std::size_t j = 0; j < 1000; ++j)
+        for (std::size_t i = 0; i < 100; ++i) variables.Get(i) += 1;
+    });
+    REQUIRE(variables.Get(42).GetValue() == 10000);
+  }
+
+  SECTION("Fill and read a structure of 1000 children, 100 times") {
+    gd::Variable &structure = variables.Get("Variable0");
+    doBenchmark(
+        "Fill and read a structure of 1000 children, 100 times", 10, [&]() {
+          structure.ClearChildren();
+          for (std::size_t j = 0; j < 100; ++j)
+            for (std::size_t i = 0; i < names.size(); ++i)
+              structure.GetChild(names[i]) += 1;
+        });
+    REQUIRE(structure.GetChildrenCount() == 1000);
+    REQUIRE(structure.GetChild("Name42").GetValue() == 100);
+  }
+
+  SECTION("Fill and read an array of 1000 elements, 100 times") {
+    gd::Variable &array = variables.Get("Variable0");
+    doBenchmark(
+        "Fill and read an array of 1000 elements, 100 times", 10, [&]() {
+          array.ClearChildren();
+          for (std::size_t i = 0; i < 1000; ++i) array.PushNew();
+          for (std::size_t j = 0; j < 100; ++j)
+            for (std::size_t i = 0; i < 1000; ++i) array.GetAtIndex(i) += 1;
+        });
+    REQUIRE(array.GetChildrenCount() == 1000);
+    REQUIRE(array.GetAtIndex(42).GetValue() == 100);
+  }
+
+  SECTION("Read a structure of 1000 children by name, 1000 times") {
+    gd::Variable &structure = variables.Get("Variable0");
+    for (std::size_t i = 0; i < names.size(); ++i)
+      structure.GetChild(names[i]).SetValue(i);
+
+    double sum = 0;
+    doBenchmark(
+        "Read a structure of 1000 children by name, 1000 times", 10, [&]() {
+          for (std::size_t j = 0; j < 1000; ++j)
+            for (std::size_t i = 0; i < names.size(); ++i)
+              sum += structure.GetChild(names[i]).GetValue();
+        });
+    REQUIRE(sum == 10.0 * 1000 * (999 * 1000 / 2));
+  }
+
+  SECTION("Read an array of 1000 elements by index, 1000 times") {
+    gd::Variable &array = variables.Get("Variable0");
+    for (std::size_t i = 0; i < 1000; ++i) array.PushNew().SetValue(i);
+
+    double sum = 0;
+    doBenchmark(
+        "Read an array of 1000 elements by index, 1000 times", 10, [&]() {
+          for (std::size_t j = 0; j < 1000; ++j)
+            for (std::size_t i = 0; i < 1000; ++i)
+              sum += array.GetAtIndex(i).GetValue();
+        });
+    REQUIRE(sum == 10.0 * 1000 * (999 * 1000 / 2));
+  }
+
+  SECTION("Copy an array of 1000 arrays of 100 elements") {
+    gd::Variable &array = variables.Get("Variable0");
+    for (std::size_t i = 0; i < 1000; ++i) {
+      gd::Variable &element = array.PushNew();
+      for (std::size_t j = 0; j < 100; ++j) element.PushNew().SetValue(j);
+    }
+
+    doBenchmark("Copy an array of 1000 arrays of 100 elements", 10, [&]() {
+      gd::Variable copiedArray(array);
+    });
+  }
+
+  SECTION("Copy a container of 100 structures of 1000 children") {
+    for (std::size_t i = 0; i < 100; ++i)
+      for (std::size_t j = 0; j < names.size(); ++j)
+        variables.Get(i).GetChild(names[j]).SetValue(j);
+
+    doBenchmark(
+        "Copy a container of 100 structures of 1000 children", 10, [&]() {
+          RuntimeVariablesContainer copiedVariables(variables);
+        });
+  }
+}
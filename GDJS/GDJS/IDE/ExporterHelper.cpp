@@ -194,13 +194,18 @@ gd::String ExporterHelper::ExportProjectData(
     const gd::SerializerElement &runtimeGameOptions) {
   fs.MkDir(fs.DirNameFrom(filename));
 
-  // Save the project to JSON
-  gd::SerializerElement rootElement;
-  project.SerializeTo(rootElement);
-  gd::String output =
-      "gdjs.projectData = " + gd::Serializer::ToJSON(rootElement) + ";\n" +
-      "gdjs.runtimeGameOptions = " +
-      gd::Serializer::ToJSON(runtimeGameOptions) + ";\n";
+  // Save the project to JSON. The output is built by appending to a single
+  // string (and the serialized project is released as soon as it is written)
+  // to avoid holding multiple copies of the whole project data in memory.
+  gd::String output = "gdjs.projectData = ";
+  {
+    gd::SerializerElement rootElement;
+    project.SerializeTo(rootElement);
+    output += gd::Serializer::ToJSON(rootElement);
+  }
+  output += ";\ngdjs.runtimeGameOptions = ";
+  output += gd::Serializer::ToJSON(runtimeGameOptions);
+  output += ";\n";
 
   if (!fs.WriteToFile(filename, output)) return "Unable to write " + filename;
 
@@ -378,7 +378,7 @@ typedef std::map<gd::String, gd::InstructionMetadata>
     MapStringInstructionMetadata;
 typedef std::map<gd::String, gd::EventMetadata> MapStringEventMetadata;
 typedef std::map<gd::String, gd::Variable> MapStringVariable;
-typedef std::vector<std::shared_ptr<gd::Variable>> VectorVariable;
+typedef std::vector<std::unique_ptr<gd::Variable>> VectorVariable;
 typedef std::map<gd::String, gd::PropertyDescriptor>
     MapStringPropertyDescriptor;
 typedef std::set<gd::String> SetString;